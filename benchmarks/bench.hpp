@@ -0,0 +1,88 @@
+#ifndef FAS_BENCH_HPP
+#define FAS_BENCH_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+//! Keeps the compiler from optimizing away the computation of `value`.
+template <typename Tvalue> inline void keep(const Tvalue &value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile const Tvalue *sink;
+	sink = &value;
+#endif
+}
+
+//! The minimal duration of a single measurement.
+constexpr auto MIN_DURATION = std::chrono::milliseconds(50);
+
+//! Runs `operation` on all pairs of `first[i]` and `second[i]` until at
+//! least `MIN_DURATION` passed.
+//!
+//! @param values The number of values each operation processes.
+//! @returns The nanoseconds per value.
+template <typename Tfirst, typename Tsecond, typename Toperation>
+double measure(const std::vector<Tfirst> &first,
+               const std::vector<Tsecond> &second, Toperation operation,
+               const std::size_t values = 1) {
+	using clock = std::chrono::steady_clock;
+
+	const auto size = first.size() < second.size() ? first.size() : second.size();
+	std::size_t rounds = 1;
+	for (;;) {
+		const auto start = clock::now();
+		for (std::size_t round = 0; round < rounds; ++round) {
+			for (std::size_t i = 0; i < size; ++i) {
+				keep(operation(first[i], second[i]));
+			}
+		}
+		const auto duration = clock::now() - start;
+
+		if (duration >= MIN_DURATION) {
+			return std::chrono::duration<double, std::nano>(duration).count() /
+			       static_cast<double>(rounds * size * values);
+		}
+		rounds *= 2;
+	}
+}
+
+//! Prints measurements as a table, optionally only those whose name contains
+//! a filter.
+class reporter {
+	//! Only benchmarks whose name contains it are run.
+	std::string _filter;
+
+public:
+	//! Creates a reporter and prints the table's header.
+	explicit reporter(std::string filter) : _filter(std::move(filter)) {
+		std::printf("%-48s %12s %16s\n", "benchmark", "ns/op", "ops/s");
+	}
+
+	//! @returns Whether the benchmark called `name` shall run.
+	bool enabled(const std::string &name) const {
+		return name.find(_filter) != std::string::npos;
+	}
+
+	//! Runs and reports the benchmark called `name`, see `measure`.
+	template <typename Tfirst, typename Tsecond, typename Toperation>
+	void run(const std::string &name, const std::vector<Tfirst> &first,
+	         const std::vector<Tsecond> &second, Toperation operation,
+	         const std::size_t values = 1) {
+		if (!enabled(name)) {
+			return;
+		}
+
+		const auto ns = measure(first, second, operation, values);
+		std::printf("%-48s %12.2f %16.0f\n", name.c_str(), ns, 1e9 / ns);
+		std::fflush(stdout);
+	}
+};
+
+} // namespace bench
+#endif // FAS_BENCH_HPP
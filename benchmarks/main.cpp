@@ -0,0 +1,409 @@
+// Measures the throughput of the operators of several instantiations.
+//
+// Usage: fas_bench [filter]
+// Only benchmarks whose name contains `filter` are run.
+#include "bench.hpp"
+
+#include "fas/block.hpp"
+#include "fas/charconv.hpp"
+#include "fas/expr.hpp"
+#include "fas/float.hpp"
+#include "fas/math.hpp"
+#include "fas/reduce.hpp"
+#include "fas/stream.hpp"
+#include "fas/table.hpp"
+#include "fas/transform.hpp"
+#include "fas/vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+//! The number of operands per input.
+constexpr std::size_t SIZE = 1024;
+
+//! The kinds of inputs.
+enum class input { equal_exponent, mixed_exponent, special };
+
+//! @returns The input's name.
+const char *name(const input kind) {
+	switch (kind) {
+	case input::equal_exponent:
+		return "equal";
+	case input::mixed_exponent:
+		return "mixed";
+	default:
+		return "special";
+	}
+}
+
+//! @returns Operands of the given kind.
+//!
+//! - `equal_exponent` values all have the same exponent, once normalized.
+//! - `mixed_exponent` values have random exponents.
+//! - `special` values are a quarter each of zeros, infinities, not a numbers
+//!   and finite ones.
+template <typename Tfloat>
+std::vector<Tfloat> operands(const input kind, std::mt19937_64 &generator) {
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+	constexpr auto max = std::numeric_limits<Tmantissa>::max();
+	std::uniform_int_distribution<std::int64_t> mantissa(max / 2 + 1, max);
+	std::uniform_int_distribution<int> sign(0, 1);
+	std::uniform_int_distribution<int> exponent(-8, 8);
+
+	std::vector<Tfloat> result;
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		auto value = static_cast<Tmantissa>(mantissa(generator));
+		if (sign(generator)) {
+			value = -value;
+		}
+
+		if (kind == input::special && i % 4 != 0) {
+			const Tfloat specials[] = {Tfloat::ZERO(), Tfloat::INF(),
+			                           Tfloat::NOT_A_NUMBER()};
+			result.push_back(specials[i % 4 - 1]);
+		} else if (kind == input::mixed_exponent) {
+			result.push_back(Tfloat(value, exponent(generator)));
+		} else {
+			result.push_back(Tfloat(value, 0));
+		}
+	}
+	return result;
+}
+
+//! Runs all benchmarks of `Tfloat`.
+template <typename Tfloat>
+void run(bench::reporter &reporter, const std::string &type) {
+	std::mt19937_64 generator(1);
+
+	// Unchecked floats do not take special values.
+	constexpr bool checked =
+	    std::is_same<Tfloat,
+	                 fas::overflowing<Tfloat, fas::overflow::infinity>>::value;
+
+	for (const auto kind :
+	     {input::equal_exponent, input::mixed_exponent, input::special}) {
+		if (kind == input::special && !checked) {
+			continue;
+		}
+		const auto first = operands<Tfloat>(kind, generator);
+		const auto second = operands<Tfloat>(kind, generator);
+		const auto prefix = type + " " + name(kind) + " ";
+
+		reporter.run(prefix + "+", first, second,
+		             [](const Tfloat &a, const Tfloat &b) { return a + b; });
+		reporter.run(prefix + "-", first, second,
+		             [](const Tfloat &a, const Tfloat &b) { return a - b; });
+		reporter.run(prefix + "*", first, second,
+		             [](const Tfloat &a, const Tfloat &b) { return a * b; });
+		reporter.run(prefix + "/", first, second,
+		             [](const Tfloat &a, const Tfloat &b) { return a / b; });
+		reporter.run(prefix + "<", first, second,
+		             [](const Tfloat &a, const Tfloat &b) { return a < b; });
+		reporter.run(prefix + ">", first, second,
+		             [](const Tfloat &a, const Tfloat &b) { return a > b; });
+		reporter.run(prefix + "==", first, second,
+		             [](const Tfloat &a, const Tfloat &b) { return a == b; });
+	}
+
+	const auto values = operands<Tfloat>(input::mixed_exponent, generator);
+	std::vector<int> integers;
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		integers.push_back(static_cast<int>(i));
+	}
+	reporter.run(type + " + int", values, integers,
+	             [](const Tfloat &a, const int b) { return a + b; });
+	reporter.run(type + " < int", values, integers,
+	             [](const Tfloat &a, const int b) { return a < b; });
+	reporter.run(type + " * 2", values, values,
+	             [](const Tfloat &a, const Tfloat &) { return a * 2; });
+	reporter.run(type + " / BASE", values, values,
+	             [](const Tfloat &a, const Tfloat &) {
+		             return a / Tfloat::EXPONENT_BASE();
+	             });
+	reporter.run(type + " ++", values, values, [](Tfloat a, const Tfloat &) {
+		return ++a;
+	});
+
+	// Converts to and from the widest type of the same base.
+	using Twide = fas::Float<std::int64_t, std::int16_t, Tfloat::EXPONENT_BASE()>;
+	reporter.run(type + " to int64/int16", values, values,
+	             [](const Tfloat &a, const Tfloat &) { return Twide(a); });
+	reporter.run(type + " via double", values, values,
+	             [](const Tfloat &a, const Tfloat &) {
+		             return Twide(static_cast<double>(a));
+	             });
+	reporter.run(type + " + int64/int16", values, values,
+	             [](const Tfloat &a, const Tfloat &b) { return a + Twide(b); });
+
+	// Arguments of a moderate magnitude, whose results are neither trivial nor
+	// out of range.
+	std::uniform_real_distribution<double> argument(0, 8);
+	std::vector<Tfloat> arguments;
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		arguments.emplace_back(argument(generator));
+	}
+	reporter.run(type + " sqrt", arguments, arguments,
+	             [](const Tfloat &a, const Tfloat &) { return fas::sqrt(a); });
+	reporter.run(type + " exp", arguments, arguments,
+	             [](const Tfloat &a, const Tfloat &) { return fas::exp(a); });
+	reporter.run(type + " log", arguments, arguments,
+	             [](const Tfloat &a, const Tfloat &) { return fas::log(a); });
+	reporter.run(type + " sin", arguments, arguments,
+	             [](const Tfloat &a, const Tfloat &) { return fas::sin(a); });
+
+	reporter.run(type + " operator double", values, values,
+	             [](const Tfloat &a, const Tfloat &) {
+		             return static_cast<double>(a);
+	             });
+
+	std::vector<double> doubles;
+	for (const auto &value : values) {
+		doubles.push_back(static_cast<double>(value));
+	}
+	reporter.run(type + " Float(double)", doubles, doubles,
+	             [](const double a, const double) { return Tfloat(a); });
+
+	// Converts all values per operation.
+	const std::vector<int> frame = {0};
+	fas::FloatVector<Tfloat> converted;
+	reporter.run(
+	    type + " convert from double", frame, frame,
+	    [&doubles, &converted](int, int) {
+		    fas::convert(doubles.data(), doubles.size(), converted);
+		    return converted.mantissas();
+	    },
+	    doubles.size());
+
+	std::vector<double> natives(values.size());
+	fas::convert(converted, natives.data());
+	reporter.run(
+	    type + " convert to double", frame, frame,
+	    [&converted, &natives](int, int) {
+		    fas::convert(converted, natives.data());
+		    return natives.data();
+	    },
+	    natives.size());
+
+	reporter.run(
+	    type + " accumulate", frame, frame,
+	    [&values](int, int) {
+		    return std::accumulate(values.begin(), values.end(), Tfloat::ZERO());
+	    },
+	    values.size());
+	reporter.run(
+	    type + " raw accumulate", frame, frame,
+	    [&values](int, int) {
+		    return std::accumulate(values.begin(), values.end(),
+		                           fas::RawFloat<Tfloat>())
+		        .value();
+	    },
+	    values.size());
+	reporter.run(
+	    type + " reduce_sum", frame, frame,
+	    [&values](int, int) {
+		    return fas::reduce_sum(values.data(), values.size(), 1);
+	    },
+	    values.size());
+	reporter.run(
+	    type + " dot", frame, frame,
+	    [&values](int, int) {
+		    return fas::dot(values.data(), values.data(), values.size(), 1);
+	    },
+	    values.size());
+
+	// Scales, biases and clamps the values, in separate passes and fused.
+	const auto bias = values[0];
+	const auto add_bias = [bias](const Tfloat &value) { return value + bias; };
+	const auto clamp = [](const Tfloat &value) {
+		return std::clamp(value, Tfloat::ZERO(), Tfloat::MAX());
+	};
+	fas::FloatVector<Tfloat> samples;
+	for (const auto &value : values) {
+		samples.push_back(value);
+	}
+	fas::FloatVector<Tfloat> pipeline;
+	reporter.run(
+	    type + " mul, add, clamp", frame, frame,
+	    [&](int, int) {
+		    fas::mul(samples, samples, pipeline);
+		    fas::transform(fas::sequential, pipeline, pipeline, add_bias);
+		    fas::transform(fas::sequential, pipeline, pipeline, clamp);
+		    return pipeline.mantissas();
+	    },
+	    samples.size());
+	reporter.run(
+	    type + " fused mul, add, clamp", frame, frame,
+	    [&](int, int) {
+		    fas::transform(fas::sequential, samples, samples, pipeline,
+		                   fas::fuse(std::multiplies<>(), add_bias, clamp));
+		    return pipeline.mantissas();
+	    },
+	    samples.size());
+
+	// Sorts a copy of the values per operation.
+	if constexpr (!std::is_void<typename Tfloat::sort_key_type>::value) {
+		fas::FloatVector<Tfloat> unsorted;
+		for (const auto &value : values) {
+			unsorted.push_back(value);
+		}
+		reporter.run(
+		    type + " sort", frame, frame,
+		    [&unsorted](int, int) {
+			    auto copy = unsorted;
+			    fas::sort(copy);
+			    return copy.mantissas()[0];
+		    },
+		    values.size());
+		reporter.run(
+		    type + " std::sort", frame, frame,
+		    [&values](int, int) {
+			    auto copy = values;
+			    std::sort(copy.begin(), copy.end());
+			    return copy[0];
+		    },
+		    values.size());
+	}
+
+	// Blocks of 64 values, which share their exponent.
+	constexpr std::size_t block_size = 64;
+	using Tblock = fas::BlockFloat<Tfloat, block_size>;
+	std::vector<Tblock> blocks;
+	for (std::size_t i = 0; i + block_size <= values.size(); i += block_size) {
+		blocks.emplace_back(values.data() + i);
+	}
+	reporter.run(
+	    type + " block +", blocks, blocks,
+	    [](const Tblock &a, const Tblock &b) { return a + b; }, block_size);
+	reporter.run(
+	    type + " block *", blocks, blocks,
+	    [](const Tblock &a, const Tblock &b) { return a * b; }, block_size);
+
+	reporter.run(type + " to_chars", values, values,
+	             [](const Tfloat &a, const Tfloat &) {
+		             std::array<char, fas::max_chars<Tfloat>> buffer;
+		             return fas::to_chars(buffer.data(),
+		                                  buffer.data() + buffer.size(), a)
+		                 .ptr -
+		             buffer.data();
+	             });
+
+	if (reporter.enabled(type + " from_chars")) {
+		std::vector<std::string> texts;
+		for (const auto &value : values) {
+			std::array<char, fas::max_chars<Tfloat>> buffer;
+			const auto end =
+			    fas::to_chars(buffer.data(), buffer.data() + buffer.size(), value)
+			        .ptr;
+			texts.emplace_back(buffer.data(), end);
+		}
+		reporter.run(type + " from_chars", texts, texts,
+		             [](const std::string &a, const std::string &) {
+			             Tfloat result;
+			             fas::from_chars(a.data(), a.data() + a.size(), result);
+			             return result;
+		             });
+	}
+
+	if (reporter.enabled(type + " operator<<")) {
+		std::ostringstream stream;
+		reporter.run(type + " operator<<", values, values,
+		             [&stream](const Tfloat &a, const Tfloat &) {
+			             stream.str({});
+			             stream << a;
+			             return stream.tellp();
+		             });
+	}
+}
+
+//! Runs the operators of `Tfloat` against those of `fas::TabledFloat`, which
+//! load the results from tables.
+template <typename Tfloat>
+void run_tabled(bench::reporter &reporter, const std::string &type) {
+	using Ttabled = fas::TabledFloat<Tfloat>;
+	std::mt19937_64 generator(1);
+	std::uniform_real_distribution<double> distribution(-8, 8);
+
+	std::vector<Tfloat> first;
+	std::vector<Tfloat> second;
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		first.emplace_back(distribution(generator));
+		second.emplace_back(distribution(generator));
+	}
+	const std::vector<Ttabled> tabled_first(first.begin(), first.end());
+	const std::vector<Ttabled> tabled_second(second.begin(), second.end());
+
+	reporter.run(type + " +", first, second,
+	             [](const Tfloat &a, const Tfloat &b) { return a + b; });
+	reporter.run(type + " table +", tabled_first, tabled_second,
+	             [](const Ttabled &a, const Ttabled &b) { return a + b; });
+	reporter.run(type + " *", first, second,
+	             [](const Tfloat &a, const Tfloat &b) { return a * b; });
+	reporter.run(type + " table *", tabled_first, tabled_second,
+	             [](const Ttabled &a, const Ttabled &b) { return a * b; });
+	reporter.run(type + " /", first, second,
+	             [](const Tfloat &a, const Tfloat &b) { return a / b; });
+	reporter.run(type + " table /", tabled_first, tabled_second,
+	             [](const Ttabled &a, const Ttabled &b) { return a / b; });
+}
+
+//! Runs the baseline benchmarks of the native type `Tnative`.
+template <typename Tnative>
+void run_native(bench::reporter &reporter, const std::string &type) {
+	std::mt19937_64 generator(1);
+	std::uniform_real_distribution<Tnative> distribution(-8, 8);
+
+	std::vector<Tnative> first;
+	std::vector<Tnative> second;
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		first.push_back(distribution(generator));
+		second.push_back(distribution(generator));
+	}
+
+	reporter.run(type + " +", first, second,
+	             [](const Tnative a, const Tnative b) { return a + b; });
+	reporter.run(type + " -", first, second,
+	             [](const Tnative a, const Tnative b) { return a - b; });
+	reporter.run(type + " *", first, second,
+	             [](const Tnative a, const Tnative b) { return a * b; });
+	reporter.run(type + " /", first, second,
+	             [](const Tnative a, const Tnative b) { return a / b; });
+	reporter.run(type + " <", first, second,
+	             [](const Tnative a, const Tnative b) { return a < b; });
+	reporter.run(type + " ==", first, second,
+	             [](const Tnative a, const Tnative b) { return a == b; });
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+	bench::reporter reporter(argc > 1 ? argv[1] : "");
+
+	run_native<float>(reporter, "float");
+	run_native<double>(reporter, "double");
+
+	run<fas::Float<std::int8_t, std::int8_t>>(reporter, "int8/int8");
+	run<fas::Float<std::int16_t, std::int8_t>>(reporter, "int16/int8");
+	using nearest_t = fas::rounded<fas::Float<std::int16_t, std::int8_t>,
+	                               fas::rounding::nearest_even>;
+	run<nearest_t>(reporter, "int16/int8/nearest");
+	using unchecked_t = fas::unchecked<fas::Float<std::int16_t, std::int8_t>>;
+	run<unchecked_t>(reporter, "int16/int8/unchecked");
+	run<fas::Float<std::int32_t, std::int16_t>>(reporter, "int32/int16");
+	run<fas::Float<std::int64_t, std::int16_t>>(reporter, "int64/int16");
+	run<fas::Float<std::int32_t, std::int16_t, 7>>(reporter, "int32/int16/7");
+	run<fas::Float<std::int32_t, std::int16_t, 10>>(reporter, "int32/int16/10");
+	run_tabled<fas::Float<std::int8_t, std::int8_t, 2, -8, 7, -4, 3>>(reporter,
+	                                                                  "int4/int3");
+	return 0;
+}
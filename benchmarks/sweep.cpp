@@ -0,0 +1,441 @@
+// Sweeps the operators over all pairs of normalized values of narrow
+// instantiations, compares their results with a long double reference and
+// reports histograms of the errors in units of the results' last place.  The
+// last place of a result is the gap to the next value away from zero, which
+// is the one its exact value gets truncated to.  Results, which are not the
+// exact values truncated, are counted, and the sweep fails unless all are.
+//
+// Usage: fas_sweep [type] [threads] [stride]
+// - type: `int8` for `Float<int8_t, int8_t>` (the default) or `int16` for
+//   `Float<int16_t, int8_t>`.
+// - threads: The number of threads, by default (or if `0`) the number of
+//   processors.
+// - stride: Only every `stride`-th value is used as operand, to keep the
+//   sweeps of wider types feasible.  The default is 1 for `int8`, which
+//   sweeps all pairs, and 256 for `int16`.
+//
+// Returns 1, if any result is not truncated or of the wrong class.
+#include "fas/float.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+//! Counts the errors of an operation.
+struct histogram {
+	//! The number of buckets of finite errors.  Bucket `0` counts exact
+	//! results, bucket `k > 0` errors in `[2 ^ (k - 2), 2 ^ (k - 1))` ulp and
+	//! the last one all larger errors.
+	constexpr static std::size_t SIZE = 12;
+
+	//! The finite errors.
+	std::array<std::uint64_t, SIZE> buckets{};
+
+	//! The results, which are special while the reference is not, or the
+	//! other way round.
+	std::uint64_t class_mismatches = 0;
+
+	//! The finite results, which are not the exact ones truncated towards
+	//! zero, so their errors reach one ulp or their signs are off.
+	std::uint64_t violations = 0;
+
+	//! The largest finite error in ulp.
+	long double max_error = 0;
+
+	//! Records the error `ulps`.
+	void add(const long double ulps) {
+		if (ulps > max_error) {
+			max_error = ulps;
+		}
+
+		if (ulps == 0) {
+			++buckets[0];
+			return;
+		}
+
+		std::size_t bucket = 1;
+		for (long double limit = 0.5; bucket + 1 < SIZE && ulps >= limit;
+		     limit *= 2) {
+			++bucket;
+		}
+		++buckets[bucket];
+	}
+
+	//! Adds the counts of `other`.
+	void merge(const histogram &other) {
+		for (std::size_t i = 0; i < SIZE; ++i) {
+			buckets[i] += other.buckets[i];
+		}
+		class_mismatches += other.class_mismatches;
+		violations += other.violations;
+		if (other.max_error > max_error) {
+			max_error = other.max_error;
+		}
+	}
+
+	//! Prints the histogram.
+	void print() const {
+		std::printf("  exact        %12llu\n",
+		            static_cast<unsigned long long>(buckets[0]));
+		long double limit = 0.5;
+		for (std::size_t i = 1; i + 1 < SIZE; ++i, limit *= 2) {
+			std::printf("  < %-8Lg ulp %12llu\n", limit,
+			            static_cast<unsigned long long>(buckets[i]));
+		}
+		std::printf("  >= %-7Lg ulp %12llu\n", limit / 2,
+		            static_cast<unsigned long long>(buckets[SIZE - 1]));
+		std::printf("  class        %12llu\n",
+		            static_cast<unsigned long long>(class_mismatches));
+		std::printf("  not truncated%12llu\n",
+		            static_cast<unsigned long long>(violations));
+		std::printf("  max error    %12.10Lg ulp\n", max_error);
+	}
+
+	//! @returns Whether all results are truncated and of the right class.
+	bool passed() const { return class_mismatches == 0 && violations == 0; }
+};
+
+//! @returns The sign of `a + b - value`, which is exact, unlike the rounded
+//! sum of distant operands.  The rounding error of the sum is recovered by
+//! Knuth's two sum.
+int compare_sum(const long double a, const long double b,
+                const long double value) {
+	// `a + b == sum + error` exactly, with `error` below an ulp of `sum`.
+	const auto sum = a + b;
+	const auto rounded_b = sum - a;
+	const auto error = (a - (sum - rounded_b)) + (b - rounded_b);
+
+	// Unless `sum` and `value` are close, which makes their difference exact,
+	// it exceeds `error` by far.
+	const auto difference = sum - value;
+	return (difference > -error) - (difference < -error);
+}
+
+//! @returns The sign of `a * b - value`.  The products of the swept mantissas
+//! take at most 32 bits, so they are exact.
+int compare_product(const long double a, const long double b,
+                    const long double value) {
+	const auto product = a * b;
+	return (product > value) - (product < value);
+}
+
+//! @returns The sign of `a / b - value` for `b != 0`, which is the one of
+//! `a - value * b` times the one of `b`.  Like products, `value * b` is exact.
+int compare_quotient(const long double a, const long double b,
+                     const long double value) {
+	const auto product = value * b;
+	return ((a > product) - (a < product)) * (b > 0 ? 1 : -1);
+}
+
+//! Sweeps the operators of `Tfloat`.
+template <typename Tfloat> class sweep {
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+	using Texponent = std::remove_cv_t<decltype(Tfloat::MAX().exponent())>;
+
+	constexpr static long double BASE = Tfloat::EXPONENT_BASE();
+	constexpr static int EXPONENT_LOWEST = Tfloat::MIN().exponent();
+	constexpr static int EXPONENT_MAX = Tfloat::MAX().exponent();
+	constexpr static int MANTISSA_BASE = Tfloat::EXPONENT_BASE();
+	constexpr static int MANTISSA_LOWEST = Tfloat::LOWEST().mantissa();
+	constexpr static int MANTISSA_MAX = Tfloat::MAX().mantissa();
+
+	//! The operands.
+	std::vector<Tfloat> _values;
+
+	//! The operands' exact values.
+	std::vector<long double> _references;
+
+	//! `_powers[e - EXPONENT_LOWEST] == BASE ^ e`, up to `EXPONENT_MAX + 1`.
+	std::vector<long double> _powers;
+
+	//! The smallest positive and the largest negative value.
+	long double _smallest = 0;
+	long double _smallest_negative = 0;
+
+	//! The values next to `MAX()` and `LOWEST()` away from zero, from which on
+	//! results are infinite.
+	long double _above;
+	long double _below;
+
+	//! Below this magnitude results are finite, no matter how inexact their
+	//! reference is.
+	long double _finite;
+
+	//! The references are off by far less than `MARGIN` ulp, so only errors of
+	//! about zero or one ulp need to be compared exactly.
+	constexpr static long double MARGIN = 0x1p-32L;
+
+	//! @returns `BASE ^ exponent`.
+	long double power(const int exponent) const {
+		return _powers[exponent - EXPONENT_LOWEST];
+	}
+
+	//! @returns The exact value of `value`.
+	long double reference(const Tfloat &value) const {
+		switch (value.classify()) {
+		case fas::classification::finite:
+			return value.mantissa() * power(value.exponent());
+		case fas::classification::inf:
+			return std::numeric_limits<long double>::infinity();
+		case fas::classification::negative_inf:
+			return -std::numeric_limits<long double>::infinity();
+		case fas::classification::not_a_number:
+			return std::numeric_limits<long double>::quiet_NaN();
+		default:
+			return 0;
+		}
+	}
+
+	//! @returns The exact value next to the finite, nonzero `value` away from
+	//! zero.  The largest magnitudes continue with one digit less at the next
+	//! exponent, which may exceed `EXPONENT_MAX`.
+	long double away(const Tfloat &value) const {
+		const int mantissa = value.mantissa();
+		const int exponent = value.exponent();
+		if (mantissa == MANTISSA_MAX) {
+			return (MANTISSA_MAX / MANTISSA_BASE + 1) * power(exponent + 1);
+		}
+		if (mantissa == MANTISSA_LOWEST) {
+			return (MANTISSA_LOWEST / MANTISSA_BASE - 1) * power(exponent + 1);
+		}
+		return (mantissa + (mantissa > 0 ? 1 : -1)) * power(exponent);
+	}
+
+	//! Records the error of `actual` compared to the exact result `expected`.
+	//!
+	//! @param compare Returns the sign of the exact result minus a value, which
+	//!        `expected` may be too inexact to tell.
+	template <typename Tcompare>
+	void record(const Tfloat &actual, const long double expected,
+	            const Tcompare &compare, histogram &target) const {
+		const auto actual_class = actual.classify();
+
+		if (std::isnan(expected)) {
+			if (actual_class != fas::classification::not_a_number) {
+				++target.class_mismatches;
+			} else {
+				target.add(0);
+			}
+			return;
+		}
+
+		// Results truncating beyond the largest magnitudes are expected to be
+		// infinite.
+		if (std::isinf(expected) ||
+		    (std::fabs(expected) > _finite &&
+		     (compare(_above) >= 0 || compare(_below) <= 0))) {
+			const auto expected_class = expected > 0
+			                                ? fas::classification::inf
+			                                : fas::classification::negative_inf;
+			if (actual_class != expected_class) {
+				++target.class_mismatches;
+			} else {
+				target.add(0);
+			}
+			return;
+		}
+
+		if (actual_class != fas::classification::finite &&
+		    actual_class != fas::classification::zero) {
+			++target.class_mismatches;
+			return;
+		}
+
+		// Truncated results lie between their exact value and zero, and the next
+		// value away from zero lies beyond it.  Zero is next to the smallest
+		// magnitudes of both signs.
+		const bool zero = actual_class == fas::classification::zero;
+		const auto value = reference(actual);
+		const auto next =
+		    zero ? (expected < 0 ? _smallest_negative : _smallest) : away(actual);
+		const auto ulps = (expected - value) / (next - value);
+		auto truncated = ulps > MARGIN && ulps < 1 - MARGIN;
+		if (!truncated) {
+			truncated = zero ? compare(_smallest) < 0 && compare(_smallest_negative) > 0
+			            : value > 0 ? compare(value) >= 0 && compare(next) < 0
+			                        : compare(value) <= 0 && compare(next) > 0;
+		}
+		if (!truncated) {
+			++target.violations;
+		}
+
+		// The reference may round errors just below one ulp up to it.
+		target.add(truncated ? std::min(std::fabs(ulps), 1 - MARGIN)
+		                     : std::fabs(ulps));
+	}
+
+public:
+	//! Collects all normalized values and the special ones.
+	sweep() {
+		for (int exponent = EXPONENT_LOWEST; exponent <= EXPONENT_MAX + 1;
+		     ++exponent) {
+			_powers.push_back(std::pow(BASE, static_cast<long double>(exponent)));
+		}
+		_above = away(Tfloat::MAX());
+		_below = away(Tfloat::LOWEST());
+		_finite = std::min(reference(Tfloat::MAX()), -reference(Tfloat::LOWEST())) / 2;
+
+		for (int exponent = EXPONENT_LOWEST; exponent <= EXPONENT_MAX;
+		     ++exponent) {
+			for (std::intmax_t mantissa = std::numeric_limits<Tmantissa>::lowest();
+			     mantissa <= std::numeric_limits<Tmantissa>::max(); ++mantissa) {
+				const auto value = Tfloat(static_cast<Tmantissa>(mantissa),
+				                          static_cast<Texponent>(exponent));
+				// Only normalized values, each once.
+				if (value.mantissa() == mantissa && value.exponent() == exponent &&
+				    mantissa != 0) {
+					_values.push_back(value);
+				}
+			}
+		}
+
+		for (const auto &value : _values) {
+			const auto exact = reference(value);
+			if (exact > 0 && (_smallest == 0 || exact < _smallest)) {
+				_smallest = exact;
+			}
+			if (exact < 0 && (_smallest_negative == 0 || exact > _smallest_negative)) {
+				_smallest_negative = exact;
+			}
+		}
+
+		for (const auto &value : {Tfloat::ZERO(), Tfloat::INF(),
+		                          Tfloat::NEGATIVE_INF(), Tfloat::NOT_A_NUMBER()}) {
+			_values.push_back(value);
+		}
+
+		for (const auto &value : _values) {
+			_references.push_back(reference(value));
+		}
+	}
+
+	//! @returns The number of operands.
+	std::size_t size() const { return _values.size(); }
+
+	//! Runs `operation` and `exact` over all pairs of operands on `threads`
+	//! threads, taking only every `stride`-th operand.
+	//!
+	//! @param compare Returns the sign of the exact result of finite operands
+	//!        minus a given value.
+	//! @returns Whether all results are truncated and of the right class.
+	template <typename Toperation, typename Texact, typename Tcompare>
+	bool run(const char *name, const unsigned threads, const std::size_t stride,
+	         Toperation operation, Texact exact, Tcompare compare) const {
+		std::vector<histogram> histograms(threads);
+		std::vector<std::thread> workers;
+		std::atomic<std::size_t> next{0};
+
+		const auto start = std::chrono::steady_clock::now();
+		for (unsigned thread = 0; thread < threads; ++thread) {
+			workers.emplace_back([&, thread] {
+				auto &target = histograms[thread];
+				for (auto i = stride * next++; i < _values.size();
+				     i = stride * next++) {
+					for (std::size_t j = 0; j < _values.size(); j += stride) {
+						const auto a = _references[i];
+						const auto b = _references[j];
+						const auto expected = exact(a, b);
+						// Finite results of infinite operands are zero, so `expected`
+						// is exact.
+						const auto sign = [&](const long double value) {
+							if (std::isfinite(a) && std::isfinite(b)) {
+								return compare(a, b, value);
+							}
+							return (expected > value) - (expected < value);
+						};
+						record(operation(_values[i], _values[j]), expected, sign,
+						       target);
+					}
+				}
+			});
+		}
+		for (auto &worker : workers) {
+			worker.join();
+		}
+		const std::chrono::duration<double> duration =
+		    std::chrono::steady_clock::now() - start;
+
+		histogram total;
+		for (const auto &part : histograms) {
+			total.merge(part);
+		}
+
+		const auto operands =
+		    static_cast<double>((_values.size() + stride - 1) / stride);
+		const auto pairs = operands * operands;
+		std::printf("%s: %.0f pairs in %.2f s, %.2f ns per pair and thread\n",
+		            name, pairs, duration.count(),
+		            duration.count() * 1e9 * threads / pairs);
+		total.print();
+		std::fflush(stdout);
+		return total.passed();
+	}
+
+	//! Runs all operators.
+	//!
+	//! @returns Whether all results are truncated and of the right class.
+	bool run_all(const unsigned threads, const std::size_t stride) const {
+		std::printf("%zu operands, %u threads, stride %zu\n", size(), threads,
+		            stride);
+		bool passed = run(
+		    "+", threads, stride,
+		    [](const Tfloat &a, const Tfloat &b) { return a + b; },
+		    [](long double a, long double b) { return a + b; }, compare_sum);
+		passed &= run(
+		    "-", threads, stride,
+		    [](const Tfloat &a, const Tfloat &b) { return a - b; },
+		    [](long double a, long double b) { return a - b; },
+		    [](long double a, long double b, long double value) {
+			    return compare_sum(a, -b, value);
+		    });
+		passed &= run(
+		    "*", threads, stride,
+		    [](const Tfloat &a, const Tfloat &b) { return a * b; },
+		    [](long double a, long double b) { return a * b; }, compare_product);
+		passed &= run(
+		    "/", threads, stride,
+		    [](const Tfloat &a, const Tfloat &b) { return a / b; },
+		    [](long double a, long double b) { return a / b; }, compare_quotient);
+		return passed;
+	}
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+	const std::string type = argc > 1 ? argv[1] : "int8";
+	auto threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 0;
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	const auto stride = [&](const std::size_t fallback) {
+		return std::max<std::size_t>(1, argc > 3 ? std::atoi(argv[3]) : fallback);
+	};
+
+	bool passed;
+	if (type == "int8") {
+		passed =
+		    sweep<fas::Float<std::int8_t, std::int8_t>>().run_all(threads, stride(1));
+	} else if (type == "int16") {
+		passed = sweep<fas::Float<std::int16_t, std::int8_t>>().run_all(
+		    threads, stride(256));
+	} else {
+		std::fprintf(stderr, "Unknown type %s, expected int8 or int16.\n",
+		             type.c_str());
+		return 1;
+	}
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,320 @@
+#ifndef FLOATING_POINT_ACCUMULATOR_HPP
+#define FLOATING_POINT_ACCUMULATOR_HPP
+#include "fas/float.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fas {
+
+//! Sums floats and products of floats exactly, in the manner of Kulisch's
+//! long accumulator.  It holds a fixed point integer covering every exponent
+//! of `Tfloat` and of the products of two `Tfloat`s, so adding only shifts
+//! the mantissa and adds it.  The sum gets rounded once by `result()`.
+//!
+//! Since integer addition is associative, the result does not depend on the
+//! order of the additions and merges.  For `Float<int16_t, int8_t>` the
+//! integer has 608 bits, for floats with 16 bit exponents about 128 KiBit.
+//!
+//! The integer is stored in digits of `DIGIT_BITS` bits, each held by a
+//! signed 64 bit integer.  The spare bits take up the carries, which are
+//! propagated only every `CAPACITY` additions.
+//!
+//! @tparam Tfloat The `Float` type to sum, its BASE needs to be a power of
+//!         two.
+template <typename Tfloat> class Accumulator {
+	//! The float's mantissa type.
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+
+	static_assert(Tfloat::BASE_IS_POWER_OF_TWO,
+	              "The accumulator supports bases, which are powers of two.");
+
+	//! The doubled width type, `void` if there is none.
+	using Twide = typename detail::wider<Tmantissa>::type;
+
+	//! The type of the products' mantissas.
+	using Tproduct = std::conditional_t<std::is_void<Twide>::value, Tmantissa,
+	                                    Twide>;
+
+	//! The type of the terms' magnitudes and of the bits the result is taken
+	//! from, at least 64 bits wide.
+	using Tmagnitude =
+	    std::conditional_t<(sizeof(Tproduct) > 8),
+	                       typename detail::make_unsigned<Tproduct>::type,
+	                       std::uint64_t>;
+
+	//! Holds a digit and its carries.
+	using Tdigit = std::int64_t;
+
+public:
+	//! The bits per digit.
+	constexpr static int DIGIT_BITS = 32;
+
+	//! The number of additions, after which carries need to be propagated.
+	//! Until then, a digit's magnitude stays below `(CAPACITY + 2) * 2 ^ 32`.
+	constexpr static std::int64_t CAPACITY = (std::int64_t(1) << 30) - 1;
+
+	//! The exponent of the integer's lowest digit.
+	constexpr static std::intmax_t LOWEST =
+	    std::min<std::intmax_t>(Tfloat::MIN().exponent(),
+	                            2 * std::intmax_t(Tfloat::MIN().exponent()));
+
+	//! The exponent of the largest products.
+	constexpr static std::intmax_t HIGHEST =
+	    std::max<std::intmax_t>(Tfloat::MAX().exponent(),
+	                            2 * std::intmax_t(Tfloat::MAX().exponent()));
+
+	//! The bits of the integer: All exponents, the products' mantissas and
+	//! 64 bits for the carries of up to `2 ^ 64` additions.
+	constexpr static std::intmax_t BITS =
+	    (HIGHEST - LOWEST) * Tfloat::BASE_BITS + 2 * detail::digits<Tmantissa> +
+	    64;
+
+	//! The number of digits.
+	constexpr static std::size_t SIZE = BITS / DIGIT_BITS + 1;
+
+private:
+	//! The digits of the integer, the lowest one first.  The digits below
+	//! `_high - 1` are in `[0, 2 ^ 32)` after propagating the carries, the
+	//! highest one holds the sign.
+	std::array<Tdigit, SIZE> _digits{};
+
+	//! The digits `[_low, _high)` may be non-zero.
+	std::size_t _low = SIZE;
+	std::size_t _high = 0;
+
+	//! The number of additions since the carries have been propagated.
+	std::int64_t _additions = 0;
+
+	//! Whether an infinity has been added.
+	bool _inf = false;
+
+	//! Whether a negative infinity has been added.
+	bool _negative_inf = false;
+
+	//! Whether a not a number has been added.
+	bool _not_a_number = false;
+
+	//! Propagates the carries of the digits `[_low, _high)`, such that each,
+	//! but the highest one, is in `[0, 2 ^ 32)`.
+	constexpr void propagate() noexcept {
+		for (auto i = _low; i + 1 < _high; ++i) {
+			// Shifting right rounds down, also for negative digits.
+			const auto carry = _digits[i] >> DIGIT_BITS;
+			_digits[i] -= carry * (Tdigit(1) << DIGIT_BITS);
+			_digits[i + 1] += carry;
+
+			// The highest digit takes up to 32 bits, besides its sign.
+			if (i + 2 == _high && _high < SIZE &&
+			    (_digits[i + 1] >= (Tdigit(1) << DIGIT_BITS) ||
+			     _digits[i + 1] <= -(Tdigit(1) << DIGIT_BITS))) {
+				++_high;
+			}
+		}
+		_additions = 0;
+	}
+
+	//! Adds `mantissa * BASE ^ exponent`.
+	//!
+	//! @tparam MAGNITUDE_BITS The bits of the mantissa's magnitude.  The digits
+	//!         it may cover are added unconditionally, which is faster than
+	//!         deciding whether they are zero.
+	template <int MAGNITUDE_BITS>
+	constexpr void add_term(const Tproduct mantissa,
+	                        const std::intmax_t exponent) noexcept {
+		if (_additions == CAPACITY) {
+			propagate();
+		}
+		++_additions;
+
+		const auto position =
+		    static_cast<std::size_t>(exponent - LOWEST) * Tfloat::BASE_BITS;
+		const auto offset = static_cast<int>(position % DIGIT_BITS);
+		const bool negative = mantissa < 0;
+
+		// Negates the magnitude and the digits without branching on the random
+		// signs.
+		const auto magnitude_sign = Tmagnitude(0) - Tmagnitude(negative);
+		auto magnitude =
+		    (static_cast<Tmagnitude>(mantissa) ^ magnitude_sign) - magnitude_sign;
+		const auto sign = -static_cast<Tdigit>(negative);
+
+		constexpr int count = (MAGNITUDE_BITS + DIGIT_BITS - 1) / DIGIT_BITS + 1;
+		constexpr auto mask = (Tmagnitude(1) << DIGIT_BITS) - 1;
+		const auto index = position / DIGIT_BITS;
+
+		const auto digit = static_cast<Tdigit>((magnitude << offset) & mask);
+		_digits[index] += (digit ^ sign) - sign;
+		magnitude >>= DIGIT_BITS - offset;
+		for (int i = 1; i < count; ++i, magnitude >>= DIGIT_BITS) {
+			const auto next = static_cast<Tdigit>(magnitude & mask);
+			_digits[index + i] += (next ^ sign) - sign;
+		}
+
+		_low = std::min(_low, index);
+		_high = std::max(_high, index + count);
+	}
+
+	//! @returns The bits `[position, position + digits<Tmagnitude>)` of the
+	//! digits, whose carries have been propagated and which are not negative.
+	constexpr Tmagnitude bits(const std::size_t position) const noexcept {
+		constexpr std::size_t width = detail::digits<Tmagnitude>;
+		Tmagnitude result = 0;
+		const auto offset = static_cast<int>(position % DIGIT_BITS);
+		for (auto index = position / DIGIT_BITS, shift = std::size_t(0);
+		     index < _high && shift < width + DIGIT_BITS;
+		     ++index, shift += DIGIT_BITS) {
+			const auto digit =
+			    static_cast<Tmagnitude>(static_cast<std::uint64_t>(_digits[index]));
+			if (shift == 0) {
+				result = digit >> offset;
+			} else if (shift - offset < width) {
+				result |= digit << (shift - offset);
+			}
+		}
+		return result;
+	}
+
+	//! @returns The bits below `position` as a fraction of the bit at
+	//! `position`:  The next `digits<Tmagnitude> - 1` bits, of which the lowest
+	//! one is set also if any lower bit is, so the fraction is zero only if
+	//! those bits are.
+	constexpr detail::fraction<Tmagnitude>
+	fraction_below(const std::size_t position) const noexcept {
+		constexpr std::size_t width = detail::digits<Tmagnitude> - 1;
+		const auto start = position > width ? position - width : 0;
+		const auto count = position - start;
+		auto numerator = (bits(start) & ((Tmagnitude(1) << count) - 1))
+		                 << (width - count);
+
+		const auto index = start / DIGIT_BITS;
+		const auto offset = start % DIGIT_BITS;
+		bool sticky = (static_cast<std::uint64_t>(_digits[index]) &
+		               ((std::uint64_t(1) << offset) - 1)) != 0;
+		for (auto lower = _low; lower < index; ++lower) {
+			sticky |= _digits[lower] != 0;
+		}
+		return {numerator | Tmagnitude(sticky), Tmagnitude(1) << width};
+	}
+
+public:
+	//! Creates an accumulator holding zero.
+	constexpr Accumulator() noexcept = default;
+
+	//! Adds `value`.
+	constexpr void add(const Tfloat &value) noexcept {
+		switch (value.classify()) {
+		case classification::finite:
+			add_term<detail::digits<Tmantissa>>(value.mantissa(),
+			                                    value.exponent());
+			return;
+		case classification::zero:
+			return;
+		case classification::inf:
+			_inf = true;
+			return;
+		case classification::negative_inf:
+			_negative_inf = true;
+			return;
+		case classification::not_a_number:
+			_not_a_number = true;
+			return;
+		}
+	}
+
+	//! Adds the exact product of `first` and `second`.  Products of special
+	//! values are evaluated like `first * second` does.
+	constexpr void add_product(const Tfloat &first,
+	                           const Tfloat &second) noexcept {
+		static_assert(!std::is_void<Twide>::value,
+		              "Products need a mantissa of up to 64 bits.");
+
+		if (first.classify() == classification::finite &&
+		    second.classify() == classification::finite) {
+			add_term<2 * detail::digits<Tmantissa>>(
+			    static_cast<Tproduct>(first.mantissa()) * second.mantissa(),
+			    std::intmax_t(first.exponent()) + second.exponent());
+		} else {
+			add(first * second);
+		}
+	}
+
+	//! Adds the sum held by `other`, for example by another thread.
+	constexpr void merge(const Accumulator &other) noexcept {
+		_inf |= other._inf;
+		_negative_inf |= other._negative_inf;
+		_not_a_number |= other._not_a_number;
+		if (other._low >= other._high) {
+			return;
+		}
+
+		auto addend = other;
+		if (_additions + addend._additions >= CAPACITY) {
+			propagate();
+			addend.propagate();
+		}
+
+		for (auto i = addend._low; i < addend._high; ++i) {
+			_digits[i] += addend._digits[i];
+		}
+		_low = std::min(_low, addend._low);
+		_high = std::max(_high, addend._high);
+		_additions += addend._additions + 1;
+	}
+
+	//! @returns The sum, rounded by the rounding mode of `Tfloat`.  It is not a
+	//! number, if a not a number or infinities of both signs have been added.
+	constexpr Tfloat result() const noexcept {
+		if (_not_a_number || (_inf && _negative_inf)) {
+			return Tfloat::NOT_A_NUMBER();
+		}
+
+		if (_inf || _negative_inf) {
+			return _inf ? Tfloat::INF() : Tfloat::NEGATIVE_INF();
+		}
+
+		auto sum = *this;
+		sum.propagate();
+		auto high = sum._high;
+		while (high > sum._low && sum._digits[high - 1] == 0) {
+			--high;
+		}
+		if (high == sum._low) {
+			return Tfloat::ZERO();
+		}
+
+		// Negates the digits to make them positive.
+		const bool negative = sum._digits[high - 1] < 0;
+		if (negative) {
+			for (auto i = sum._low; i < sum._high; ++i) {
+				sum._digits[i] = -sum._digits[i];
+			}
+			sum.propagate();
+			while (sum._digits[high - 1] == 0) {
+				--high;
+			}
+		}
+
+		// Takes the highest bits fitting `Tmagnitude` at most, starting at a
+		// whole digit of BASE.
+		constexpr std::size_t width = detail::digits<Tmagnitude>;
+		const auto length = (high - 1) * DIGIT_BITS +
+		                    detail::bit_width(static_cast<std::uint64_t>(
+		                        sum._digits[high - 1]));
+		const auto excess = length > width ? length - width : 0;
+		const auto digits = (excess + Tfloat::BASE_BITS - 1) / Tfloat::BASE_BITS;
+		const auto position = digits * Tfloat::BASE_BITS;
+		const auto exponent = LOWEST + static_cast<std::intmax_t>(digits);
+		if constexpr (Tfloat::ROUNDING_MODE() != rounding::truncate) {
+			return Tfloat::from_magnitude(sum.bits(position), negative, exponent,
+			                              sum.fraction_below(position));
+		}
+		return Tfloat::from_magnitude(sum.bits(position), negative, exponent);
+	}
+};
+
+} // namespace fas
+#endif // FLOATING_POINT_ACCUMULATOR_HPP
@@ -0,0 +1,350 @@
+#ifndef FLOATING_POINT_BLOCK_HPP
+#define FLOATING_POINT_BLOCK_HPP
+#include "fas/float.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace fas {
+
+//! Stores `N` floats of `Tfloat` in block floating point: `N` mantissas share
+//! a single exponent, so the block takes the exponent's storage only once.
+//! The value at index `i` is `mantissas()[i] * BASE ^ exponent()`.
+//!
+//! The shared exponent is that of the largest magnitudes, smaller values keep
+//! fewer digits.  Sums and products of blocks are taken mantissa by mantissa
+//! in the doubled width, as plain integer loops the compiler vectorizes.  The
+//! results are shifted back only if they overflow the mantissas, which is
+//! checked once per block, not per value.  Blocks are not normalized
+//! otherwise, see `normalize`.
+//!
+//! Blocks hold neither infinities nor not a numbers.  Their values need to be
+//! finite and their results in range, which is asserted unless `NDEBUG` is
+//! defined.  The digits shifted out get truncated towards zero.
+//!
+//! @tparam Tfloat The `Float` type to store, whose mantissa type needs a type
+//!         of the doubled width.
+//! @tparam N The number of values per block.
+template <typename Tfloat, std::size_t N> class BlockFloat {
+public:
+	//! The type of the values.
+	using value_type = Tfloat;
+
+	//! The values' mantissa type.
+	using mantissa_type = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+
+	//! The values' exponent type.
+	using exponent_type = std::remove_cv_t<decltype(Tfloat::MAX().exponent())>;
+
+	//! The number of values per block.
+	constexpr static std::size_t SIZE = N;
+
+private:
+	//! The type of the intermediate sums and products.
+	using Twide = typename detail::wider<mantissa_type>::type;
+	static_assert(!std::is_void<Twide>::value,
+	              "Blocks need a type of the doubled mantissa width.");
+	static_assert(Twide(-1) < 0, "Blocks need signed mantissas.");
+
+	//! The magnitudes of `Twide` values.
+	using Tunsigned = typename detail::make_unsigned<Twide>::type;
+
+	//! The float's base.
+	constexpr static mantissa_type BASE = Tfloat::EXPONENT_BASE();
+
+	//! Whether BASE is a power of two, so digits can be shifted.
+	constexpr static bool BASE_IS_POWER_OF_TWO = (BASE & (BASE - 1)) == 0;
+
+	//! The binary digits of a digit of BASE, if BASE is a power of two.
+	constexpr static int BASE_BITS =
+	    detail::bit_width(static_cast<std::uintmax_t>(BASE)) - 1;
+
+	//! The powers of BASE, which `Twide` holds.
+	using powers = detail::powers<Tunsigned, static_cast<Tunsigned>(BASE)>;
+
+	//! The range of the mantissas.
+	constexpr static Twide MANTISSA_LOWEST = Tfloat::LOWEST().mantissa();
+	constexpr static Twide MANTISSA_MAX = Tfloat::MAX().mantissa();
+
+	//! The range of the exponent.
+	constexpr static std::intmax_t EXPONENT_LOWEST = Tfloat::MIN().exponent();
+	constexpr static std::intmax_t EXPONENT_MAX = Tfloat::MAX().exponent();
+
+	//! Holds the mantissas.
+	std::array<mantissa_type, N> _mantissas{};
+
+	//! Holds the shared exponent, the lowest one for a block of zeros.
+	exponent_type _exponent = static_cast<exponent_type>(EXPONENT_LOWEST);
+
+	//! @returns `value / BASE ^ digits`, truncated towards zero.
+	//!
+	//! @param digits The number of digits to drop, needs to be `>= 0`.
+	constexpr static Twide shrink(const Twide value, const int digits) noexcept {
+		if (static_cast<std::size_t>(digits) >= powers::values.size()) {
+			return 0;
+		}
+		if constexpr (BASE_IS_POWER_OF_TWO) {
+			// Rounds negative values towards zero by adding the largest
+			// remainder first, which takes no branch.
+			const auto shift = digits * BASE_BITS;
+			const auto sign = value < 0 ? Twide(-1) : Twide(0);
+			return (value + (sign & ((Twide(1) << shift) - 1))) >> shift;
+		} else {
+			// Blocks of equal exponents drop no digits, which saves the division.
+			return digits == 0 ? value
+			                   : value / static_cast<Twide>(powers::values[digits]);
+		}
+	}
+
+	//! @returns The fewest digits, by which `lowest` and `highest` need to
+	//! shrink to fit into the mantissas.
+	constexpr static int overflow_digits(const Twide lowest,
+	                                     const Twide highest) noexcept {
+		int digits = 0;
+		while (shrink(highest, digits) > MANTISSA_MAX ||
+		       shrink(lowest, digits) < MANTISSA_LOWEST) {
+			++digits;
+		}
+		return digits;
+	}
+
+	//! @returns The block of `values * BASE ^ exponent`, shrunk by the fewest
+	//! digits making them fit into the mantissas and the exponent's range.
+	//!
+	//! @param lowest The smallest of `values`.
+	//! @param highest The largest of `values`.
+	constexpr static BlockFloat from_wide(const std::array<Twide, N> &values,
+	                                      const Twide lowest, const Twide highest,
+	                                      std::intmax_t exponent) noexcept {
+		auto digits = overflow_digits(lowest, highest);
+		exponent += digits;
+		if (exponent < EXPONENT_LOWEST) {
+			digits += static_cast<int>(EXPONENT_LOWEST - exponent);
+			exponent = EXPONENT_LOWEST;
+		}
+		assert(exponent <= EXPONENT_MAX);
+
+		BlockFloat result;
+		result._exponent = static_cast<exponent_type>(exponent);
+		for (std::size_t i = 0; i < N; ++i) {
+			result._mantissas[i] =
+			    static_cast<mantissa_type>(shrink(values[i], digits));
+		}
+		return result;
+	}
+
+	//! @returns The sums, or differences if `subtract`, of `first` and
+	//! `second`, at the larger of their exponents.
+	constexpr static BlockFloat sum(const BlockFloat &first,
+	                                const BlockFloat &second,
+	                                const bool subtract) noexcept {
+		const auto exponent = std::max(first._exponent, second._exponent);
+		const auto first_digits = static_cast<int>(exponent - first._exponent);
+		const auto second_digits = static_cast<int>(exponent - second._exponent);
+
+		std::array<Twide, N> sums{};
+		Twide lowest = 0;
+		Twide highest = 0;
+		for (std::size_t i = 0; i < N; ++i) {
+			const auto addend = shrink(second._mantissas[i], second_digits);
+			sums[i] = shrink(first._mantissas[i], first_digits) +
+			          (subtract ? -addend : addend);
+			lowest = std::min(lowest, sums[i]);
+			highest = std::max(highest, sums[i]);
+		}
+		return from_wide(sums, lowest, highest, exponent);
+	}
+
+public:
+	//! Creates a block of zeros.
+	constexpr BlockFloat() = default;
+
+	//! Creates a block of the `N` values at `values`.
+	explicit constexpr BlockFloat(const Tfloat *const values) noexcept {
+		assign(values, N);
+	}
+
+	//! Creates a block of the given values, which are followed by zeros.
+	constexpr BlockFloat(const std::initializer_list<Tfloat> values) noexcept {
+		assert(values.size() <= N);
+		assign(values.begin(), values.size());
+	}
+
+	//! Replaces the values by the `count` values at `values`, which are
+	//! followed by zeros.  The shared exponent is the largest of the values'
+	//! ones, so the smaller values get truncated.
+	//!
+	//! @param count The number of values, needs to be `<= N`.
+	constexpr void assign(const Tfloat *const values,
+	                      const std::size_t count) noexcept {
+		std::intmax_t exponent = EXPONENT_LOWEST;
+		for (std::size_t i = 0; i < count; ++i) {
+			assert(values[i].classify() == classification::finite ||
+			       values[i].classify() == classification::zero);
+			if (values[i].mantissa() != 0) {
+				exponent = std::max<std::intmax_t>(exponent, values[i].exponent());
+			}
+		}
+
+		_exponent = static_cast<exponent_type>(exponent);
+		for (std::size_t i = 0; i < N; ++i) {
+			_mantissas[i] =
+			    i < count ? static_cast<mantissa_type>(
+			                    shrink(values[i].mantissa(),
+			                           static_cast<int>(exponent -
+			                                            values[i].exponent())))
+			              : mantissa_type(0);
+		}
+	}
+
+	//! Stores the `N` values at `target`, see `operator[]`.
+	constexpr void store(Tfloat *const target) const noexcept {
+		for (std::size_t i = 0; i < N; ++i) {
+			target[i] = (*this)[i];
+		}
+	}
+
+	//! @returns The value at the given index, which needs to be `< N`.
+	constexpr Tfloat operator[](const std::size_t index) const noexcept {
+		return Tfloat(_mantissas[index], _exponent);
+	}
+
+	//! Replaces the value at the given index, which needs to be `< N`.  If
+	//! its exponent is larger than the shared one, the other values are
+	//! shifted to it.  Otherwise the value gets truncated to the shared one.
+	constexpr void set(const std::size_t index, const Tfloat &value) noexcept {
+		assert(value.classify() == classification::finite ||
+		       value.classify() == classification::zero);
+		if (value.mantissa() != 0 && value.exponent() > _exponent) {
+			const auto digits = static_cast<int>(value.exponent() - _exponent);
+			for (auto &mantissa : _mantissas) {
+				mantissa = static_cast<mantissa_type>(shrink(mantissa, digits));
+			}
+			_exponent = value.exponent();
+		}
+		const auto digits = static_cast<int>(_exponent - value.exponent());
+		_mantissas[index] =
+		    static_cast<mantissa_type>(shrink(value.mantissa(), digits));
+	}
+
+	//! @returns The mantissas.
+	constexpr const std::array<mantissa_type, N> &mantissas() const noexcept {
+		return _mantissas;
+	}
+
+	//! @returns The shared exponent.
+	constexpr exponent_type exponent() const noexcept { return _exponent; }
+
+	//! Grows the mantissas by as many digits as the largest magnitude allows,
+	//! which regains the digits lost to cancellations.  A block of zeros gets
+	//! the lowest exponent.
+	constexpr void normalize() noexcept {
+		const auto lowest = *std::min_element(_mantissas.begin(), _mantissas.end());
+		const auto highest =
+		    *std::max_element(_mantissas.begin(), _mantissas.end());
+		if (lowest == 0 && highest == 0) {
+			_exponent = static_cast<exponent_type>(EXPONENT_LOWEST);
+			return;
+		}
+
+		std::intmax_t digits = 0;
+		while (digits < _exponent - EXPONENT_LOWEST &&
+		       static_cast<std::size_t>(digits + 1) < powers::values.size()) {
+			// Larger powers exceed the mantissas with any nonzero factor.
+			const auto power = static_cast<Twide>(powers::values[digits + 1]);
+			if (power > MANTISSA_MAX - MANTISSA_LOWEST ||
+			    highest * power > MANTISSA_MAX || lowest * power < MANTISSA_LOWEST) {
+				break;
+			}
+			++digits;
+		}
+
+		const auto power = static_cast<mantissa_type>(powers::values[digits]);
+		for (auto &mantissa : _mantissas) {
+			mantissa *= power;
+		}
+		_exponent = static_cast<exponent_type>(_exponent - digits);
+	}
+
+	//! @returns The sums of the values of `first` and `second`.
+	friend constexpr BlockFloat operator+(const BlockFloat &first,
+	                                      const BlockFloat &second) noexcept {
+		return sum(first, second, false);
+	}
+
+	//! @returns The differences of the values of `first` and `second`.
+	friend constexpr BlockFloat operator-(const BlockFloat &first,
+	                                      const BlockFloat &second) noexcept {
+		return sum(first, second, true);
+	}
+
+	//! @returns The products of the values of `first` and `second`.
+	friend constexpr BlockFloat operator*(const BlockFloat &first,
+	                                      const BlockFloat &second) noexcept {
+		std::array<Twide, N> products{};
+		Twide lowest = 0;
+		Twide highest = 0;
+		for (std::size_t i = 0; i < N; ++i) {
+			products[i] = Twide(first._mantissas[i]) * second._mantissas[i];
+			lowest = std::min(lowest, products[i]);
+			highest = std::max(highest, products[i]);
+		}
+		return from_wide(products, lowest, highest,
+		                 std::intmax_t(first._exponent) + second._exponent);
+	}
+
+	//! @returns The products of the values of `block` and `factor`.
+	friend constexpr BlockFloat operator*(const BlockFloat &block,
+	                                      const Tfloat &factor) noexcept {
+		assert(factor.classify() == classification::finite ||
+		       factor.classify() == classification::zero);
+		if (factor.mantissa() == 0) {
+			return BlockFloat();
+		}
+
+		std::array<Twide, N> products{};
+		Twide lowest = 0;
+		Twide highest = 0;
+		for (std::size_t i = 0; i < N; ++i) {
+			products[i] = Twide(block._mantissas[i]) * factor.mantissa();
+			lowest = std::min(lowest, products[i]);
+			highest = std::max(highest, products[i]);
+		}
+		return from_wide(products, lowest, highest,
+		                 std::intmax_t(block._exponent) + factor.exponent());
+	}
+
+	//! @returns The products of the values of `block` and `factor`.
+	friend constexpr BlockFloat operator*(const Tfloat &factor,
+	                                      const BlockFloat &block) noexcept {
+		return block * factor;
+	}
+
+	//! Adds the values of `other` to those of `this`.
+	constexpr BlockFloat &operator+=(const BlockFloat &other) noexcept {
+		return *this = *this + other;
+	}
+
+	//! Subtracts the values of `other` from those of `this`.
+	constexpr BlockFloat &operator-=(const BlockFloat &other) noexcept {
+		return *this = *this - other;
+	}
+
+	//! Multiplies the values of `this` by those of `other`.
+	constexpr BlockFloat &operator*=(const BlockFloat &other) noexcept {
+		return *this = *this * other;
+	}
+
+	//! Multiplies the values of `this` by `factor`.
+	constexpr BlockFloat &operator*=(const Tfloat &factor) noexcept {
+		return *this = *this * factor;
+	}
+};
+
+} // namespace fas
+#endif // FLOATING_POINT_BLOCK_HPP
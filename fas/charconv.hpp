@@ -0,0 +1,1106 @@
+#ifndef FLOATING_POINT_CHARCONV_HPP
+#define FLOATING_POINT_CHARCONV_HPP
+#include "fas/float.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace fas {
+namespace detail {
+
+//! An unsigned integer of up to `CAPACITY` limbs of 32 bits, which are stored
+//! in place, so no heap is needed.  An operation exceeding the capacity sets
+//! `overflow()` and leaves an unspecified value.
+template <std::size_t CAPACITY> class big_unsigned {
+	using limb_t = std::uint32_t;
+	using double_limb_t = std::uint64_t;
+	constexpr static int LIMB_BITS = 32;
+
+	//! The limbs, least significant first.  Only the first `_size` ones are
+	//! used and the last of them is never zero.
+	std::array<limb_t, CAPACITY> _limbs;
+
+	//! The number of limbs in use.
+	std::size_t _size = 0;
+
+	//! Whether an operation exceeded the capacity.
+	bool _overflow = false;
+
+	//! Drops leading zero limbs.
+	void trim() noexcept {
+		while (_size > 0 && _limbs[_size - 1] == 0) {
+			--_size;
+		}
+	}
+
+	//! Appends `limb` as the most significant limb.
+	void push(const limb_t limb) noexcept {
+		if (_size == CAPACITY) {
+			_overflow = true;
+		} else {
+			_limbs[_size++] = limb;
+		}
+	}
+
+public:
+	//! Creates a zero.
+	big_unsigned() noexcept {}
+
+	//! Creates the given value.
+	template <typename Tunsigned>
+	explicit big_unsigned(Tunsigned value) noexcept {
+		while (value != 0) {
+			push(static_cast<limb_t>(value));
+			if constexpr (sizeof(Tunsigned) > sizeof(limb_t)) {
+				value >>= LIMB_BITS;
+			} else {
+				value = 0;
+			}
+		}
+	}
+
+	//! Copies only the limbs in use.
+	big_unsigned(const big_unsigned &other) noexcept
+	    : _size(other._size), _overflow(other._overflow) {
+		std::copy(other._limbs.begin(), other._limbs.begin() + _size,
+		          _limbs.begin());
+	}
+
+	//! Copies only the limbs in use.
+	big_unsigned &operator=(const big_unsigned &other) noexcept {
+		_size = other._size;
+		_overflow = other._overflow;
+		std::copy(other._limbs.begin(), other._limbs.begin() + _size,
+		          _limbs.begin());
+		return *this;
+	}
+
+	//! @returns Whether an operation exceeded the capacity.
+	bool overflow() const noexcept { return _overflow; }
+
+	//! @returns Whether the value is zero.
+	bool is_zero() const noexcept { return _size == 0; }
+
+	//! @returns The number of binary digits of the value.
+	std::size_t bit_width() const noexcept {
+		return _size == 0 ? 0
+		                  : (_size - 1) * LIMB_BITS +
+		                        static_cast<std::size_t>(
+		                            detail::bit_width(_limbs[_size - 1]));
+	}
+
+	//! @returns The value converted to `Tunsigned`, which needs to hold it.
+	template <typename Tunsigned> Tunsigned to_integer() const noexcept {
+		Tunsigned result = 0;
+		for (auto i = _size; i-- > 0;) {
+			if constexpr (sizeof(Tunsigned) > sizeof(limb_t)) {
+				result <<= LIMB_BITS;
+			}
+			result |= static_cast<Tunsigned>(_limbs[i]);
+		}
+		return result;
+	}
+
+	//! Adds `addend`.
+	void add(const limb_t addend) noexcept {
+		double_limb_t carry = addend;
+		for (std::size_t i = 0; carry != 0 && i < _size; ++i) {
+			carry += _limbs[i];
+			_limbs[i] = static_cast<limb_t>(carry);
+			carry >>= LIMB_BITS;
+		}
+		if (carry != 0) {
+			push(static_cast<limb_t>(carry));
+		}
+	}
+
+	//! Subtracts `subtrahend`, which must not be larger.
+	void subtract(const big_unsigned &subtrahend) noexcept {
+		limb_t borrow = 0;
+		for (std::size_t i = 0; i < _size; ++i) {
+			const double_limb_t other =
+			    double_limb_t(i < subtrahend._size ? subtrahend._limbs[i] : 0) +
+			    borrow;
+			borrow = _limbs[i] < other;
+			_limbs[i] = static_cast<limb_t>(_limbs[i] - other);
+		}
+		trim();
+	}
+
+	//! Multiplies by `factor`.
+	void multiply(const limb_t factor) noexcept {
+		double_limb_t carry = 0;
+		for (std::size_t i = 0; i < _size; ++i) {
+			carry += double_limb_t(_limbs[i]) * factor;
+			_limbs[i] = static_cast<limb_t>(carry);
+			carry >>= LIMB_BITS;
+		}
+		if (carry != 0) {
+			push(static_cast<limb_t>(carry));
+		}
+		trim();
+	}
+
+	//! Multiplies by `factor`.
+	void multiply(const big_unsigned &factor) noexcept {
+		if (is_zero() || factor.is_zero()) {
+			_size = 0;
+			_overflow |= factor._overflow;
+			return;
+		}
+
+		big_unsigned product;
+		product._overflow = _overflow || factor._overflow;
+		product._size = _size + factor._size;
+		if (product._size > CAPACITY) {
+			_overflow = true;
+			return;
+		}
+		std::fill(product._limbs.begin(), product._limbs.begin() + product._size,
+		          limb_t(0));
+
+		for (std::size_t i = 0; i < _size; ++i) {
+			double_limb_t carry = 0;
+			for (std::size_t j = 0; j < factor._size; ++j) {
+				carry += double_limb_t(_limbs[i]) * factor._limbs[j] +
+				         product._limbs[i + j];
+				product._limbs[i + j] = static_cast<limb_t>(carry);
+				carry >>= LIMB_BITS;
+			}
+			product._limbs[i + factor._size] = static_cast<limb_t>(carry);
+		}
+		product.trim();
+		*this = product;
+	}
+
+	//! Multiplies by `2 ^ n`.
+	void shift_left(const std::size_t n) noexcept {
+		if (is_zero()) {
+			return;
+		}
+
+		const auto limbs = n / LIMB_BITS;
+		const auto bits = static_cast<int>(n % LIMB_BITS);
+		if (_size + limbs + 1 > CAPACITY) {
+			_overflow = true;
+			return;
+		}
+
+		_limbs[_size + limbs] = 0;
+		for (auto i = _size; i-- > 0;) {
+			const auto limb = _limbs[i];
+			if (bits != 0) {
+				_limbs[i + limbs + 1] |= limb >> (LIMB_BITS - bits);
+			}
+			_limbs[i + limbs] = static_cast<limb_t>(limb << bits);
+		}
+		std::fill(_limbs.begin(), _limbs.begin() + limbs, limb_t(0));
+		_size += limbs + 1;
+		trim();
+	}
+
+	//! Divides by `2`.
+	void halve() noexcept {
+		for (std::size_t i = 0; i < _size; ++i) {
+			_limbs[i] >>= 1;
+			if (i + 1 < _size) {
+				_limbs[i] |= static_cast<limb_t>(_limbs[i + 1] << (LIMB_BITS - 1));
+			}
+		}
+		trim();
+	}
+
+	//! Multiplies by `base ^ n`.
+	template <typename Tunsigned>
+	void multiply_power(const Tunsigned base, std::uintmax_t n) noexcept {
+		if ((base & (base - 1)) == 0) {
+			shift_left(n * static_cast<std::size_t>(detail::bit_width(base) - 1));
+			return;
+		}
+
+		if (base > std::numeric_limits<limb_t>::max()) {
+			const big_unsigned factor(base);
+			for (; n != 0 && !_overflow; --n) {
+				multiply(factor);
+			}
+			return;
+		}
+
+		// Multiplies by the largest power of `base` fitting a limb at once.
+		auto chunk = static_cast<limb_t>(base);
+		std::uintmax_t count = 1;
+		while (chunk <= std::numeric_limits<limb_t>::max() / base) {
+			chunk *= static_cast<limb_t>(base);
+			++count;
+		}
+		for (; n >= count && !_overflow; n -= count) {
+			multiply(chunk);
+		}
+		for (; n != 0; --n) {
+			multiply(static_cast<limb_t>(base));
+		}
+	}
+
+	//! Divides by `divisor`, which must not be zero, and replaces the value by
+	//! the remainder.  Takes time proportional to the quotient's digits, so it
+	//! is meant for small quotients.
+	//!
+	//! @returns The quotient.
+	big_unsigned divide(const big_unsigned &divisor) noexcept {
+		big_unsigned quotient;
+		if (compare(*this, divisor) < 0) {
+			return quotient;
+		}
+
+		auto shift = bit_width() - divisor.bit_width();
+		auto shifted = divisor;
+		shifted.shift_left(shift);
+		quotient._overflow = shifted._overflow;
+
+		for (++shift; shift-- > 0;) {
+			quotient.shift_left(1);
+			if (compare(*this, shifted) >= 0) {
+				subtract(shifted);
+				if (quotient.is_zero()) {
+					quotient.push(1);
+				} else {
+					quotient._limbs[0] |= 1;
+				}
+			}
+			shifted.halve();
+		}
+		return quotient;
+	}
+
+	//! @returns A negative value, zero or a positive value, if `first` is
+	//!          smaller, equal or larger than `second`.
+	friend int compare(const big_unsigned &first,
+	                   const big_unsigned &second) noexcept {
+		if (first._size != second._size) {
+			return first._size < second._size ? -1 : 1;
+		}
+		for (auto i = first._size; i-- > 0;) {
+			if (first._limbs[i] != second._limbs[i]) {
+				return first._limbs[i] < second._limbs[i] ? -1 : 1;
+			}
+		}
+		return 0;
+	}
+};
+
+//! An unsigned integer of the native type `Tunsigned` with the interface of
+//! `big_unsigned`, which is way faster for small intermediate results.
+template <typename Tunsigned> class native_unsigned {
+	Tunsigned _value = 0;
+
+	//! Whether an operation exceeded `Tunsigned`.
+	bool _overflow = false;
+
+public:
+	//! Creates a zero.
+	native_unsigned() noexcept {}
+
+	//! Creates the given value.
+	template <typename Tother>
+	explicit native_unsigned(const Tother value) noexcept
+	    : _value(static_cast<Tunsigned>(value)),
+	      _overflow(value > std::numeric_limits<Tunsigned>::max()) {}
+
+	//! @returns Whether an operation exceeded `Tunsigned`.
+	bool overflow() const noexcept { return _overflow; }
+
+	//! @returns Whether the value is zero.
+	bool is_zero() const noexcept { return _value == 0; }
+
+	//! Adds `addend`.
+	void add(const std::uint32_t addend) noexcept {
+		_overflow |= _value > std::numeric_limits<Tunsigned>::max() - addend;
+		_value += addend;
+	}
+
+	//! Subtracts `subtrahend`, which must not be larger.
+	void subtract(const native_unsigned &subtrahend) noexcept {
+		_value -= subtrahend._value;
+	}
+
+	//! Multiplies by `factor`.
+	void multiply(const std::uint32_t factor) noexcept {
+		_overflow |= _value > std::numeric_limits<Tunsigned>::max() / factor;
+		_value *= factor;
+	}
+
+	//! Multiplies by `base ^ n`.
+	template <typename Tbase>
+	void multiply_power(const Tbase base, std::uintmax_t n) noexcept {
+		for (; n != 0 && !_overflow; --n) {
+			_overflow |= base > std::numeric_limits<Tunsigned>::max() ||
+			             _value > std::numeric_limits<Tunsigned>::max() /
+			                          static_cast<Tunsigned>(base);
+			_value *= static_cast<Tunsigned>(base);
+		}
+	}
+
+	//! Divides by `divisor` and replaces the value by the remainder.  An
+	//! overflowed operand may have wrapped to zero, so the quotient overflows.
+	//!
+	//! @returns The quotient.
+	native_unsigned divide(const native_unsigned &divisor) noexcept {
+		native_unsigned quotient;
+		quotient._overflow = _overflow || divisor._overflow;
+		if (!quotient._overflow && divisor._value != 0) {
+			quotient._value = _value / divisor._value;
+			_value %= divisor._value;
+		}
+		return quotient;
+	}
+
+	//! @returns The value converted to `Tother`, which needs to hold it.
+	template <typename Tother> Tother to_integer() const noexcept {
+		return static_cast<Tother>(_value);
+	}
+
+	//! @returns A negative value, zero or a positive value, if `first` is
+	//!          smaller, equal or larger than `second`.
+	friend int compare(const native_unsigned &first,
+	                   const native_unsigned &second) noexcept {
+		return first._value < second._value ? -1 : (first._value > second._value);
+	}
+};
+
+//! The fractional binary digits of the logarithms estimating exponents, see
+//! `log2_fixed`.
+constexpr int LOG_FRACTION_BITS = 20;
+
+//! @returns `log2(value)` as a fixed point number of `LOG_FRACTION_BITS`
+//! fractional digits, truncated.  Like `Float::LOG2_BASE`, the fraction is
+//! calculated digit by digit, by squaring the 32 leading binary digits of
+//! `value`, so it takes no floating point arithmetic.
+//!
+//! @param value The value, needs to be `> 0`.
+//! @tparam Tunsigned An unsigned integer type.
+template <typename Tunsigned>
+constexpr std::int64_t exact_log2_fixed(const Tunsigned value) noexcept {
+	const int bits = bit_width(value) - 1;
+
+	// A fixed point number in `[1, 2)` of 31 fractional digits.
+	auto remaining = bits >= 31
+	                     ? static_cast<std::uint64_t>(value >> (bits - 31))
+	                     : static_cast<std::uint64_t>(value) << (31 - bits);
+	auto result = static_cast<std::int64_t>(bits) << LOG_FRACTION_BITS;
+	for (int digit = LOG_FRACTION_BITS - 1; digit >= 0; --digit) {
+		remaining = remaining * remaining >> 31;
+		if (remaining >> 32 != 0) {
+			remaining >>= 1;
+			result |= std::int64_t(1) << digit;
+		}
+	}
+	return result;
+}
+
+//! Holds `log2(1 + i / 64)` for `i` in `[0, 64]`, see `exact_log2_fixed`.
+struct log2_table {
+	constexpr static int INDEX_BITS = 6;
+	constexpr static std::array<std::int64_t, (1 << INDEX_BITS) + 1> values =
+	    [] {
+		    std::array<std::int64_t, (1 << INDEX_BITS) + 1> result{};
+		    for (std::size_t i = 0; i < result.size(); ++i) {
+			    result[i] = exact_log2_fixed((std::uint64_t(1) << INDEX_BITS) + i) -
+			                (std::int64_t(INDEX_BITS) << LOG_FRACTION_BITS);
+		    }
+		    return result;
+	    }();
+};
+
+//! @returns `log2(value)` as a fixed point number of `LOG_FRACTION_BITS`
+//! fractional digits, interpolated linearly between the entries of
+//! `log2_table`, which underestimates it by less than `2 ^ -14`.  This
+//! estimates decimal exponents without floating point arithmetic.
+//!
+//! @param value The value, needs to be `> 0`.
+//! @tparam Tunsigned An unsigned integer type.
+template <typename Tunsigned>
+constexpr std::int64_t log2_fixed(const Tunsigned value) noexcept {
+	constexpr int rest_bits = 31 - log2_table::INDEX_BITS;
+	const int bits = bit_width(value) - 1;
+
+	// The 31 binary digits below the leading one.
+	const auto fraction =
+	    (bits >= 31 ? static_cast<std::uint64_t>(value >> (bits - 31))
+	                : static_cast<std::uint64_t>(value) << (31 - bits)) -
+	    (std::uint64_t(1) << 31);
+	const auto index = static_cast<std::size_t>(fraction >> rest_bits);
+	const auto rest = static_cast<std::int64_t>(
+	    fraction & ((std::uint64_t(1) << rest_bits) - 1));
+
+	const auto low = log2_table::values[index];
+	const auto high = log2_table::values[index + 1];
+	return (static_cast<std::int64_t>(bits) << LOG_FRACTION_BITS) + low +
+	       ((high - low) * rest >> rest_bits);
+}
+
+//! @returns `floor(dividend / divisor)`, where `divisor` needs to be `> 0`.
+constexpr std::int64_t floor_divide(const std::int64_t dividend,
+                                    const std::int64_t divisor) noexcept {
+	const auto quotient = dividend / divisor;
+	return quotient - (dividend % divisor < 0 ? 1 : 0);
+}
+
+//! Writes the integer `value` in decimal like `std::to_chars` does.  Native
+//! integers are written without `std::to_chars`, which lacks 128 bit integers
+//! in strict ISO mode, see `is_integer`.  Others, such as `WideInt`, are
+//! written by the `to_chars` found by their namespace.
+//!
+//! @returns The end of the characters written and `std::errc()`, or `last`
+//!          and `std::errc::value_too_large`, if they do not fit.
+template <typename Tinteger>
+std::to_chars_result integer_to_chars(char *const first, char *const last,
+                                      const Tinteger &value) noexcept {
+	if constexpr (std::is_class<Tinteger>::value) {
+		return to_chars(first, last, value);
+	} else {
+		static_assert(is_integer<Tinteger>::value, "Needs an integer type.");
+		using Tunsigned = typename make_unsigned<Tinteger>::type;
+
+		// Negating in the unsigned domain also works for the lowest value.
+		const bool negative = value < 0;
+		auto magnitude = negative ? Tunsigned(0) - static_cast<Tunsigned>(value)
+		                          : static_cast<Tunsigned>(value);
+
+		// Each byte takes less than three decimal digits, besides the sign.
+		std::array<char, 3 * sizeof(Tunsigned) + 1> digits{};
+		auto *const end = digits.data() + digits.size();
+		auto *begin = end;
+		do {
+			*--begin = static_cast<char>('0' + magnitude % 10);
+			magnitude /= 10;
+		} while (magnitude != 0);
+		if (negative) {
+			*--begin = '-';
+		}
+
+		if (last - first < end - begin) {
+			return {last, std::errc::value_too_large};
+		}
+		return {std::copy(begin, end, first), std::errc()};
+	}
+}
+
+//! Converts `Tfloat` from and to decimal strings, see `fas::to_chars` and
+//! `fas::from_chars`.
+//!
+//! Either direction is carried out exactly using `big_unsigned`, whose
+//! capacity depends on the exponent's range.  For wide exponent types it gets
+//! limited, so values of extreme exponents fail to convert.
+template <typename Tfloat> class decimal {
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+	using Texponent = std::remove_cv_t<decltype(Tfloat::MAX().exponent())>;
+	using magnitude_t = detail::magnitude_t<Tmantissa>;
+
+	constexpr static auto BASE =
+	    static_cast<magnitude_t>(Tfloat::EXPONENT_BASE());
+	constexpr static std::intmax_t EXPONENT_LOWEST = Tfloat::MIN().exponent();
+	constexpr static std::intmax_t EXPONENT_MAX = Tfloat::MAX().exponent();
+
+	//! The magnitude of the largest positive mantissa.
+	constexpr static auto POSITIVE_LIMIT =
+	    static_cast<magnitude_t>(Tfloat::MAX().mantissa());
+
+	//! The magnitude of the smallest negative mantissa.
+	constexpr static magnitude_t NEGATIVE_LIMIT =
+	    Tfloat::LOWEST().mantissa() < 0
+	        ? magnitude_t(0) -
+	              static_cast<magnitude_t>(Tfloat::LOWEST().mantissa())
+	        : 0;
+
+	//! An upper bound of the binary digits of `BASE ^ e` for any exponent.
+	constexpr static std::size_t EXPONENT_BITS = [] {
+		constexpr std::uintmax_t lowest = EXPONENT_LOWEST < 0
+		                                      ? std::uintmax_t(0) -
+		                                            std::uintmax_t(EXPONENT_LOWEST)
+		                                      : std::uintmax_t(EXPONENT_LOWEST);
+		constexpr std::uintmax_t max = EXPONENT_MAX < 0
+		                                   ? std::uintmax_t(0) -
+		                                         std::uintmax_t(EXPONENT_MAX)
+		                                   : std::uintmax_t(EXPONENT_MAX);
+		constexpr std::uintmax_t limit = std::uintmax_t(1) << 20;
+		constexpr auto range = std::min(std::max(lowest, max), limit);
+		return static_cast<std::size_t>(range) *
+		       static_cast<std::size_t>(detail::bit_width(BASE));
+	}();
+
+	//! The number of binary digits of the mantissa.
+	constexpr static std::size_t MANTISSA_BITS = detail::digits<Tmantissa>;
+
+	//! `log2(BASE)` and `log2(10)`, see `exact_log2_fixed`.
+	constexpr static std::int64_t LOG2_BASE = exact_log2_fixed(BASE);
+	constexpr static std::int64_t LOG2_TEN = exact_log2_fixed(10u);
+
+	//! The logarithms of the limits, which are `0`, if there is no limit.
+	constexpr static std::int64_t LOG2_POSITIVE_LIMIT =
+	    POSITIVE_LIMIT != 0 ? exact_log2_fixed(POSITIVE_LIMIT) : 0;
+	constexpr static std::int64_t LOG2_NEGATIVE_LIMIT =
+	    NEGATIVE_LIMIT != 0 ? exact_log2_fixed(NEGATIVE_LIMIT) : 0;
+
+	//! Exponents beyond this limit exceed the capacity by far, so they are
+	//! not estimated.  Their logarithms fit `std::int64_t`.
+	constexpr static std::intmax_t ESTIMATE_LIMIT = std::intmax_t(1) << 32;
+
+public:
+	//! The number of significant digits `from_chars` takes into account.  Any
+	//! further digits only count by being not all zeros, which is exact unless
+	//! the number would be within those digits of a representable value.
+	constexpr static std::size_t MAX_DIGITS =
+	    std::min<std::size_t>(800, EXPONENT_BITS + MANTISSA_BITS + 2);
+
+	//! The number of limbs of the intermediate results.
+	constexpr static std::size_t CAPACITY = std::min<std::size_t>(
+	    4096,
+	    (2 * EXPONENT_BITS + 4 * MAX_DIGITS + 4 * MANTISSA_BITS + 256) / 32 + 1);
+
+	//! The largest number of significant digits `to_chars` writes.
+	constexpr static std::size_t SIGNIFICANT_DIGITS = MANTISSA_BITS * 3 / 10 + 4;
+
+	//! The largest number of characters `to_chars` writes: a sign, the
+	//! significant digits, a point, `e`, the exponent's sign and up to twenty
+	//! digits of the exponent.
+	constexpr static std::size_t MAX_CHARS = SIGNIFICANT_DIGITS + 24;
+
+private:
+	using big_t = big_unsigned<CAPACITY>;
+
+#if defined(__SIZEOF_INT128__)
+	using native_t = native_unsigned<unsigned __int128>;
+#else
+	using native_t = native_unsigned<std::uintmax_t>;
+#endif
+
+	//! Copies `text` to `[first, last)`.
+	static std::to_chars_result write(char *first, char *const last,
+	                                  const char *text) noexcept {
+		for (; *text != '\0'; ++text, ++first) {
+			if (first == last) {
+				return {last, std::errc::value_too_large};
+			}
+			*first = *text;
+		}
+		return {first, std::errc()};
+	}
+
+	//! @returns Whether `[first, last)` starts with `word`, ignoring the case,
+	//!          which needs to be lower case.
+	static bool starts_with(const char *first, const char *const last,
+	                        const char *word) noexcept {
+		for (; *word != '\0'; ++word, ++first) {
+			if (first == last || (*first | 0x20) != *word) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//! @returns The number of decimal digits of `value`.
+	static std::size_t digit_count(std::uintmax_t value) noexcept {
+		std::size_t result = 1;
+		for (; value >= 10; value /= 10) {
+			++result;
+		}
+		return result;
+	}
+
+	//! Divides `remainder` by `scale`, where the quotient needs to be `< 10`.
+	//!
+	//! @returns The quotient.
+	template <typename Tinteger>
+	static int next_digit(Tinteger &remainder, const Tinteger &scale) noexcept {
+		int result = 0;
+		for (; compare(remainder, scale) >= 0; ++result) {
+			remainder.subtract(scale);
+		}
+		return result;
+	}
+
+	//! Generates the shortest digits of a number, which truncates to
+	//! `magnitude * BASE ^ exponent`, using `Tinteger` for the intermediate
+	//! results.
+	//!
+	//! @param significant Receives the digits.
+	//! @param n Receives the number of digits.
+	//! @param k Receives the position of the last digit.
+	//! @returns Whether the intermediate results fit `Tinteger`.
+	template <typename Tinteger>
+	static bool shortest(const magnitude_t magnitude,
+	                     const std::intmax_t exponent,
+	                     std::array<char, SIGNIFICANT_DIGITS> &significant,
+	                     std::intmax_t &n, std::intmax_t &k) noexcept {
+		// Any number in [low, high) / denominator truncates to `value`.
+		Tinteger low(magnitude);
+		Tinteger high(magnitude);
+		high.add(1);
+		Tinteger denominator(1u);
+		if (exponent >= 0) {
+			low.multiply_power(BASE, static_cast<std::uintmax_t>(exponent));
+			high.multiply_power(BASE, static_cast<std::uintmax_t>(exponent));
+		} else {
+			denominator.multiply_power(BASE, static_cast<std::uintmax_t>(-exponent));
+		}
+		if (low.overflow() || high.overflow() || denominator.overflow()) {
+			return false;
+		}
+
+		// Scales the interval, so that `scale <= high < 10 * scale`.  `k` is the
+		// position of the next digit, estimated by `log10(magnitude)`.
+		if (exponent > ESTIMATE_LIMIT || exponent < -ESTIMATE_LIMIT) {
+			return false;
+		}
+		k = floor_divide(log2_fixed(magnitude) + exponent * LOG2_BASE, LOG2_TEN);
+		auto scale = denominator;
+		if (k >= 0) {
+			scale.multiply_power(10u, static_cast<std::uintmax_t>(k));
+		} else {
+			low.multiply_power(10u, static_cast<std::uintmax_t>(-k));
+			high.multiply_power(10u, static_cast<std::uintmax_t>(-k));
+		}
+		while (!high.overflow() && !scale.overflow()) {
+			auto tenfold = scale;
+			tenfold.multiply(10u);
+			if (compare(high, scale) < 0) {
+				low.multiply(10u);
+				high.multiply(10u);
+				--k;
+			} else if (compare(high, tenfold) >= 0) {
+				scale = tenfold;
+				++k;
+			} else {
+				break;
+			}
+		}
+
+		// Generates the digits of `low` up to the first position at which a
+		// number of `[low, high)` ends.  Once `high` is exactly the next larger
+		// prefix, its digits are all `0` and it is excluded.
+		n = 0;
+		bool high_exact = false;
+		for (;; --k) {
+			if (low.overflow() || high.overflow() || scale.overflow() ||
+			    n == static_cast<std::intmax_t>(significant.size())) {
+				return false;
+			}
+
+			const auto low_digit = next_digit(low, scale);
+			const auto rounded_up = low_digit + (low.is_zero() ? 0 : 1);
+			if (high_exact) {
+				if (rounded_up < 10) {
+					significant[n++] = static_cast<char>('0' + rounded_up);
+					break;
+				}
+			} else {
+				const auto high_digit = next_digit(high, scale);
+				if (low_digit == high_digit) {
+					if (low.is_zero()) {
+						significant[n++] = static_cast<char>('0' + low_digit);
+						break;
+					}
+				} else if (rounded_up < high_digit || !high.is_zero()) {
+					significant[n++] = static_cast<char>('0' + rounded_up);
+					break;
+				} else {
+					high_exact = true;
+				}
+			}
+
+			significant[n++] = static_cast<char>('0' + low_digit);
+			low.multiply(10u);
+			high.multiply(10u);
+		}
+		return true;
+	}
+
+	//! Calculates `magnitude * 10 ^ exponent10 / BASE ^ exponent`, truncated.
+	//!
+	//! @returns Whether the result fits the capacity.
+	template <typename Tinteger>
+	static bool scaled(const Tinteger &magnitude, const std::intmax_t exponent10,
+	                   const std::intmax_t exponent, Tinteger &result) noexcept {
+		auto numerator = magnitude;
+		Tinteger denominator(1u);
+		if (exponent10 >= 0) {
+			numerator.multiply_power(10u, static_cast<std::uintmax_t>(exponent10));
+		} else {
+			denominator.multiply_power(10u,
+			                           static_cast<std::uintmax_t>(-exponent10));
+		}
+		if (exponent >= 0) {
+			denominator.multiply_power(BASE, static_cast<std::uintmax_t>(exponent));
+		} else {
+			numerator.multiply_power(BASE, static_cast<std::uintmax_t>(-exponent));
+		}
+
+		result = numerator.divide(denominator);
+		return !numerator.overflow() && !denominator.overflow() &&
+		       !result.overflow();
+	}
+
+	//! @returns Whether `mantissa * BASE <= limit`.
+	template <typename Tinteger>
+	static bool can_grow(Tinteger mantissa, const Tinteger &limit) noexcept {
+		mantissa.multiply_power(BASE, 1);
+		return compare(mantissa, limit) <= 0;
+	}
+
+public:
+	//! See `fas::to_chars`.
+	static std::to_chars_result to_chars(char *first, char *const last,
+	                                     const Tfloat &value) noexcept {
+		switch (value.classify()) {
+		case classification::zero:
+			return write(first, last, "0");
+		case classification::inf:
+			return write(first, last, "inf");
+		case classification::negative_inf:
+			return write(first, last, "-inf");
+		case classification::not_a_number:
+			return write(first, last, "nan");
+		default:
+			break;
+		}
+
+		const auto mantissa = value.mantissa();
+		const bool negative = mantissa < 0;
+		auto magnitude = negative
+		                     ? magnitude_t(0) - static_cast<magnitude_t>(mantissa)
+		                     : static_cast<magnitude_t>(mantissa);
+
+		// Shrinking may leave mantissas which could grow by a digit, see
+		// `Float::from_magnitude`.  The exact value is the same.
+		const auto limit = negative ? NEGATIVE_LIMIT : POSITIVE_LIMIT;
+		auto exponent = static_cast<std::intmax_t>(value.exponent());
+		while (magnitude <= limit / BASE) {
+			magnitude *= BASE;
+			--exponent;
+		}
+
+		std::array<char, SIGNIFICANT_DIGITS> significant;
+		std::intmax_t n = 0;
+		std::intmax_t k = 0;
+		if (!shortest<native_t>(magnitude, exponent, significant, n, k) &&
+		    !shortest<big_t>(magnitude, exponent, significant, n, k)) {
+			return {last, std::errc::value_too_large};
+		}
+		const char *const digits = significant.data();
+
+		// Chooses the shorter one of the fixed and the scientific notation,
+		// preferring the fixed one.
+		const auto scientific_exponent = k + n - 1;
+		const auto exponent_magnitude =
+		    static_cast<std::uintmax_t>(scientific_exponent < 0
+		                                    ? -scientific_exponent
+		                                    : scientific_exponent);
+		const auto scientific_size =
+		    n + (n > 1 ? 1 : 0) + 2 +
+		    static_cast<std::intmax_t>(
+		        std::max<std::size_t>(2, digit_count(exponent_magnitude)));
+		const auto fixed_size = k >= 0 ? n + k : (n > -k ? n + 1 : 2 - k);
+
+		const auto size =
+		    (negative ? 1 : 0) + std::min(fixed_size, scientific_size);
+		if (size > last - first) {
+			return {last, std::errc::value_too_large};
+		}
+
+		if (negative) {
+			*first++ = '-';
+		}
+		if (fixed_size <= scientific_size) {
+			if (k >= 0) {
+				first = std::copy(digits, digits + n, first);
+				first = std::fill_n(first, k, '0');
+			} else if (n > -k) {
+				first = std::copy(digits, digits + n + k, first);
+				*first++ = '.';
+				first = std::copy(digits + n + k, digits + n, first);
+			} else {
+				*first++ = '0';
+				*first++ = '.';
+				first = std::fill_n(first, -k - n, '0');
+				first = std::copy(digits, digits + n, first);
+			}
+			return {first, std::errc()};
+		}
+
+		*first++ = digits[0];
+		if (n > 1) {
+			*first++ = '.';
+			first = std::copy(digits + 1, digits + n, first);
+		}
+		*first++ = 'e';
+		*first++ = scientific_exponent < 0 ? '-' : '+';
+		if (exponent_magnitude < 10) {
+			*first++ = '0';
+		}
+		return std::to_chars(first, last, exponent_magnitude);
+	}
+
+private:
+	//! See `fas::from_chars`, using `Tinteger` for the intermediate results.
+	//!
+	//! @returns `std::errc::value_too_large` if they do not fit `Tinteger`.
+	template <typename Tinteger>
+	static std::from_chars_result parse(const char *const first,
+	                                    const char *const last,
+	                                    Tfloat &value) noexcept {
+		const char *current = first;
+		const bool negative = current != last && *current == '-';
+		if (negative) {
+			++current;
+		}
+
+		if (starts_with(current, last, "inf")) {
+			current += starts_with(current, last, "infinity") ? 8 : 3;
+			value = negative ? Tfloat::NEGATIVE_INF() : Tfloat::INF();
+			return {current, std::errc()};
+		}
+		if (starts_with(current, last, "nan")) {
+			current += 3;
+			// Skips an optional `(n-char-sequence)`.
+			if (current != last && *current == '(') {
+				auto end = current + 1;
+				while (end != last &&
+				       (*end == '_' || (*end >= '0' && *end <= '9') ||
+				        ((*end | 0x20) >= 'a' && (*end | 0x20) <= 'z'))) {
+					++end;
+				}
+				if (end != last && *end == ')') {
+					current = end + 1;
+				}
+			}
+			value = Tfloat::NOT_A_NUMBER();
+			return {current, std::errc()};
+		}
+
+		// Collects the significant digits nine at a time.
+		Tinteger magnitude;
+		std::size_t kept = 0;
+		std::intmax_t exponent10 = 0;
+		std::uint32_t pending = 0;
+		std::uint32_t pending_power = 1;
+		std::uint64_t leading = 0;
+		int leading_digits = 0;
+		bool any_digit = false;
+		bool point = false;
+		for (; current != last; ++current) {
+			if (*current == '.' && !point) {
+				point = true;
+				continue;
+			}
+			if (*current < '0' || *current > '9') {
+				break;
+			}
+
+			any_digit = true;
+			const auto digit = static_cast<std::uint32_t>(*current - '0');
+			if (kept == 0 && digit == 0) {
+				exponent10 -= point ? 1 : 0;
+			} else if (kept < MAX_DIGITS) {
+				pending = pending * 10 + digit;
+				pending_power *= 10;
+				if (pending_power == 1000000000) {
+					magnitude.multiply(pending_power);
+					magnitude.add(pending);
+					pending = 0;
+					pending_power = 1;
+				}
+				if (leading_digits < 19) {
+					leading = leading * 10 + digit;
+					++leading_digits;
+				}
+				++kept;
+				exponent10 -= point ? 1 : 0;
+			} else {
+				exponent10 += point ? 0 : 1;
+			}
+		}
+		if (!any_digit) {
+			return {first, std::errc::invalid_argument};
+		}
+		magnitude.multiply(pending_power);
+		magnitude.add(pending);
+		if (magnitude.overflow()) {
+			return {first, std::errc::value_too_large};
+		}
+
+		// The exponent is only consumed if it has digits.
+		if (current != last && (*current | 0x20) == 'e') {
+			auto exponent_current = current + 1;
+			const bool exponent_negative =
+			    exponent_current != last && *exponent_current == '-';
+			if (exponent_current != last &&
+			    (*exponent_current == '-' || *exponent_current == '+')) {
+				++exponent_current;
+			}
+
+			constexpr std::intmax_t exponent_limit = std::intmax_t(1) << 40;
+			std::intmax_t exponent = 0;
+			auto digits = exponent_current;
+			for (; exponent_current != last && *exponent_current >= '0' &&
+			       *exponent_current <= '9';
+			     ++exponent_current) {
+				if (exponent < exponent_limit) {
+					exponent = exponent * 10 + (*exponent_current - '0');
+				}
+			}
+			if (exponent_current != digits) {
+				exponent10 += exponent_negative ? -exponent : exponent;
+				current = exponent_current;
+			}
+		}
+
+		if (magnitude.is_zero()) {
+			value = Tfloat::ZERO();
+			return {current, std::errc()};
+		}
+
+		const auto limit = negative ? NEGATIVE_LIMIT : POSITIVE_LIMIT;
+		if (limit == 0) {
+			return {current, std::errc::result_out_of_range};
+		}
+
+		// Estimates the exponent of the normalized mantissa, which is within
+		// `(limit / BASE, limit]`, by `log(number / limit) / log(BASE)` and
+		// corrects it exactly.  The number is `leading * 10 ^ shift`.
+		const auto shift =
+		    std::clamp(static_cast<std::intmax_t>(kept - leading_digits) +
+		                   exponent10,
+		               -ESTIMATE_LIMIT, ESTIMATE_LIMIT);
+		const auto log2_limit =
+		    negative ? LOG2_NEGATIVE_LIMIT : LOG2_POSITIVE_LIMIT;
+		const auto exponent_estimate = -floor_divide(
+		    log2_limit - log2_fixed(leading) - shift * LOG2_TEN, LOG2_BASE);
+		if (exponent_estimate - 1 > EXPONENT_MAX ||
+		    exponent_estimate + 1 < EXPONENT_LOWEST) {
+			return {current, std::errc::result_out_of_range};
+		}
+
+		const Tinteger limit_big(limit);
+		auto exponent = static_cast<std::intmax_t>(exponent_estimate);
+		Tinteger mantissa;
+		Tinteger next;
+		if (!scaled(magnitude, exponent10, exponent, mantissa)) {
+			return {current, std::errc::value_too_large};
+		}
+		for (;;) {
+			if (compare(mantissa, limit_big) > 0) {
+				if (!scaled(magnitude, exponent10, exponent + 1, next)) {
+					return {current, std::errc::value_too_large};
+				}
+				// Unless `limit + 1` is a power of `BASE`, there may be a gap
+				// between `limit * BASE ^ exponent` and the next exponent's values.
+				if (can_grow(next, limit_big)) {
+					mantissa = limit_big;
+					break;
+				}
+				++exponent;
+			} else if (can_grow(mantissa, limit_big)) {
+				if (!scaled(magnitude, exponent10, exponent - 1, next)) {
+					return {current, std::errc::value_too_large};
+				}
+				--exponent;
+				if (compare(next, limit_big) > 0) {
+					mantissa = limit_big;
+					break;
+				}
+			} else {
+				break;
+			}
+			mantissa = next;
+		}
+
+		if (exponent > EXPONENT_MAX || exponent < EXPONENT_LOWEST) {
+			return {current, std::errc::result_out_of_range};
+		}
+
+		const auto result = mantissa.template to_integer<magnitude_t>();
+		value = Tfloat(negative ? static_cast<Tmantissa>(
+		                              -static_cast<Tmantissa>(result - 1) - 1)
+		                        : static_cast<Tmantissa>(result),
+		               static_cast<Texponent>(exponent));
+		return {current, std::errc()};
+	}
+
+public:
+	//! See `fas::from_chars`.
+	static std::from_chars_result from_chars(const char *const first,
+	                                         const char *const last,
+	                                         Tfloat &value) noexcept {
+		// Most numbers fit native integers, all others are parsed again.
+		const auto result = parse<native_t>(first, last, value);
+		return result.ec == std::errc::value_too_large
+		           ? parse<big_t>(first, last, value)
+		           : result;
+	}
+};
+
+} // namespace detail
+
+//! The largest number of characters `to_chars` writes for a `Tfloat`.
+template <typename Tfloat>
+constexpr std::size_t max_chars = detail::decimal<Tfloat>::MAX_CHARS;
+
+//! Writes the shortest decimal representation of `value` to `[first, last)`,
+//! which `from_chars` parses back to `value`.  Like `std::to_chars`, the fixed
+//! notation is used, unless the scientific notation is shorter. Special values
+//! are written as `0`, `inf`, `-inf` and `nan`.  Neither the heap nor a locale
+//! is used.
+//!
+//! @returns The end of the written characters, or `last` and
+//!          `std::errc::value_too_large` if the buffer is too small.  At most
+//!          `max_chars<Float>` characters are needed.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+std::to_chars_result
+to_chars(char *first, char *last,
+         const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                     EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                     ON_OVERFLOW> &value) noexcept {
+	using float_t = Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+	                      MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+	                      ON_OVERFLOW>;
+	return detail::decimal<float_t>::to_chars(first, last, value);
+}
+
+//! Parses a decimal number from `[first, last)` like `std::from_chars` in the
+//! general format: An optional `-`, digits with an optional point, and an
+//! optional exponent, or `inf`, `infinity` and `nan` ignoring the case.  The
+//! number is truncated exactly to the next representable value towards zero,
+//! like the results of the operators.
+//!
+//! @param value Receives the parsed value.  It is left as it is, if an error
+//!              is returned.
+//! @returns The end of the parsed characters.  The error is
+//!          `std::errc::invalid_argument` if there is no number, and
+//!          `std::errc::result_out_of_range` if its magnitude is too large or
+//!          too small for `value`.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+std::from_chars_result
+from_chars(const char *first, const char *last,
+           Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                 EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                 ON_OVERFLOW> &value) noexcept {
+	using float_t = Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+	                      MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+	                      ON_OVERFLOW>;
+	return detail::decimal<float_t>::from_chars(first, last, value);
+}
+
+} // namespace fas
+#endif // FLOATING_POINT_CHARCONV_HPP
@@ -0,0 +1,550 @@
+#ifndef FLOATING_POINT_EXPRESSIONS_HPP
+#define FLOATING_POINT_EXPRESSIONS_HPP
+#include "fas/float.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace fas {
+namespace detail {
+
+//! Holds an intermediate result `mantissa * BASE ^ exponent` of an
+//! expression.  Its mantissa has the doubled width of the float's mantissa
+//! and its exponent is not bounded by the float's exponent, so products are
+//! exact and sums are truncated only below the doubled width.  Normalizing it
+//! into a `Tfloat` truncates it once, see `value()`.
+//!
+//! Special values, as well as floats without a wider integer type or
+//! without negative mantissas, are evaluated by the float's operators.
+//!
+//! @tparam Tfloat The `Float` type to evaluate.
+template <typename Tfloat> class unnormalized {
+	//! Reductions sum blocks of floats in fixed point.
+	template <typename Tother> friend struct reduction;
+
+	//! The float's mantissa type.
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+
+	//! The doubled width type, `void` if there is none.
+	using Twide = typename wider<Tmantissa>::type;
+
+	//! Whether intermediate results are held in the doubled width.
+	constexpr static bool IS_WIDE =
+	    !std::is_void<Twide>::value && Tfloat::LOWEST().mantissa() < 0;
+
+	//! The type holding the intermediate mantissa.
+	using Tstorage = std::conditional_t<IS_WIDE, Twide, Tmantissa>;
+
+	//! The type holding the intermediate mantissa's magnitude.
+	using Tunsigned = typename make_unsigned<Tstorage>::type;
+
+	//! The largest magnitude, whose sum with another one does not overflow.
+	constexpr static Tunsigned SUM_LIMIT = static_cast<Tunsigned>(-1) >> 2;
+
+	//! The largest magnitude, whose product with another one does not
+	//! overflow.
+	constexpr static Tunsigned FACTOR_LIMIT = Tunsigned(1)
+	                                          << ((digits<Tunsigned> - 1) / 2);
+
+	//! The intermediate mantissa, if `_pending`.
+	Tstorage _mantissa = 0;
+
+	//! The intermediate exponent, if `_pending`.
+	std::intmax_t _exponent = 0;
+
+	//! The value, if not `_pending`.
+	Tfloat _value = Tfloat();
+
+	//! Whether the value is held by `_mantissa` and `_exponent`.
+	bool _pending = false;
+
+	//! @returns The magnitude of the intermediate mantissa.
+	constexpr Tunsigned magnitude() const noexcept {
+		return _mantissa < 0 ? Tunsigned(0) - static_cast<Tunsigned>(_mantissa)
+		                     : static_cast<Tunsigned>(_mantissa);
+	}
+
+	//! Sets the intermediate mantissa from a magnitude and the current sign.
+	constexpr void set_magnitude(const Tunsigned magnitude) noexcept {
+		_mantissa = _mantissa < 0 ? -static_cast<Tstorage>(magnitude)
+		                          : static_cast<Tstorage>(magnitude);
+	}
+
+	//! Truncates the intermediate mantissa until its magnitude fits into
+	//! `limit`.
+	constexpr void reduce(const Tunsigned limit) noexcept {
+		auto target = magnitude();
+		if (target > limit) {
+			_exponent += Tfloat::shrink_digits(target, limit);
+			set_magnitude(target);
+		}
+	}
+
+	//! Shifts the intermediate mantissa by `n > 0` digits to the right.  If
+	//! digits get lost and `away` is set, its magnitude is incremented.  This
+	//! keeps the truncation of a sum exact, if the summands' signs differ.
+	constexpr void shift(const std::intmax_t n, const bool away) noexcept {
+		const auto target = magnitude();
+		Tunsigned result = 0;
+		bool lost = true;
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+			if (n < digits<Tunsigned> / Tfloat::BASE_BITS) {
+				result = target >> (n * Tfloat::BASE_BITS);
+				lost = (result << (n * Tfloat::BASE_BITS)) != target;
+			}
+		} else {
+			using table = powers<Tunsigned, Tfloat::EXPONENT_BASE()>;
+			if (n < static_cast<std::intmax_t>(table::values.size())) {
+				result = target / table::values[n];
+				lost = target % table::values[n] != 0;
+			}
+		}
+
+		set_magnitude(away && lost ? result + 1 : result);
+		_exponent += n;
+	}
+
+	//! Shifts the intermediate mantissa by at most `n` digits to the left,
+	//! keeping its magnitude within `SUM_LIMIT`.
+	//!
+	//! @returns The number of digits shifted.
+	constexpr std::intmax_t grow(const std::intmax_t n) noexcept {
+		const auto target = magnitude();
+		const std::intmax_t digits = Tfloat::grow_digits(target, SUM_LIMIT);
+		const auto result = digits < n ? digits : n;
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+			set_magnitude(target << (result * Tfloat::BASE_BITS));
+		} else {
+			set_magnitude(target *
+			              powers<Tunsigned, Tfloat::EXPONENT_BASE()>::values[result]);
+		}
+		_exponent -= result;
+		return result;
+	}
+
+	//! Holds `mantissa * BASE ^ exponent`, needs `IS_WIDE`.
+	constexpr unnormalized(const Tstorage mantissa,
+	                       const std::intmax_t exponent) noexcept
+	    : _mantissa(mantissa), _exponent(exponent), _pending(true) {}
+
+public:
+	//! Holds the given value.
+	constexpr explicit unnormalized(const Tfloat &value) noexcept {
+		if constexpr (IS_WIDE) {
+			const auto value_class = value.classify();
+			if (value_class == classification::finite ||
+			    value_class == classification::zero) {
+				_mantissa = value._mantissa;
+				_exponent = value_class == classification::zero ? 0 : value._exponent;
+				_pending = true;
+				return;
+			}
+		}
+		_value = value;
+	}
+
+	//! @returns The normalized value.
+	constexpr Tfloat value() const noexcept {
+		if constexpr (IS_WIDE) {
+			if (_pending) {
+				return Tfloat::from_integer(_mantissa, _exponent);
+			}
+		}
+		return _value;
+	}
+
+	//! @returns The negated operand.
+	constexpr unnormalized operator-() const noexcept {
+		if (!_pending) {
+			return unnormalized(-_value);
+		}
+
+		auto result = *this;
+		result._mantissa = -_mantissa;
+		return result;
+	}
+
+	//! @returns The sum of the given operands, shifting the summand with the
+	//! smaller exponent only as far as the other one can not grow.
+	constexpr friend unnormalized operator+(const unnormalized &first,
+	                                        const unnormalized &second) noexcept {
+		if (!first._pending || !second._pending) {
+			return unnormalized(first.value() + second.value());
+		}
+
+		if (first._mantissa == 0) {
+			return second;
+		}
+
+		if (second._mantissa == 0) {
+			return first;
+		}
+
+		auto reduced_first = first;
+		auto reduced_second = second;
+		reduced_first.reduce(SUM_LIMIT);
+		reduced_second.reduce(SUM_LIMIT);
+
+		const bool ordered = reduced_first._exponent >= reduced_second._exponent;
+		auto high = ordered ? reduced_first : reduced_second;
+		auto low = ordered ? reduced_second : reduced_first;
+
+		const auto remaining = high._exponent - low._exponent -
+		                       high.grow(high._exponent - low._exponent);
+		if (remaining > 0) {
+			low.shift(remaining, (high._mantissa < 0) != (low._mantissa < 0));
+		}
+
+		high._mantissa += low._mantissa;
+		return high;
+	}
+
+	//! @returns The difference of the given operands.
+	constexpr friend unnormalized
+	operator-(const unnormalized &minuend,
+	          const unnormalized &subtrahend) noexcept {
+		return minuend + -subtrahend;
+	}
+
+	//! @returns The product of the given operands.  Factors, which are
+	//! products themselves, may need to be truncated.
+	constexpr friend unnormalized operator*(const unnormalized &first,
+	                                        const unnormalized &second) noexcept {
+		if (!first._pending || !second._pending) {
+			return unnormalized(first.value() * second.value());
+		}
+
+		auto result = first;
+		auto factor = second;
+		result.reduce(FACTOR_LIMIT);
+		factor.reduce(FACTOR_LIMIT);
+
+		result._mantissa *= factor._mantissa;
+		result._exponent += factor._exponent;
+		return result;
+	}
+};
+
+//! An expression holding a single value.
+template <typename Tfloat> struct leaf {
+	Tfloat value;
+
+	constexpr auto evaluate() const noexcept {
+		return unnormalized<Tfloat>(value);
+	}
+};
+
+//! An expression adding two expressions.
+template <typename Tfirst, typename Tsecond> struct sum {
+	Tfirst first;
+	Tsecond second;
+
+	constexpr auto evaluate() const noexcept {
+		return first.evaluate() + second.evaluate();
+	}
+};
+
+//! An expression subtracting two expressions.
+template <typename Tfirst, typename Tsecond> struct difference {
+	Tfirst first;
+	Tsecond second;
+
+	constexpr auto evaluate() const noexcept {
+		return first.evaluate() - second.evaluate();
+	}
+};
+
+//! An expression multiplying two expressions.
+template <typename Tfirst, typename Tsecond> struct product {
+	Tfirst first;
+	Tsecond second;
+
+	constexpr auto evaluate() const noexcept {
+		return first.evaluate() * second.evaluate();
+	}
+};
+
+} // namespace detail
+
+//! Captures a chain of `+ - *` applied to floats of type `Tfloat`.  It gets
+//! evaluated, when it is converted to `Tfloat`.  Other than the float's
+//! operators, the intermediate results are not normalized, so the whole
+//! chain gets truncated once, see `detail::unnormalized`.
+//!
+//! @tparam Tfloat The `Float` type to evaluate.
+//! @tparam Tnode The expression's root node.
+template <typename Tfloat, typename Tnode> class expression {
+	//! The expression's root node.
+	Tnode _node;
+
+public:
+	//! Creates an expression from its root node.
+	constexpr explicit expression(const Tnode &node) noexcept : _node(node) {}
+
+	//! @returns The expression's root node.
+	constexpr const Tnode &node() const noexcept { return _node; }
+
+	//! @returns The evaluated and normalized expression.
+	constexpr Tfloat value() const noexcept { return _node.evaluate().value(); }
+
+	//! @returns The evaluated and normalized expression.
+	constexpr operator Tfloat() const noexcept { return value(); }
+};
+
+//! Holds a value of `Tfloat`, which is not normalized between operations.
+//! Like the intermediate results of an expression, its mantissa has the
+//! doubled width and its exponent is unbounded, so the normalizing loops of
+//! the float's operators are skipped, see `detail::unnormalized`.  The
+//! mantissa gets truncated only before it would overflow.
+//!
+//! The value gets normalized by `value()`, by comparisons, divisions and
+//! output.  Accumulating loops thus truncate their result once:
+//! ```
+//! fas::RawFloat<float_t> sum;
+//! for (std::size_t i = 0; i < count; ++i) {
+//! 	sum += values[i] * weights[i];
+//! }
+//! float_t result = sum.value();
+//! ```
+//!
+//! @tparam Tfloat The `Float` type to hold.
+template <typename Tfloat> class RawFloat {
+	//! The held value.
+	detail::unnormalized<Tfloat> _value;
+
+	//! Holds the given intermediate result.
+	constexpr explicit RawFloat(
+	    const detail::unnormalized<Tfloat> &value) noexcept
+	    : _value(value) {}
+
+public:
+	//! Holds zero.
+	constexpr RawFloat() noexcept : _value(Tfloat::ZERO()) {}
+
+	//! Holds the given value.
+	constexpr RawFloat(const Tfloat &value) noexcept : _value(value) {}
+
+	//! @returns The normalized value.
+	constexpr Tfloat value() const noexcept { return _value.value(); }
+
+	//! @returns The normalized value.
+	constexpr explicit operator Tfloat() const noexcept { return value(); }
+
+	//! @returns The negated value.
+	constexpr RawFloat operator-() const noexcept { return RawFloat(-_value); }
+
+	//! @returns The sum of the given operands.
+	constexpr friend RawFloat operator+(const RawFloat &first,
+	                                    const RawFloat &second) noexcept {
+		return RawFloat(first._value + second._value);
+	}
+
+	//! @returns The difference of the given operands.
+	constexpr friend RawFloat operator-(const RawFloat &minuend,
+	                                    const RawFloat &subtrahend) noexcept {
+		return RawFloat(minuend._value - subtrahend._value);
+	}
+
+	//! @returns The product of the given operands.
+	constexpr friend RawFloat operator*(const RawFloat &first,
+	                                    const RawFloat &second) noexcept {
+		return RawFloat(first._value * second._value);
+	}
+
+	//! @returns The quotient of the normalized operands.
+	constexpr friend RawFloat operator/(const RawFloat &dividend,
+	                                    const RawFloat &divisor) noexcept {
+		return RawFloat(dividend.value() / divisor.value());
+	}
+
+	//! Adds the given value.
+	constexpr RawFloat &operator+=(const RawFloat &summand) noexcept {
+		return *this = *this + summand;
+	}
+
+	//! Subtracts the given value.
+	constexpr RawFloat &operator-=(const RawFloat &subtrahend) noexcept {
+		return *this = *this - subtrahend;
+	}
+
+	//! Multiplies by the given value.
+	constexpr RawFloat &operator*=(const RawFloat &factor) noexcept {
+		return *this = *this * factor;
+	}
+
+	//! Divides by the given value.
+	constexpr RawFloat &operator/=(const RawFloat &divisor) noexcept {
+		return *this = *this / divisor;
+	}
+
+	//! Compares the normalized operands.
+	constexpr friend bool operator==(const RawFloat &first,
+	                                 const RawFloat &second) noexcept {
+		return first.value() == second.value();
+	}
+
+	//! Compares the normalized operands.
+	constexpr friend bool operator!=(const RawFloat &first,
+	                                 const RawFloat &second) noexcept {
+		return first.value() != second.value();
+	}
+
+	//! Compares the normalized operands.
+	constexpr friend bool operator<(const RawFloat &first,
+	                                const RawFloat &second) noexcept {
+		return first.value() < second.value();
+	}
+
+	//! Compares the normalized operands.
+	constexpr friend bool operator<=(const RawFloat &first,
+	                                 const RawFloat &second) noexcept {
+		return first.value() <= second.value();
+	}
+
+	//! Compares the normalized operands.
+	constexpr friend bool operator>(const RawFloat &first,
+	                                const RawFloat &second) noexcept {
+		return first.value() > second.value();
+	}
+
+	//! Compares the normalized operands.
+	constexpr friend bool operator>=(const RawFloat &first,
+	                                 const RawFloat &second) noexcept {
+		return first.value() >= second.value();
+	}
+
+	//! Prints the normalized value, see `fas/stream.hpp`.
+	template <typename Tstream>
+	friend decltype(auto) operator<<(Tstream &target, const RawFloat &source) {
+		return target << source.value();
+	}
+};
+
+//! @returns An expression holding the given value.  Combining it with other
+//! values by `+ - *` creates a larger expression.
+//!
+//! @param value The value to hold.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+constexpr auto
+expr(const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                 EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                 ON_OVERFLOW> &value) noexcept {
+	using Tfloat = Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+	                     MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+	                     ON_OVERFLOW>;
+	using Tnode = detail::leaf<Tfloat>;
+	return expression<Tfloat, Tnode>(Tnode{value});
+}
+
+//! @returns The given expression as it is.
+template <typename Tfloat, typename Tnode>
+constexpr auto expr(const expression<Tfloat, Tnode> &value) noexcept {
+	return value;
+}
+
+namespace detail {
+
+//! @returns The given operand as an expression.
+template <typename Tfloat, typename Toperand>
+constexpr auto as_expression(const Toperand &operand) noexcept {
+	return expr(Tfloat(operand));
+}
+
+//! @returns The given expression as it is.
+template <typename Tfloat, typename Tnode>
+constexpr auto
+as_expression(const expression<Tfloat, Tnode> &operand) noexcept {
+	return operand;
+}
+
+//! Whether `T` is an expression.
+template <typename T> struct is_expression : std::false_type {};
+
+template <typename Tfloat, typename Tnode>
+struct is_expression<expression<Tfloat, Tnode>> : std::true_type {};
+
+//! Creates the expression `Tnode<first, second>`.
+template <template <typename, typename> class Tnode, typename Tfloat,
+          typename Tfirst, typename Tsecond>
+constexpr auto combine(const Tfirst &first, const Tsecond &second) noexcept {
+	const auto first_expression = as_expression<Tfloat>(first);
+	const auto second_expression = as_expression<Tfloat>(second);
+	using Tresult = Tnode<std::decay_t<decltype(first_expression.node())>,
+	                      std::decay_t<decltype(second_expression.node())>>;
+	return expression<Tfloat, Tresult>(
+	    Tresult{first_expression.node(), second_expression.node()});
+}
+
+} // namespace detail
+
+//! @returns The expression adding the given operands.
+template <typename Tfloat, typename Tnode, typename Tsummand>
+constexpr auto operator+(const expression<Tfloat, Tnode> &first,
+                         const Tsummand &second) noexcept {
+	return detail::combine<detail::sum, Tfloat>(first, second);
+}
+
+//! @returns The expression adding the given operands.
+template <typename Tsummand, typename Tfloat, typename Tnode,
+          typename = std::enable_if_t<!detail::is_expression<Tsummand>::value>>
+constexpr auto operator+(const Tsummand &first,
+                         const expression<Tfloat, Tnode> &second) noexcept {
+	return detail::combine<detail::sum, Tfloat>(first, second);
+}
+
+//! @returns The expression subtracting the given operands.
+template <typename Tfloat, typename Tnode, typename Tsubtrahend>
+constexpr auto operator-(const expression<Tfloat, Tnode> &minuend,
+                         const Tsubtrahend &subtrahend) noexcept {
+	return detail::combine<detail::difference, Tfloat>(minuend, subtrahend);
+}
+
+//! @returns The expression subtracting the given operands.
+template <typename Tminuend, typename Tfloat, typename Tnode,
+          typename = std::enable_if_t<!detail::is_expression<Tminuend>::value>>
+constexpr auto operator-(const Tminuend &minuend,
+                         const expression<Tfloat, Tnode> &subtrahend) noexcept {
+	return detail::combine<detail::difference, Tfloat>(minuend, subtrahend);
+}
+
+//! @returns The expression multiplying the given operands.
+template <typename Tfloat, typename Tnode, typename Tfactor>
+constexpr auto operator*(const expression<Tfloat, Tnode> &first,
+                         const Tfactor &second) noexcept {
+	return detail::combine<detail::product, Tfloat>(first, second);
+}
+
+//! @returns The expression multiplying the given operands.
+template <typename Tfactor, typename Tfloat, typename Tnode,
+          typename = std::enable_if_t<!detail::is_expression<Tfactor>::value>>
+constexpr auto operator*(const Tfactor &first,
+                         const expression<Tfloat, Tnode> &second) noexcept {
+	return detail::combine<detail::product, Tfloat>(first, second);
+}
+
+//! Returns the fused multiply-add `first * second + summand`.  Other than
+//! multiplying and adding with the float's operators, the result is
+//! truncated once.
+//!
+//! @param first The first factor.
+//! @param second The second factor.
+//! @param summand The value to add to the product.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+constexpr auto
+fma(const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING, ON_OVERFLOW> &first,
+    const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING, ON_OVERFLOW> &second,
+    const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                ON_OVERFLOW> &summand) noexcept {
+	return (expr(first) * second + summand).value();
+}
+} // namespace fas
+#endif // FLOATING_POINT_EXPRESSIONS_HPP
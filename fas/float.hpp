@@ -2,11 +2,448 @@
 #ifndef FLOATING_POINT_HPP
 #define FLOATING_POINT_HPP
 
+#include "fas/stats.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <type_traits>
 
+//! Defining `FAS_FREESTANDING` selects the freestanding configuration for
+//! targets without a floating point unit:  The conversions from and to
+//! `float` and `double` are omitted, so any operation takes only integer
+//! arithmetic, including the decimal conversions of `fas/charconv.hpp`.
+//! Floats are constructed of integers and exponents or parsed from strings.
+
 namespace fas {
 
+//! An integer of `LIMBS` limbs of 64 bits, see `fas/wide.hpp`.
+template <std::size_t LIMBS, bool SIGNED = true> struct WideInt;
+
+namespace detail {
+
+//! @returns The number of binary digits needed to represent `value`.
+//!
+//! @param value The unsigned value to measure.
+//! @tparam Tunsigned The value's type. Types wider than `unsigned long long`,
+//!         such as `unsigned __int128`, are split into two halves.
+template <typename Tunsigned> constexpr int bit_width(Tunsigned value) noexcept {
+	constexpr int long_digits = std::numeric_limits<unsigned long long>::digits;
+
+	if constexpr (sizeof(Tunsigned) > sizeof(unsigned long long)) {
+		const auto high = static_cast<unsigned long long>(value >> long_digits);
+		return high ? long_digits + bit_width(high)
+		            : bit_width(static_cast<unsigned long long>(value));
+	} else {
+#if defined(__GNUC__) || defined(__clang__)
+		return value ? long_digits - __builtin_clzll(value) : 0;
+#else
+		int result = 0;
+		for (; value != 0; value >>= 1) {
+			++result;
+		}
+		return result;
+#endif
+	}
+}
+
+//! @returns The number of binary digits needed to represent `value`, see
+//! `fas/wide.hpp`.
+template <std::size_t LIMBS, bool SIGNED>
+constexpr int bit_width(const WideInt<LIMBS, SIGNED> &value) noexcept;
+
+//! @returns The number of powers `BASE ^ k` representable by `Tunsigned`,
+//! including `BASE ^ 0`.
+template <typename Tunsigned, Tunsigned BASE>
+constexpr std::size_t power_count() noexcept {
+	std::size_t result = 1;
+	for (Tunsigned power = 1; power <= static_cast<Tunsigned>(-1) / BASE;
+	     power *= BASE) {
+		++result;
+	}
+	return result;
+}
+
+//! Holds all powers `BASE ^ k` which are representable by `Tunsigned`.
+//!
+//! @tparam Tunsigned The unsigned type of the powers.
+//! @tparam BASE The base to raise, needs to be `> 1`.
+template <typename Tunsigned, Tunsigned BASE> struct powers {
+	//! The powers, `values[k] == BASE ^ k`.
+	constexpr static std::array<Tunsigned, power_count<Tunsigned, BASE>()>
+	    values = [] {
+		    std::array<Tunsigned, power_count<Tunsigned, BASE>()> result{};
+		    result[0] = 1;
+		    for (std::size_t i = 1; i < result.size(); ++i) {
+			    result[i] = result[i - 1] * BASE;
+		    }
+		    return result;
+	    }();
+
+	//! @returns The largest `k` for which `BASE ^ k <= limit`.
+	//!
+	//! @param limit The upper bound, needs to be `>= 1`.
+	constexpr static int largest_not_above(Tunsigned limit) noexcept {
+		std::size_t low = 0;
+		std::size_t high = values.size();
+		while (high - low > 1) {
+			const auto middle = low + (high - low) / 2;
+			if (values[middle] <= limit) {
+				low = middle;
+			} else {
+				high = middle;
+			}
+		}
+		return static_cast<int>(low);
+	}
+};
+
+//! Whether `T` is an integer type.  Other than `std::is_integral`, this also
+//! holds for 128 bit integers in strict ISO mode.
+template <typename T> struct is_integer : std::is_integral<T> {};
+
+//! Provides the unsigned type of the same width as `Tinteger`.  Other than
+//! `std::make_unsigned`, this also supports 128 bit integers in strict ISO
+//! mode.
+template <typename Tinteger> struct make_unsigned {
+	using type = std::make_unsigned_t<Tinteger>;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <> struct is_integer<__int128> : std::true_type {};
+template <> struct is_integer<unsigned __int128> : std::true_type {};
+
+template <> struct make_unsigned<__int128> {
+	using type = unsigned __int128;
+};
+
+template <> struct make_unsigned<unsigned __int128> {
+	using type = unsigned __int128;
+};
+#endif
+
+//! An unsigned type able to hold the magnitude of any `Tinteger`.
+template <typename Tinteger>
+using magnitude_t =
+    std::conditional_t<(sizeof(Tinteger) > sizeof(std::uintmax_t)),
+                       typename make_unsigned<Tinteger>::type, std::uintmax_t>;
+
+//! The number of binary digits of `Tunsigned`.
+template <typename Tunsigned>
+constexpr int digits = static_cast<int>(sizeof(Tunsigned)) * 8;
+
+//! Provides the smallest integer type `type` holding the product of any two
+//! values of `Tinteger`.  It is `void` if there is no such type.
+template <typename Tinteger, typename = void> struct wider {
+	using type = void;
+};
+
+//! Integers of up to 32 bits are multiplied in their doubled width.
+template <typename Tinteger>
+struct wider<Tinteger, std::enable_if_t<std::is_integral<Tinteger>::value &&
+                                        (sizeof(Tinteger) <= 4)>> {
+	using type = std::conditional_t<
+	    std::is_signed<Tinteger>::value,
+	    std::conditional_t<(sizeof(Tinteger) <= 2), std::int32_t, std::int64_t>,
+	    std::conditional_t<(sizeof(Tinteger) <= 2), std::uint32_t,
+	                       std::uint64_t>>;
+};
+
+#if defined(__SIZEOF_INT128__)
+//! 64 bit integers are multiplied using the 128 bit integers available on gcc
+//! and clang.
+template <typename Tinteger>
+struct wider<Tinteger, std::enable_if_t<std::is_integral<Tinteger>::value &&
+                                        sizeof(Tinteger) == 8>> {
+	using type = std::conditional_t<std::is_signed<Tinteger>::value, __int128,
+	                                unsigned __int128>;
+};
+#endif
+
+//! Provides the smallest unsigned integer type `type` of at least `BITS`
+//! binary digits.  It is `void` if there is no such type.
+template <int BITS> struct least_unsigned {
+	using type = std::conditional_t<
+	    (BITS <= 8), std::uint8_t,
+	    std::conditional_t<
+	        (BITS <= 16), std::uint16_t,
+	        std::conditional_t<
+	            (BITS <= 32), std::uint32_t,
+	            std::conditional_t<
+	                (BITS <= 64), std::uint64_t,
+	                std::conditional_t<(BITS <= 128),
+	                                   typename wider<std::uint64_t>::type,
+	                                   void>>>>>;
+};
+
+//! Describes the IEEE-754 binary format of `Tvalue`, whose bits are `Tbits`.
+template <typename Tvalue, typename Tbits> struct ieee754_format {
+	//! Whether `Tvalue` is stored in the format.
+	constexpr static bool value = std::numeric_limits<Tvalue>::is_iec559 &&
+	                              sizeof(Tvalue) == sizeof(Tbits);
+
+	using bits_t = Tbits;
+
+	//! The digits of the significand, including the implicit one.
+	constexpr static int DIGITS = std::numeric_limits<Tvalue>::digits;
+
+	//! The value of the largest biased exponent, which is used by infinities
+	//! and NaNs.
+	constexpr static int MAX_BIASED = (1 << (digits<Tbits> - DIGITS)) - 1;
+
+	//! The exponent of the lowest significand digit of subnormal values, which
+	//! equals the one of values with a biased exponent of `1`.
+	constexpr static int LOWEST =
+	    std::numeric_limits<Tvalue>::min_exponent - DIGITS;
+
+	//! @returns The bits of `value`.
+	constexpr static Tbits to_bits(const Tvalue value) noexcept {
+		return __builtin_bit_cast(Tbits, value);
+	}
+
+	//! @returns The value of the given `bits`.
+	constexpr static Tvalue from_bits(const Tbits bits) noexcept {
+		return __builtin_bit_cast(Tvalue, bits);
+	}
+};
+
+//! Provides the IEEE-754 binary format of `Tvalue`, if its bits can be read
+//! in constant expressions.  `value` is `false` otherwise.
+template <typename Tvalue> struct ieee754 {
+	constexpr static bool value = false;
+};
+
+// `std::bit_cast` needs C++20, while the builtin behind it is available to
+// C++17 on gcc and clang.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_bit_cast)
+template <> struct ieee754<float> : ieee754_format<float, std::uint32_t> {};
+
+template <> struct ieee754<double> : ieee754_format<double, std::uint64_t> {};
+#endif
+#endif
+
+//! The part `numerator / denominator` of a magnitude's last digit, which
+//! has been dropped, with `numerator < denominator`.
+template <typename Tunsigned> struct fraction {
+	Tunsigned numerator = 0;
+	Tunsigned denominator = 1;
+};
+
+//! @returns The state of the calling thread's generator for stochastic
+//! rounding.
+inline std::uint64_t &stochastic_state() noexcept {
+	thread_local std::uint64_t state = 0;
+	return state;
+}
+
+//! @returns 64 random bits of the calling thread's generator, a splitmix64,
+//! which passes the common statistical tests while taking only a few
+//! multiplications.
+inline std::uint64_t stochastic_bits() noexcept {
+	auto bits = (stochastic_state() += 0x9e3779b97f4a7c15);
+	bits = (bits ^ (bits >> 30)) * 0xbf58476d1ce4e5b9;
+	bits = (bits ^ (bits >> 27)) * 0x94d049bb133111eb;
+	return bits ^ (bits >> 31);
+}
+
+//! @returns A random value in `[0, bound)`.  For bounds, which are no powers
+//! of two, the lower values are slightly more likely.
+template <typename Tunsigned>
+inline Tunsigned stochastic_below(const Tunsigned bound) noexcept {
+	auto bits = static_cast<Tunsigned>(stochastic_bits());
+	if constexpr (sizeof(Tunsigned) > sizeof(std::uint64_t)) {
+		bits = bits << 64 | stochastic_bits();
+	}
+	return bits % bound;
+}
+
+//! An intermediate result of an expression, see `fas/expr.hpp`.
+template <typename Tfloat> class unnormalized;
+
+//! Converts floats from and to their packed format, see `fas/packed.hpp`.
+template <typename Tfloat> struct packing;
+
+//! Evaluates sums, dot products and norms, see `fas/reduce.hpp`.
+template <typename Tfloat> struct reduction;
+
+//! Evaluates elementary functions, see `fas/math.hpp`.
+template <typename Tfloat> struct elementary;
+
+//! Indexes the tables of operations by mantissa and exponent, see
+//! `fas/table.hpp`.
+template <typename Tfloat> struct tabulation;
+
+} // namespace detail
+
+//! The modes of rounding results, which are not representable.
+//!
+//! - `truncate` rounds towards zero, which takes no further work.
+//! - `nearest_even` rounds to the nearest value, ties to an even mantissa.
+//! - `stochastic` rounds up or down at random, with the probabilities of the
+//!   distances to the other value, so the rounding errors cancel on average.
+//! - `upward` rounds towards positive infinity.
+//! - `downward` rounds towards negative infinity.
+enum class rounding : std::uint8_t {
+	truncate,
+	nearest_even,
+	stochastic,
+	upward,
+	downward
+};
+
+//! The ways of handling special values and results out of range.
+//!
+//! - `infinity` turns results out of range into infinities or zero, and
+//!   propagates infinities and not a numbers.
+//! - `unchecked` drops these checks from the operators, which compile to
+//!   plain integer code.  Operands need to be finite and results in range,
+//!   which is asserted unless `NDEBUG` is defined.  Zeros are still handled.
+//!   This needs a type of the doubled mantissa width, the operators of other
+//!   floats stay checked.
+//! - `saturate` clamps results out of range to `MAX()` or `LOWEST()` instead,
+//!   which takes no branch, and tiny results to zero.  Like `unchecked`, the
+//!   operators do not check for special values, since operations of finite
+//!   values result in none:  Dividing by zero saturates too, zero divided by
+//!   zero is zero, and native infinities convert to `MAX()` or `LOWEST()`.
+//!   Operands need to be finite, which is asserted unless `NDEBUG` is
+//!   defined.  The operators of floats without a type of the doubled mantissa
+//!   width stay checked, but saturate as well.
+enum class overflow : std::uint8_t { infinity, unchecked, saturate };
+
+//! Seeds the calling thread's generator for `rounding::stochastic`, which
+//! starts with the seed `0` on each thread.
+//!
+//! @param seed The seed, any value is fine.
+inline void seed_stochastic_rounding(const std::uint64_t seed) noexcept {
+	detail::stochastic_state() = seed;
+}
+
+//! Represents a floating point number, see below.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+class Float;
+
+namespace detail {
+
+//! Whether `T` is an instantiation of `Float`.
+template <typename T> struct is_float : std::false_type {};
+
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+struct is_float<Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+                      MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                      ON_OVERFLOW>>
+    : std::true_type {};
+
+//! Provides the `Float` type `type`, which equals `Tfloat`, but rounds by
+//! `ROUNDING`.
+template <typename Tfloat, rounding ROUNDING> struct with_rounding;
+
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding FLOAT_ROUNDING, overflow ON_OVERFLOW, rounding ROUNDING>
+struct with_rounding<Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+                           MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+                           FLOAT_ROUNDING, ON_OVERFLOW>,
+                     ROUNDING> {
+	using type = Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+	                   EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING, ON_OVERFLOW>;
+};
+
+//! Provides the `Float` type `type`, which equals `Tfloat`, but handles
+//! overflows by `ON_OVERFLOW`.
+template <typename Tfloat, overflow ON_OVERFLOW> struct with_overflow;
+
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow FLOAT_ON_OVERFLOW, overflow ON_OVERFLOW>
+struct with_overflow<Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+                           MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+                           ROUNDING, FLOAT_ON_OVERFLOW>,
+                     ON_OVERFLOW> {
+	using type = Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+	                   EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING, ON_OVERFLOW>;
+};
+
+//! @returns The number of binary digits of the mantissas of the `Float`
+//! type `Tfloat`.
+template <typename Tfloat> constexpr int mantissa_digits() noexcept {
+	const auto max = Tfloat::MAX().mantissa();
+	const auto lowest = Tfloat::LOWEST().mantissa();
+	using Tmagnitude = magnitude_t<std::remove_cv_t<decltype(max)>>;
+	return std::max(bit_width(static_cast<Tmagnitude>(max)),
+	                bit_width(Tmagnitude(0) - static_cast<Tmagnitude>(lowest)));
+}
+
+//! @returns The number of exponents of the `Float` type `Tfloat`.
+template <typename Tfloat> constexpr std::intmax_t exponents() noexcept {
+	return static_cast<std::intmax_t>(Tfloat::MAX().exponent()) -
+	       Tfloat::MIN().exponent();
+}
+
+//! Provides the `Float` type `type`, which operations of `Tfirst` and
+//! `Tsecond` promote to: The one with more mantissa digits, or if both have
+//! as many, the one with more exponents.  Both need to have the same BASE.
+template <typename Tfirst, typename Tsecond> struct promoted {
+	static_assert(Tfirst::EXPONENT_BASE() == Tsecond::EXPONENT_BASE(),
+	              "Operations of floats need the same BASE.");
+
+	using type = std::conditional_t<
+	    (mantissa_digits<Tsecond>() > mantissa_digits<Tfirst>() ||
+	     (mantissa_digits<Tsecond>() == mantissa_digits<Tfirst>() &&
+	      exponents<Tsecond>() > exponents<Tfirst>())),
+	    Tsecond, Tfirst>;
+};
+
+} // namespace detail
+
+//! The `Float` type `Tfloat`, which rounds by `ROUNDING` instead, for example
+//! `rounded<Float<int16_t, int8_t>, rounding::nearest_even>`.
+template <typename Tfloat, rounding ROUNDING>
+using rounded = typename detail::with_rounding<Tfloat, ROUNDING>::type;
+
+//! The `Float` type `Tfloat`, which handles overflows by `ON_OVERFLOW`
+//! instead, for example
+//! `overflowing<Float<int16_t, int8_t>, overflow::unchecked>`.
+template <typename Tfloat, overflow ON_OVERFLOW>
+using overflowing = typename detail::with_overflow<Tfloat, ON_OVERFLOW>::type;
+
+//! The `Float` type `Tfloat`, which does not check its operands and results,
+//! see `overflow::unchecked`.
+template <typename Tfloat>
+using unchecked = overflowing<Tfloat, overflow::unchecked>;
+
+//! The `Float` type `Tfloat`, whose results saturate instead of becoming
+//! infinite, see `overflow::saturate`.
+template <typename Tfloat>
+using saturating = overflowing<Tfloat, overflow::saturate>;
+
+//! A container storing floats as structure of arrays, see `fas/vector.hpp`.
+template <typename Tfloat> class FloatVector;
+
+//! Sums floats exactly, see `fas/accumulator.hpp`.
+template <typename Tfloat> class Accumulator;
+
+//! The classes of values a `Float` distinguishes, see `Float::classify()`.
+enum class classification : std::uint8_t {
+	finite,
+	zero,
+	inf,
+	negative_inf,
+	not_a_number
+};
+
 //! Represents a floating point number using a mantissa and an exponent.
 //!
 //! @tparam Tmantissa The type used to store the mantissa.
@@ -24,15 +461,43 @@ namespace fas {
 //!         The default: `std::numeric_limits<Texponent>::lowest()`.
 //! @tparam EXPONENT_MAX The exponent's highest value possible.
 //!         The default: `std::numeric_limits<Texponent>::max()`.
+//! @tparam ROUNDING How results, which are not representable, are rounded.
+//!         The default: `rounding::truncate`.
+//! @tparam ON_OVERFLOW How special values and results out of range are
+//!         handled.  The default: `overflow::infinity`.
 template <typename Tmantissa, typename Texponent, Tmantissa BASE = 2,
           Tmantissa MANTISSA_LOWEST = std::numeric_limits<Tmantissa>::lowest(),
           Tmantissa MANTISSA_MAX = std::numeric_limits<Tmantissa>::max(),
           Texponent EXPONENT_LOWEST = std::numeric_limits<Texponent>::lowest(),
-          Texponent EXPONENT_MAX = std::numeric_limits<Texponent>::max()>
+          Texponent EXPONENT_MAX = std::numeric_limits<Texponent>::max(),
+          rounding ROUNDING = rounding::truncate,
+          overflow ON_OVERFLOW = overflow::infinity>
 class Float {
 	//! The type of `this`.
-	using self_t = Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
-	                     MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX>;
+	using self_t =
+	    Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+	          EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING, ON_OVERFLOW>;
+
+	//! Expressions normalize their intermediate results only once.
+	template <typename Tfloat> friend class detail::unnormalized;
+
+	//! Containers store the mantissas and exponents separately.
+	template <typename Tfloat> friend class FloatVector;
+
+	//! The accumulator shifts the mantissas by the exponents' bits.
+	template <typename Tfloat> friend class Accumulator;
+
+	//! The packed format stores the mantissa and the exponent bit by bit.
+	template <typename Tfloat> friend struct detail::packing;
+
+	//! Reductions read the mantissas and exponents of arrays.
+	template <typename Tfloat> friend struct detail::reduction;
+
+	//! Elementary functions take the mantissa apart, such as its square root.
+	template <typename Tfloat> friend struct detail::elementary;
+
+	//! Tables are indexed by the mantissas and the exponents.
+	template <typename Tfloat> friend struct detail::tabulation;
 
 	//! Specifies the mantissa.
 	Tmantissa _mantissa = 0;
@@ -57,14 +522,784 @@ class Float {
 
 		return result;
 	}
-	//! Calculates target * BASE ^ (-1*n)
+	//! Whether BASE is a power of two, so digits can be shifted instead of
+	//! multiplied or divided.
+	constexpr static bool BASE_IS_POWER_OF_TWO =
+	    BASE > 1 && (BASE & (BASE - 1)) == 0;
+
+	//! Whether sums are aligned exactly in the doubled mantissa width and
+	//! rounded once by ROUNDING, which includes truncating, see
+	//! `rounded_sum`.  Otherwise the aligned mantissas get truncated before
+	//! they are added.
+	constexpr static bool ROUNDS_SUMS =
+	    !std::is_void<typename detail::wider<Tmantissa>::type>::value;
+
+	//! Whether results out of range saturate, see `overflow::saturate`.
+	constexpr static bool SATURATES = ON_OVERFLOW == overflow::saturate;
+
+	//! Whether the operators skip the checks for special values, see
+	//! `overflow::unchecked` and `overflow::saturate`.  Results out of range
+	//! are not checked either, unless they saturate.
+	constexpr static bool UNCHECKED =
+	    (ON_OVERFLOW == overflow::unchecked || SATURATES) &&
+	    !std::is_void<typename detail::wider<Tmantissa>::type>::value;
+
+	//! The number of binary digits a single digit of BASE occupies, only
+	//! meaningful if BASE is a power of two.
+	constexpr static int BASE_BITS =
+	    detail::bit_width(static_cast<std::uintmax_t>(BASE)) - 1;
+
+	//! The binary logarithm of BASE.  Its fraction is calculated digit by
+	//! digit, by squaring.
+	constexpr static double LOG2_BASE = [] {
+		double result = BASE_BITS;
+		double remaining =
+		    static_cast<double>(BASE) / static_cast<double>(std::uintmax_t(1)
+		                                                    << BASE_BITS);
+		for (double digit = 0.5; digit != 0 && remaining != 1; digit /= 2) {
+			remaining *= remaining;
+			if (remaining >= 2) {
+				remaining /= 2;
+				result += digit;
+			}
+		}
+		return result;
+	}();
+
+	//! An unsigned type able to hold the magnitude of any mantissa.
+	using magnitude_t = detail::magnitude_t<Tmantissa>;
+
+	//! @returns The magnitude of the given mantissa.
+	constexpr static magnitude_t magnitude_of(const Tmantissa target) noexcept {
+		// Negating in the unsigned domain also works for the lowest value.
+		return target < 0 ? magnitude_t(0) - static_cast<magnitude_t>(target)
+		                  : static_cast<magnitude_t>(target);
+	}
+
+	//! The number of binary digits of the mantissas' magnitudes.
+	constexpr static int MAGNITUDE_BITS =
+	    detail::bit_width(std::max(magnitude_of(MANTISSA_MAX),
+	                               magnitude_of(MANTISSA_LOWEST)));
+
+	//! The number of binary digits of the finite values' distances from the
+	//! key of zero, see `sort_key`: The exponent above the mantissa's
+	//! magnitude.
+	constexpr static int DISTANCE_BITS =
+	    detail::bit_width(static_cast<std::uintmax_t>(EXPONENT_MAX) -
+	                      static_cast<std::uintmax_t>(EXPONENT_LOWEST)) +
+	    MAGNITUDE_BITS;
+
+	//! Calculates target * BASE ^ (-1*n) using a single shift or division,
+	//! truncating the digits shifted out.
+	//!
+	//! @param target The mantissa to shift.
+	//! @param n The number of digits to shift, nothing is shifted if `n <= 0`.
+	//!        It is taken wider than the exponent, since the difference of two
+	//!        exponents does not fit their type.
 	constexpr static inline Tmantissa
-	power_negative(Tmantissa target, const Texponent &n) noexcept {
-		for (Texponent i = 0; i < n; ++i) {
-			target /= BASE;
+	power_negative(Tmantissa target, const std::intmax_t n) noexcept {
+		if (n <= 0 || target == 0) {
+			return target;
 		}
 
-		return target;
+		auto magnitude = magnitude_of(target);
+		if constexpr (BASE_IS_POWER_OF_TWO) {
+			magnitude = n < detail::digits<magnitude_t> / BASE_BITS
+			                ? magnitude >> static_cast<int>(n * BASE_BITS)
+			                : 0;
+		} else {
+			using table = detail::powers<magnitude_t, BASE>;
+			// Powers beyond the table are larger than any mantissa.
+			magnitude = static_cast<std::size_t>(n) < table::values.size()
+			                ? magnitude / table::values[n]
+			                : 0;
+		}
+
+		// Shifting by at least one digit, the magnitude fits in both directions.
+		return target < 0 ? static_cast<Tmantissa>(-static_cast<Tmantissa>(magnitude))
+		                  : static_cast<Tmantissa>(magnitude);
+	}
+
+	//! Holds the powers `BASE ^ k` for every exponent `k` of this type.
+	//!
+	//! @tparam Tvalue The floating point type of the powers.
+	//! @tparam SIZE The number of powers, by default covering the magnitude of
+	//!         every exponent.
+	template <typename Tvalue,
+	          std::size_t SIZE =
+	              static_cast<std::size_t>(std::max(
+	                  {std::intmax_t(0), -std::intmax_t(EXPONENT_LOWEST),
+	                   std::intmax_t(EXPONENT_MAX)})) +
+	              1>
+	struct scales {
+		//! The number of powers.
+		constexpr static std::size_t size = SIZE;
+
+		//! The powers, `powers[k] == BASE ^ k`.
+		constexpr static std::array<Tvalue, size> powers = [] {
+			std::array<Tvalue, size> result{};
+			result[0] = 1;
+
+			// Overflowing is no constant expression, so powers saturate explicitly.
+			for (std::size_t i = 1; i < size; ++i) {
+				result[i] = result[i - 1] <= std::numeric_limits<Tvalue>::max() / BASE
+				                ? result[i - 1] * BASE
+				                : std::numeric_limits<Tvalue>::infinity();
+			}
+			return result;
+		}();
+
+		//! The reciprocal powers, `reciprocals[k] == BASE ^ -k`.  These are only
+		//! exact if BASE is a power of two.
+		constexpr static std::array<Tvalue, size> reciprocals = [] {
+			std::array<Tvalue, size> result{};
+			result[0] = 1;
+			for (std::size_t i = 1; i < size; ++i) {
+				result[i] = result[i - 1] / BASE;
+			}
+			return result;
+		}();
+	};
+
+	//! @returns The number of powers `BASE ^ k` representable by `Tvalue`,
+	//!          including `BASE ^ 0`.
+	template <typename Tvalue>
+	constexpr static std::size_t finite_scale_count() noexcept {
+		std::size_t result = 1;
+		for (Tvalue power = 1; power <= std::numeric_limits<Tvalue>::max() / BASE;
+		     power *= BASE) {
+			++result;
+		}
+		return result;
+	}
+
+	//! The largest number of exponents for which `scales` are tabulated.
+	constexpr static std::intmax_t SCALES_TABLE_SIZE = 0x200;
+
+	//! Whether `scale` uses the tabulated `scales`.
+	constexpr static bool SCALES_TABULATED =
+	    static_cast<std::intmax_t>(EXPONENT_MAX) - EXPONENT_LOWEST <
+	    SCALES_TABLE_SIZE;
+
+	//! Calculates value * BASE ^ exponent.  Small exponent types use a single
+	//! multiplication (or division) by a tabulated power, others one per binary
+	//! digit of the exponent.
+	//!
+	//! @param value The value to scale.
+	//! @param exponent The exponent to scale by, which may exceed `Texponent`
+	//!        as long as its magnitude does not exceed the one of any exponent.
+	//! @tparam Tvalue A floating point type.
+	template <typename Tvalue>
+	constexpr static Tvalue scale(Tvalue value,
+	                              const std::intmax_t exponent) noexcept {
+		if constexpr (SCALES_TABULATED) {
+			if (exponent >= 0) {
+				return value * scales<Tvalue>::powers[exponent];
+			}
+
+			// Dividing by an exact power rounds better than multiplying by an
+			// inexact reciprocal.
+			if constexpr (BASE_IS_POWER_OF_TWO) {
+				return value * scales<Tvalue>::reciprocals[-exponent];
+			} else {
+				return value / scales<Tvalue>::powers[-exponent];
+			}
+		} else {
+			const bool negative = exponent < 0;
+			auto remaining = negative ? 0 - static_cast<std::uintmax_t>(exponent)
+			                          : static_cast<std::uintmax_t>(exponent);
+
+			// Scales progressively, so the value saturates no earlier than it
+			// would do digit by digit.
+			Tvalue power = BASE;
+			while (remaining != 0) {
+				if (remaining & 1) {
+					value = negative ? value / power : value * power;
+				}
+				remaining >>= 1;
+
+				if (power > std::numeric_limits<Tvalue>::max() / power) {
+					// The next power is not representable, so the remaining ones are
+					// applied one by one, until the value saturates.
+					constexpr auto max = std::numeric_limits<Tvalue>::max();
+					for (remaining *= 2; remaining != 0 && value != 0 &&
+					                     value <= max && value >= -max;
+					     --remaining) {
+						value = negative ? value / power : value * power;
+					}
+					break;
+				}
+				power *= power;
+			}
+			return value;
+		}
+	}
+
+	//! @returns The largest `k` for which `magnitude * BASE ^ k <= limit`.
+	//!
+	//! @param magnitude The magnitude to grow, needs to be in `(0, limit]`.
+	//! @param limit The largest magnitude allowed.
+	template <typename Tunsigned>
+	constexpr static int grow_digits(const Tunsigned magnitude,
+	                                 const Tunsigned limit) noexcept {
+		if constexpr (BASE_IS_POWER_OF_TWO) {
+			auto digits = (detail::bit_width(limit) - detail::bit_width(magnitude)) /
+			              BASE_BITS;
+			if (static_cast<Tunsigned>(magnitude << (digits * BASE_BITS)) > limit) {
+				--digits;
+			}
+			return digits;
+		} else {
+			return detail::powers<Tunsigned, BASE>::largest_not_above(limit /
+			                                                          magnitude);
+		}
+	}
+
+	//! Divides `magnitude` by the smallest power of BASE, which makes it fit
+	//! into `limit`.
+	//!
+	//! @param magnitude The magnitude to shrink, needs to be `> limit`.
+	//! @param limit The largest magnitude allowed, needs to be `> 0`.
+	//! @returns The number of digits `magnitude` has been shrunk by.
+	template <typename Tunsigned>
+	constexpr static int shrink_digits(Tunsigned &magnitude,
+	                                   const Tunsigned limit) noexcept {
+		if constexpr (BASE_IS_POWER_OF_TWO) {
+			constexpr int max_shift = detail::digits<Tunsigned>;
+			auto digits = (detail::bit_width(magnitude) - detail::bit_width(limit) +
+			               BASE_BITS - 1) /
+			              BASE_BITS;
+			if (digits * BASE_BITS < max_shift &&
+			    (magnitude >> (digits * BASE_BITS)) > limit) {
+				++digits;
+			}
+			magnitude = digits * BASE_BITS < max_shift
+			                ? magnitude >> (digits * BASE_BITS)
+			                : 0;
+			return digits;
+		} else {
+			using table = detail::powers<Tunsigned, BASE>;
+			constexpr auto last = table::values.size() - 1;
+
+			// Digits beyond the largest power are removed in chunks, since integer
+			// divisions compose:  (m / a) / b == m / (a * b).
+			int digits = 0;
+			while (magnitude / table::values[last] > limit) {
+				magnitude /= table::values[last];
+				digits += static_cast<int>(last);
+			}
+
+			// Smallest k, for which `magnitude / BASE ^ k <= limit`, which is the
+			// same as `magnitude / (limit + 1) < BASE ^ k`.
+			const auto k = table::largest_not_above(magnitude / (limit + 1)) + 1;
+			magnitude /= table::values[k];
+			return digits + k;
+		}
+	}
+
+	//! @returns `BASE ^ digits`, which needs to be representable by
+	//! `Tunsigned`.
+	template <typename Tunsigned>
+	constexpr static Tunsigned power_of(int digits) noexcept {
+		if constexpr (BASE_IS_POWER_OF_TWO) {
+			return Tunsigned(1) << (digits * BASE_BITS);
+		} else {
+			using table = detail::powers<Tunsigned, BASE>;
+			constexpr auto last = static_cast<int>(table::values.size()) - 1;
+
+			Tunsigned result = 1;
+			for (; digits > last; digits -= last) {
+				result *= table::values[last];
+			}
+			return result * table::values[digits];
+		}
+	}
+
+	//! Decides by ROUNDING, whether the magnitude `truncated` rounds up.  Its
+	//! exact value is `truncated + (dropped + below) / divisor`, that is
+	//! `dropped` out of `divisor` have been dropped from the digit above
+	//! `truncated`'s last one and `below` of the next lower one.
+	//!
+	//! @param truncated The magnitude truncated towards zero.
+	//! @param negative Whether the value is negative.
+	//! @param dropped The dropped digits, needs to be `< divisor`.
+	//! @param divisor The power of BASE, which has been divided by.
+	//! @param below The fraction of the digit below the dropped ones.
+	template <typename Tunsigned>
+	constexpr static bool
+	rounds_up(const Tunsigned truncated, const bool negative,
+	          const Tunsigned dropped, const Tunsigned divisor,
+	          const detail::fraction<Tunsigned> &below) noexcept {
+		const bool inexact = dropped != 0 || below.numerator != 0;
+
+		if constexpr (ROUNDING == rounding::upward) {
+			return inexact && !negative;
+		} else if constexpr (ROUNDING == rounding::downward) {
+			return inexact && negative;
+		} else if constexpr (ROUNDING == rounding::stochastic) {
+			if (!inexact) {
+				return false;
+			}
+
+			// Rounds up with the probability `(dropped + below) / divisor`.
+			const auto random = detail::stochastic_below(divisor);
+			return random < dropped ||
+			       (random == dropped && below.numerator != 0 &&
+			        detail::stochastic_below(below.denominator) < below.numerator);
+		} else if constexpr (ROUNDING == rounding::nearest_even) {
+			// Compares `dropped + below` to `rest - below`, which is the same as
+			// comparing it to the half of `divisor`, but does not overflow.
+			const auto rest = divisor - dropped;
+			int order = -1;
+			if (dropped > rest) {
+				order = 1;
+			} else if (dropped == rest) {
+				order = below.numerator != 0;
+			} else if (dropped + 1 == rest) {
+				// Compares `below` to a half.
+				const auto other = below.denominator - below.numerator;
+				order = (below.numerator > other) - (below.numerator < other);
+			}
+			return order > 0 || (order == 0 && (truncated & 1) != 0);
+		} else {
+			return false;
+		}
+	}
+
+	//! Decides by ROUNDING, whether the magnitude `limit`, which `rounds_up`,
+	//! rounds up to the next larger magnitude `(limit / BASE + 1) * BASE`.
+	//! Unless it equals `limit + 1`, the gap is larger than one, which the
+	//! dropped digits do not exceed.
+	template <typename Tunsigned>
+	constexpr static bool rounds_beyond(const Tunsigned limit) noexcept {
+		const auto gap = (limit / BASE + 1) * BASE - limit;
+
+		if constexpr (ROUNDING == rounding::nearest_even) {
+			return gap == 1;
+		} else if constexpr (ROUNDING == rounding::stochastic) {
+			// Scales the probability down by the gap.
+			return gap == 1 || detail::stochastic_below(gap) == 0;
+		} else {
+			return true;
+		}
+	}
+
+	//! Creates a normalized instance from a magnitude and a sign in a constant
+	//! number of steps, instead of shifting it digit by digit.  Produces the
+	//! same result as the generic version of `normalize`.  The magnitude gets
+	//! rounded by ROUNDING.
+	//!
+	//! @param magnitude The value's magnitude.
+	//! @param negative Whether the value is negative.
+	//! @param exponent The value's exponent, which may exceed `Texponent` as
+	//!        long as the normalized exponent does not.
+	//! @param below The fraction of the magnitude's last digit, which has been
+	//!        dropped already.  Unless it is zero, the magnitude needs to be
+	//!        `> limit / BASE`, so it does not need to grow.
+	//! @tparam Tunsigned The magnitude's type, needs to be an unsigned integer
+	//!         type at least as wide as `Tmantissa`.
+	template <typename Tunsigned>
+	constexpr static self_t
+	from_magnitude(Tunsigned magnitude, const bool negative,
+	               std::intmax_t exponent,
+	               const detail::fraction<Tunsigned> &below = {}) noexcept {
+		if (magnitude == 0) {
+			return ZERO();
+		}
+
+		const auto limit = negative
+		                       ? Tunsigned(0) - static_cast<Tunsigned>(MANTISSA_LOWEST)
+		                       : static_cast<Tunsigned>(MANTISSA_MAX);
+
+		// The digits dropped by shrinking, `dropped / divisor` of the last one.
+		Tunsigned dropped = 0;
+		Tunsigned divisor = 1;
+		// Whether the magnitude has been rounded already.
+		bool rounded = false;
+
+		if (magnitude <= limit) {
+			const auto digits = grow_digits(magnitude, limit);
+			if constexpr (BASE_IS_POWER_OF_TWO) {
+				magnitude <<= digits * BASE_BITS;
+			} else {
+				magnitude *= detail::powers<Tunsigned, BASE>::values[digits];
+			}
+			exponent -= digits;
+		} else {
+			const auto exact = magnitude;
+			const auto digits = shrink_digits(magnitude, limit);
+			exponent += digits;
+
+			// Shrinking drops all digits only if the magnitude exceeds `Tunsigned`
+			// by far, which never happens.
+			if constexpr (ROUNDING != rounding::truncate) {
+				if (magnitude != 0) {
+					divisor = power_of<Tunsigned>(digits);
+					dropped = exact - magnitude * divisor;
+				}
+			}
+
+			// Unless `limit + 1` is a power of BASE, the shrunk magnitude may take
+			// another digit, as the rounded one may not, see `rounds_beyond`.  Then
+			// the value lies between `limit * BASE ^ (exponent - 1)` and
+			// `(magnitude + 1) * BASE ^ exponent`, which it rounds to.  Below the
+			// lowest exponent the former underflows.
+			if (magnitude <= limit / BASE) {
+				if constexpr (ROUNDING != rounding::truncate) {
+					const auto above =
+					    exact - limit * (divisor / static_cast<Tunsigned>(BASE));
+					rounded = rounds_up(limit, negative, above,
+					                    divisor - dropped + above, below);
+				}
+				if (rounded) {
+					++magnitude;
+				} else {
+					magnitude = limit;
+					--exponent;
+					rounded = true;
+				}
+			}
+		}
+
+		if constexpr (ROUNDING != rounding::truncate) {
+			if (!rounded && rounds_up(magnitude, negative, dropped, divisor, below)) {
+				if (magnitude < limit) {
+					++magnitude;
+				} else if (rounds_beyond(limit)) {
+					// The next larger magnitude takes another digit.
+					return from_magnitude(limit / BASE + 1, negative, exponent + 1);
+				}
+			}
+		}
+
+		if constexpr (SATURATES) {
+			// Clamps instead of branching:  Tiny results become zero, large ones
+			// the largest magnitude of their sign.
+			const bool tiny = exponent < EXPONENT_LOWEST;
+			const bool large = exponent > EXPONENT_MAX;
+			stats::count(stats::event::underflow, tiny);
+			stats::count(stats::event::overflow, large);
+			magnitude = large ? limit : magnitude;
+			magnitude = tiny ? Tunsigned(0) : magnitude;
+			exponent = tiny ? 0 : std::min<std::intmax_t>(exponent, EXPONENT_MAX);
+		} else if constexpr (UNCHECKED) {
+			assert(exponent >= EXPONENT_LOWEST && exponent <= EXPONENT_MAX);
+		} else {
+			if (exponent < EXPONENT_LOWEST) {
+				return underflowed();
+			}
+
+			if (exponent > EXPONENT_MAX) {
+				return overflowed(negative);
+			}
+		}
+
+		// Avoids overflowing, when the magnitude equals `-MANTISSA_LOWEST`.
+		return of(negative ? static_cast<Tmantissa>(
+		                         -static_cast<Tmantissa>(magnitude - 1) - 1)
+		                   : static_cast<Tmantissa>(magnitude),
+		          static_cast<Texponent>(exponent));
+	}
+
+	//! Creates a normalized instance from an integer value, see
+	//! `from_magnitude`.
+	//!
+	//! @param value The value to normalize.
+	//! @param exponent The value's exponent, which may exceed `Texponent`.
+	//! @tparam Tvalue The value's type, needs to be an integer type.
+	template <typename Tvalue>
+	constexpr static self_t from_integer(const Tvalue value,
+	                                     const std::intmax_t exponent) noexcept {
+		using Tunsigned = detail::magnitude_t<Tvalue>;
+
+		// Negating in the unsigned domain also works for the lowest value.
+		const bool negative = value < 0;
+		return from_magnitude(negative
+		                          ? Tunsigned(0) - static_cast<Tunsigned>(value)
+		                          : static_cast<Tunsigned>(value),
+		                      negative, exponent);
+	}
+
+	//! Creates a normalized instance from the magnitude of a floating point
+	//! value, truncated towards zero, see `from_ieee754`.  The magnitude gets
+	//! scaled by a power estimated from its binary exponent and then by at most
+	//! a few digits.  Unless BASE is a power of two, scaling may round.
+	//!
+	//! @param magnitude The magnitude, needs to be finite and `> 0`.
+	//! @param negative Whether the value is negative.
+	//! @param binary_exponent The exponent of the magnitude's highest binary
+	//!        digit.
+	//! @tparam Tvalue A floating point type.
+	template <typename Tvalue>
+	constexpr static self_t from_floating(const Tvalue magnitude,
+	                                      const bool negative,
+	                                      const int binary_exponent) noexcept {
+		const auto limit =
+		    negative ? magnitude_t(0) - static_cast<magnitude_t>(MANTISSA_LOWEST)
+		             : static_cast<magnitude_t>(MANTISSA_MAX);
+
+		// Scaled magnitudes below the bound truncate to at most `limit`.
+		const auto bound = static_cast<Tvalue>(limit) + 1;
+
+		// Estimated from the magnitude's upper bound, the exponent is rather
+		// too large than too small, since growing takes no division.  The
+		// logarithm is a fixed point number of 32 fractional digits, which is
+		// rounded up by negating it twice.
+		constexpr auto reciprocal =
+		    static_cast<std::intmax_t>(4294967296.0 / LOG2_BASE) + 1;
+		auto exponent = -((static_cast<std::intmax_t>(detail::bit_width(limit)) -
+		                   binary_exponent - 1) *
+		                      reciprocal >>
+		                  32);
+
+		// The estimate is off by at most two digits.
+		if (exponent > static_cast<std::intmax_t>(EXPONENT_MAX) + 2) {
+			return overflowed(negative);
+		}
+		if (exponent < static_cast<std::intmax_t>(EXPONENT_LOWEST) - 2) {
+			return underflowed();
+		}
+		exponent = std::clamp<std::intmax_t>(exponent, EXPONENT_LOWEST,
+		                                     EXPONENT_MAX);
+
+		// Only the finite powers and the first infinite one are tabulated.
+		using table =
+		    scales<Tvalue, std::min(scales<Tvalue>::size,
+		                            finite_scale_count<Tvalue>() + 1)>;
+		const auto power = [](const std::intmax_t k) {
+			return table::powers[std::min(static_cast<std::size_t>(k),
+			                              table::size - 1)];
+		};
+
+		// Powers saturate, even if the scaled magnitude does not.  Scaling in
+		// halves keeps them finite then.
+		const auto digits = exponent < 0 ? -exponent : exponent;
+		auto scaled = magnitude;
+		auto factor = power(digits);
+		if (!(factor < std::numeric_limits<Tvalue>::infinity())) {
+			const auto half = power(digits / 2);
+			scaled = exponent < 0 ? scaled * half : scaled / half;
+			factor = power(digits - digits / 2);
+		}
+
+		// Dividing by an exact power rounds better than multiplying by an
+		// inexact reciprocal.
+		scaled = exponent < 0 ? scaled * factor : scaled / factor;
+		while (scaled >= bound) {
+			if (exponent == EXPONENT_MAX) {
+				return overflowed(negative);
+			}
+			++exponent;
+			scaled /= BASE;
+		}
+		while (scaled * BASE < bound) {
+			if (exponent == EXPONENT_LOWEST) {
+				return underflowed();
+			}
+			--exponent;
+			scaled *= BASE;
+		}
+
+		// Converting to signed integers takes a single instruction on most
+		// platforms.
+		using Tinteger =
+		    std::conditional_t<(sizeof(Tmantissa) < sizeof(std::intmax_t)),
+		                       std::intmax_t, magnitude_t>;
+		auto result = std::min(
+		    static_cast<magnitude_t>(static_cast<Tinteger>(scaled)), limit);
+
+		// Unless `limit + 1` is a power of BASE, the truncated magnitude may take
+		// another digit, though not a whole one, see `from_magnitude`.
+		if (result <= limit / static_cast<magnitude_t>(BASE)) {
+			if (exponent == EXPONENT_LOWEST) {
+				return underflowed();
+			}
+			result = limit;
+			--exponent;
+		}
+		return of(negative ? static_cast<Tmantissa>(
+		                         -static_cast<Tmantissa>(result - 1) - 1)
+		                   : static_cast<Tmantissa>(result),
+		          static_cast<Texponent>(exponent));
+	}
+
+	//! Creates a normalized instance from a value of an IEEE-754 binary format,
+	//! truncated towards zero.  Other than `normalize`, which scales the value
+	//! digit by digit, this takes a constant number of steps.  The result is
+	//! exact if BASE is a power of two.
+	//!
+	//! @param value The value to convert.
+	//! @tparam Tvalue A floating point type, for which `detail::ieee754` holds.
+	template <typename Tvalue>
+	constexpr static self_t from_ieee754(const Tvalue value) noexcept {
+		using format = detail::ieee754<Tvalue>;
+		using bits_t = typename format::bits_t;
+
+		const auto bits = format::to_bits(value);
+		const bool negative = (bits >> (detail::digits<bits_t> - 1)) != 0;
+		const auto biased = static_cast<int>((bits >> (format::DIGITS - 1)) &
+		                                     format::MAX_BIASED);
+		auto significand = bits & ((bits_t(1) << (format::DIGITS - 1)) - 1);
+
+		if (biased == format::MAX_BIASED) {
+			if (significand != 0) {
+				return NOT_A_NUMBER();
+			}
+			if constexpr (SATURATES) {
+				return negative ? LOWEST() : MAX();
+			}
+			return negative ? NEGATIVE_INF() : INF();
+		}
+
+		// Subnormal values have no implicit one.
+		if (biased != 0) {
+			significand |= bits_t(1) << (format::DIGITS - 1);
+		} else if (significand == 0) {
+			return ZERO();
+		}
+
+		// Just as `normalize` does, negative values saturate if the mantissa
+		// has no sign.
+		if (negative && !(MANTISSA_LOWEST < 0)) {
+			return NEGATIVE_INF();
+		}
+
+		// The value is `significand * 2 ^ exponent`.
+		const int exponent = std::max(biased, 1) - 1 + format::LOWEST;
+
+		if constexpr (BASE_IS_POWER_OF_TWO &&
+		              format::DIGITS + BASE_BITS - 1 <=
+		                  detail::digits<magnitude_t>) {
+			// Moves the binary digits below the base's digits into the
+			// significand.
+			auto digits = exponent / BASE_BITS;
+			digits -= digits * BASE_BITS > exponent;
+			return from_magnitude(static_cast<magnitude_t>(significand)
+			                          << (exponent - digits * BASE_BITS),
+			                      negative, digits);
+		} else {
+			return from_floating(negative ? -value : value, negative,
+			                     exponent + detail::bit_width(significand) - 1);
+		}
+	}
+
+	//! @returns This value rounded to the nearest `Tvalue`, ties to even.  Its
+	//!          bits are composed in a constant number of steps.
+	//!
+	//! @tparam Tvalue A floating point type, for which `detail::ieee754` holds.
+	//!         BASE needs to be a power of two and this value must be finite
+	//!         and `!= 0`.
+	template <typename Tvalue> constexpr Tvalue to_ieee754() const noexcept {
+		using format = detail::ieee754<Tvalue>;
+		using bits_t = typename format::bits_t;
+
+		// The value is `_mantissa * 2 ^ exponent`.
+		const auto exponent = static_cast<std::intmax_t>(_exponent) * BASE_BITS;
+
+		// Converting the mantissa rounds once, while scaling by a normal power
+		// is exact, unless the result is subnormal.
+		constexpr int lowest_normal = format::LOWEST + format::DIGITS - 1;
+		if (exponent >= lowest_normal &&
+		    exponent < lowest_normal + format::MAX_BIASED - 1) {
+			return static_cast<Tvalue>(_mantissa) *
+			       format::from_bits(static_cast<bits_t>(exponent - lowest_normal + 1)
+			                         << (format::DIGITS - 1));
+		}
+
+		const bits_t sign =
+		    _mantissa < 0 ? bits_t(1) << (detail::digits<bits_t> - 1) : 0;
+		const auto magnitude = magnitude_of(_mantissa);
+		const int width = detail::bit_width(magnitude);
+
+		// The result keeps the digits from `lowest` upwards, which are `DIGITS`
+		// unless it is subnormal.
+		auto lowest = std::max<std::intmax_t>(exponent + width - format::DIGITS,
+		                                      format::LOWEST);
+		const auto dropped = lowest - exponent;
+
+		magnitude_t result = 0;
+		if (dropped <= 0) {
+			result = magnitude << -dropped;
+		} else if (dropped <= width) {
+			// The mask wraps around, if all digits are dropped.
+			const auto half = magnitude_t(1) << (dropped - 1);
+			const auto remainder = magnitude & (half * 2 - 1);
+			result = dropped < detail::digits<magnitude_t> ? magnitude >> dropped
+			                                               : 0;
+			result += remainder > half || (remainder == half && (result & 1));
+		}
+
+		// Rounding up may carry into another digit.
+		if (result >> format::DIGITS) {
+			result >>= 1;
+			++lowest;
+		}
+
+		// Subnormal values, including zero, have a biased exponent of `0`.
+		if ((result >> (format::DIGITS - 1)) == 0) {
+			return format::from_bits(sign | static_cast<bits_t>(result));
+		}
+
+		const auto biased = lowest - format::LOWEST + 1;
+		if (biased >= format::MAX_BIASED) {
+			return format::from_bits(
+			    sign | bits_t(format::MAX_BIASED) << (format::DIGITS - 1));
+		}
+		return format::from_bits(
+		    sign | static_cast<bits_t>(biased) << (format::DIGITS - 1) |
+		    (static_cast<bits_t>(result) &
+		     ((bits_t(1) << (format::DIGITS - 1)) - 1)));
+	}
+
+	//! Divides the mantissas of the given operands like a long division does,
+	//! but appends as many digits per step as fit into `Tunsigned`.  Shifting
+	//! the dividend into the doubled width usually takes a single step.
+	//! The quotient gets rounded once.
+	//!
+	//! @param dividend The dividend, its mantissa needs to be `!= 0`.
+	//! @param divisor The divisor, its mantissa needs to be `!= 0`.
+	//! @tparam Tunsigned An unsigned type, holding the product of any two
+	//!         mantissas.
+	template <typename Tunsigned>
+	constexpr static self_t quotient(const self_t &dividend,
+	                                 const self_t &divisor) noexcept {
+		const bool negative = (dividend._mantissa < 0) != (divisor._mantissa < 0);
+		const auto limit =
+		    negative ? Tunsigned(0) - static_cast<Tunsigned>(MANTISSA_LOWEST)
+		             : static_cast<Tunsigned>(MANTISSA_MAX);
+		const auto denominator =
+		    static_cast<Tunsigned>(magnitude_of(divisor._mantissa));
+
+		auto result = static_cast<Tunsigned>(magnitude_of(dividend._mantissa));
+		auto remainder = result % denominator;
+		result /= denominator;
+		std::intmax_t exponent =
+		    static_cast<std::intmax_t>(dividend._exponent) - divisor._exponent;
+
+		// Appends digits until the quotient fills the mantissa.
+		while (remainder != 0 && result <= limit / BASE) {
+			// Neither the remainder nor the quotient may overflow.
+			const auto digits =
+			    grow_digits(result + 1 > remainder ? result + 1 : remainder,
+			                static_cast<Tunsigned>(-1));
+
+			if constexpr (BASE_IS_POWER_OF_TWO) {
+				result <<= digits * BASE_BITS;
+				remainder <<= digits * BASE_BITS;
+			} else {
+				const auto power = detail::powers<Tunsigned, BASE>::values[digits];
+				result *= power;
+				remainder *= power;
+			}
+
+			result += remainder / denominator;
+			remainder %= denominator;
+			exponent -= digits;
+			stats::count(stats::event::quotient_step);
+		}
+
+		return from_magnitude(result, negative, exponent,
+		                      detail::fraction<Tunsigned>{remainder, denominator});
 	}
 
 	//! Adjusts mantissa (and exponent) to show the maximum of trailing digits.
@@ -91,47 +1326,60 @@ class Float {
 			return;
 		}
 
+		// Integers are shifted in one step, as long as their sign fits into the
+		// mantissa.
+		if constexpr (detail::is_integer<Tvalue>::value) {
+			if (value > 0 || MANTISSA_LOWEST < 0) {
+				*this = from_integer(value, _exponent);
+				return;
+			}
+		}
+
 		// Make a positive mantissa as large as possible,
 		// and a negative mantissa as small as possible.
 		if (value > 0) {
 			// Grows mantissa as needed.
 			while (value <= MANTISSA_MAX / BASE) {
 				if (_exponent == EXPONENT_LOWEST) {
-					*this = ZERO();
+					*this = underflowed();
 					return;
 				}
 				--_exponent;
 				value *= BASE;
+				stats::count(stats::event::normalize_step);
 			}
 
 			// Shrinks mantissa as needed.
 			while (value > MANTISSA_MAX) {
 				if (_exponent == EXPONENT_MAX) {
-					*this = INF();
+					*this = overflowed(false);
 					return;
 				}
 				++_exponent;
 				value /= BASE;
+				stats::count(stats::event::normalize_step);
 			}
 		} else {
 			// Grows mantissa as needed.
 			while (value >= MANTISSA_LOWEST / BASE) {
 				if (_exponent == EXPONENT_LOWEST) {
-					*this = ZERO();
+					*this = underflowed();
 					return;
 				}
 				--_exponent;
 				value *= BASE;
+				stats::count(stats::event::normalize_step);
 			}
 
 			// Shrinks mantissa as needed.
 			while (value < MANTISSA_LOWEST) {
 				if (_exponent == EXPONENT_MAX) {
-					*this = NEGATIVE_INF();
+					*this = overflowed(true);
 					return;
 				}
 				++_exponent;
 				value /= BASE;
+				stats::count(stats::event::normalize_step);
 			}
 		}
 
@@ -163,19 +1411,20 @@ class Float {
 	constexpr auto
 	adjust_mantissas(const self_t &first, const self_t &second,
 	                 const int exponent_offset = 0) const noexcept {
+		// The difference of the exponents needs more digits than they have.
+		const auto difference =
+		    static_cast<std::intmax_t>(first._exponent) - second._exponent;
 
-		if (first._exponent > second._exponent) {
+		if (difference > 0) {
 			return adjusted_result(
 			    power_negative(first._mantissa, exponent_offset),
-			    power_negative(second._mantissa,
-			                   first._exponent - second._exponent + exponent_offset),
+			    power_negative(second._mantissa, difference + exponent_offset),
 			    first._exponent + exponent_offset);
 		}
 
-		if (first._exponent < second._exponent) {
+		if (difference < 0) {
 			return adjusted_result(
-			    power_negative(first._mantissa,
-			                   second._exponent - first._exponent + exponent_offset),
+			    power_negative(first._mantissa, exponent_offset - difference),
 			    power_negative(second._mantissa, exponent_offset),
 			    second._exponent + exponent_offset);
 		}
@@ -196,12 +1445,416 @@ class Float {
 		return target;
 	}
 
+	//! @returns The infinity of the given sign, or its largest magnitude if
+	//! results saturate, counting an overflow, see `fas/stats.hpp`.
+	constexpr static self_t overflowed(const bool negative) noexcept {
+		stats::count(stats::event::overflow);
+		if constexpr (SATURATES) {
+			return negative ? LOWEST() : MAX();
+		}
+		return negative ? NEGATIVE_INF() : INF();
+	}
+
+	//! @returns The saturated quotient of the given dividend, which is zero or
+	//! finite, by zero, see `overflow::saturate`.
+	constexpr static self_t saturated_by_zero(const self_t &dividend) noexcept {
+		if (dividend._mantissa == 0) {
+			return ZERO();
+		}
+		stats::count(stats::event::division_by_zero);
+		return dividend._mantissa < 0 ? LOWEST() : MAX();
+	}
+
+	//! @returns Zero, counting an underflow.
+	constexpr static self_t underflowed() noexcept {
+		stats::count(stats::event::underflow);
+		return ZERO();
+	}
+
+	//! @returns `NOT_A_NUMBER()` of operands, which are numbers.
+	constexpr static self_t invalid() noexcept {
+		stats::count(stats::event::not_a_number);
+		return NOT_A_NUMBER();
+	}
+
+	//! @returns Whether the given value is `INF()` or `NEGATIVE_INF()`.
+	constexpr static bool is_infinite(const classification target) noexcept {
+		return target == classification::inf ||
+		       target == classification::negative_inf;
+	}
+
+	//! @returns Whether the given value is less than zero.
+	constexpr static bool is_negative(const self_t &target,
+	                                  const classification target_class) noexcept {
+		return target._mantissa < 0 ||
+		       target_class == classification::negative_inf;
+	}
+
+	//! @returns The `sort_key()` of the value, which needs to be finite.
+	constexpr auto finite_key() const noexcept {
+		constexpr auto zero = sort_key_type(1) << DISTANCE_BITS;
+		const auto distance =
+		    sort_key_type(static_cast<std::uintmax_t>(_exponent) -
+		                  static_cast<std::uintmax_t>(EXPONENT_LOWEST))
+		        << MAGNITUDE_BITS |
+		    static_cast<sort_key_type>(magnitude_of(_mantissa));
+		return _mantissa < 0 ? zero - distance : zero + distance;
+	}
+
+	//! @returns The position of the value's class in the numeric order, which
+	//! does not include not a number.
+	constexpr static int rank(const self_t &target) noexcept {
+		switch (target.classify()) {
+		case classification::negative_inf:
+			return 0;
+		case classification::finite:
+			return target._mantissa < 0 ? 1 : 3;
+		case classification::zero:
+			return 2;
+		default:
+			return 4;
+		}
+	}
+
+	//! @returns Whether one of the given values is not a number, so they are
+	//! not ordered.
+	constexpr static bool unordered(const self_t &first,
+	                                const self_t &second) noexcept {
+		return first.classify() == classification::not_a_number ||
+		       second.classify() == classification::not_a_number;
+	}
+
+	//! @returns Whether `first < second`, of which at least one is a special
+	//! value or zero.  Not a number is unordered.
+	constexpr static bool special_less(const self_t &first,
+	                                   const self_t &second) noexcept {
+		if (unordered(first, second)) {
+			return false;
+		}
+
+		return rank(first) < rank(second);
+	}
+
+	//! @returns The sum of the given operands, of which at least one is a
+	//! special value.  `second` is negated only where it is the result, since
+	//! negating `LOWEST()` overflows.
+	//!
+	//! @param subtract Whether to subtract `second` instead.
+	constexpr static self_t special_sum(const self_t &first, const self_t &second,
+	                                    const bool subtract = false) noexcept {
+		stats::count(stats::event::special_operand);
+		const auto first_class = first.classify();
+		const auto second_class = second.classify();
+
+		if (first_class == classification::not_a_number ||
+		    second_class == classification::not_a_number) {
+			return NOT_A_NUMBER();
+		}
+
+		if (first_class == classification::zero) {
+			return subtract ? -second : second;
+		}
+
+		if (second_class == classification::zero) {
+			return first;
+		}
+
+		// Now at least one operand is infinite.
+		if (first_class == classification::finite) {
+			return subtract ? -second : second;
+		}
+
+		if (second_class == classification::finite) {
+			return first;
+		}
+
+		return (first_class == second_class) != subtract ? first : invalid();
+	}
+
+	//! @returns The sum of the given finite operands, rounded once by ROUNDING,
+	//! which also truncates exactly.
+	//! The operands are aligned in the doubled width, with guard digits below
+	//! the one of the larger exponent, so only digits below the guard digits
+	//! are dropped.  Those are kept as a fraction for rounding.
+	//!
+	//! @param first The first summand, needs to be finite.
+	//! @param second The second summand, needs to be finite.
+	//! @param subtract Whether to subtract `second` instead.
+	constexpr static self_t rounded_sum(const self_t &first, const self_t &second,
+	                                    const bool subtract) noexcept {
+		using Tunsigned =
+		    detail::magnitude_t<typename detail::wider<Tmantissa>::type>;
+
+		const auto lowest = Tunsigned(0) - static_cast<Tunsigned>(MANTISSA_LOWEST);
+		const auto largest = std::max(lowest, static_cast<Tunsigned>(MANTISSA_MAX));
+		// Any sum of two magnitudes with guard digits fits.
+		const auto guard = grow_digits(largest, Tunsigned(-1) / 2);
+		const auto max_power = grow_digits(Tunsigned(1), Tunsigned(-1));
+
+		const bool swap = first._exponent < second._exponent;
+		const auto &larger = swap ? second : first;
+		const auto &smaller = swap ? first : second;
+		const bool larger_negative = (larger._mantissa < 0) != (swap && subtract);
+		const bool smaller_negative =
+		    (smaller._mantissa < 0) != (!swap && subtract);
+		const auto shift =
+		    static_cast<std::intmax_t>(larger._exponent) - smaller._exponent;
+
+		const auto a = static_cast<Tunsigned>(magnitude_of(larger._mantissa)) *
+		               power_of<Tunsigned>(guard);
+		auto b = static_cast<Tunsigned>(magnitude_of(smaller._mantissa));
+		detail::fraction<Tunsigned> below;
+		if (shift <= guard) {
+			b *= power_of<Tunsigned>(static_cast<int>(guard - shift));
+		} else if (shift - guard <= max_power) {
+			const auto divisor = power_of<Tunsigned>(static_cast<int>(shift - guard));
+			below = {b % divisor, divisor};
+			b /= divisor;
+		} else {
+			// Overestimates the tiny fraction, which keeps it below a half.
+			below = {b, power_of<Tunsigned>(max_power)};
+			b = 0;
+		}
+
+		const auto exponent = larger._exponent - std::intmax_t(guard);
+		if (larger_negative == smaller_negative) {
+			return from_magnitude(a + b, larger_negative, exponent, below);
+		}
+
+		if (below.numerator == 0) {
+			return a == b ? ZERO()
+			       : a > b
+			           ? from_magnitude(a - b, larger_negative, exponent)
+			           : from_magnitude(b - a, smaller_negative, exponent);
+		}
+
+		// Now `b < a`:  a - (b + f) == (a - b - 1) + (1 - f).
+		return from_magnitude(
+		    a - b - 1, larger_negative, exponent,
+		    detail::fraction<Tunsigned>{below.denominator - below.numerator,
+		                                below.denominator});
+	}
+
+	//! Asserts unless `NDEBUG` is defined, that `target` is finite, which the
+	//! unchecked operators expect of their operands.
+	constexpr static void expect_finite(const self_t &target) noexcept {
+		assert(target._mantissa != 0 || target.classify() == classification::zero);
+		// Avoids the warning of an unused parameter, if `NDEBUG` is defined.
+		static_cast<void>(target);
+	}
+
+	//! @returns The sum of the given finite operands without checking for
+	//! special values and overflows, see `overflow::unchecked`.  The sum is
+	//! taken in the doubled width by `rounded_sum`, so it does not need to
+	//! shift on overflows.  A zero takes the exponent of the other operand, so
+	//! it aligns without a branch.
+	//!
+	//! @param first The first summand, needs to be finite.
+	//! @param second The second summand, needs to be finite.
+	//! @param subtract Whether to subtract `second` instead.
+	constexpr static self_t unchecked_sum(self_t first, self_t second,
+	                                      const bool subtract) noexcept {
+		expect_finite(first);
+		expect_finite(second);
+		first._exponent = first._mantissa != 0 ? first._exponent : second._exponent;
+		second._exponent =
+		    second._mantissa != 0 ? second._exponent : first._exponent;
+
+		return rounded_sum(first, second, subtract);
+	}
+
+	//! @returns The product of the given operands, of which at least one is a
+	//! special value.
+	constexpr static self_t special_product(const self_t &first,
+	                                        const self_t &second) noexcept {
+		stats::count(stats::event::special_operand);
+		const auto first_class = first.classify();
+		const auto second_class = second.classify();
+
+		if (first_class == classification::not_a_number ||
+		    second_class == classification::not_a_number) {
+			return NOT_A_NUMBER();
+		}
+
+		if (first_class == classification::zero ||
+		    second_class == classification::zero) {
+			return is_infinite(first_class) || is_infinite(second_class)
+			           ? invalid()
+			           : ZERO();
+		}
+
+		// Now at least one operand is infinite, the other one is not zero.
+		return is_negative(first, first_class) != is_negative(second, second_class)
+		           ? NEGATIVE_INF()
+		           : INF();
+	}
+
+	//! @returns The quotient of the given operands, of which at least one is a
+	//! special value.
+	constexpr static self_t special_quotient(const self_t &dividend,
+	                                         const self_t &divisor) noexcept {
+		stats::count(stats::event::special_operand);
+		const auto dividend_class = dividend.classify();
+		const auto divisor_class = divisor.classify();
+
+		if (dividend_class == classification::not_a_number ||
+		    divisor_class == classification::not_a_number) {
+			return NOT_A_NUMBER();
+		}
+
+		if (divisor_class == classification::zero) {
+			if (SATURATES && !is_infinite(dividend_class)) {
+				return saturated_by_zero(dividend);
+			}
+			if (dividend_class == classification::zero) {
+				return invalid();
+			}
+			if (dividend_class == classification::finite) {
+				stats::count(stats::event::division_by_zero);
+			}
+			return is_negative(dividend, dividend_class) ? NEGATIVE_INF() : INF();
+		}
+
+		if (is_infinite(divisor_class)) {
+			return is_infinite(dividend_class) ? invalid() : ZERO();
+		}
+
+		if (dividend_class == classification::zero) {
+			return ZERO();
+		}
+
+		// Now the dividend is infinite, the divisor is finite.
+		return is_negative(dividend, dividend_class) !=
+		               is_negative(divisor, divisor_class)
+		           ? NEGATIVE_INF()
+		           : INF();
+	}
+
+	//! Whether the templated operators treat `Tvalue` as an integer operand.
+	template <typename Tvalue>
+	constexpr static bool IS_INTEGER_OPERAND =
+	    detail::is_integer<Tvalue>::value && !std::is_same<Tvalue, bool>::value;
+
+	//! The type, which operations of `this` and the `Float` type `Tother`
+	//! promote to, see `detail::promoted`.
+	template <typename Tother>
+	using promoted_t = typename detail::promoted<self_t, Tother>::type;
+
+	//! Converts an operand of the templated operators.  Integers are shifted
+	//! into the mantissa in one step, see `from_integer`, instead of being
+	//! converted to `double` first.
+	//!
+	//! @param value The operand to convert.
+	template <typename Tvalue>
+	constexpr static self_t operand(const Tvalue &value) noexcept {
+		if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			return from_integer(value, 0);
+		} else {
+			return self_t(value);
+		}
+	}
+
+	//! The result of `compare_integer` if this is not a number.
+	constexpr static int UNORDERED = 2;
+
+	//! Compares this value exactly with an integer, which may have more digits
+	//! than the mantissa.  The integer is not converted, but divided by the
+	//! power of BASE of a non-negative exponent, or this value's magnitude is
+	//! divided by that of a negative one.
+	//!
+	//! @param value The integer to compare with.
+	//! @returns The sign of `*this - value`, or `UNORDERED`.
+	template <typename Tvalue>
+	constexpr int compare_integer(const Tvalue &value) const noexcept {
+		const bool negative = value < 0;
+		const int value_sign = negative ? -1 : value != 0;
+		if (_mantissa == 0) {
+			switch (classify()) {
+			case classification::not_a_number:
+				return UNORDERED;
+			case classification::inf:
+				return 1;
+			case classification::negative_inf:
+				return -1;
+			default:
+				return -value_sign;
+			}
+		}
+
+		const int sign = _mantissa < 0 ? -1 : 1;
+		if (sign != value_sign) {
+			return sign;
+		}
+
+		// Compares the magnitudes in the wider of both types, whose order flips
+		// for negative values.
+		using Tunsigned = detail::magnitude_t<Tvalue>;
+		using Twide =
+		    std::conditional_t<(detail::digits<Tunsigned> >
+		                        detail::digits<magnitude_t>),
+		                       Tunsigned, magnitude_t>;
+		using table = detail::powers<Twide, static_cast<Twide>(BASE)>;
+		const auto mantissa = static_cast<Twide>(magnitude_of(_mantissa));
+		const auto integer = static_cast<Twide>(
+		    negative ? Tunsigned(0) - static_cast<Tunsigned>(value)
+		             : static_cast<Tunsigned>(value));
+
+		if (_exponent >= 0) {
+			// The power exceeds the integer, if it is beyond the table.
+			if (static_cast<std::size_t>(_exponent) >= table::values.size()) {
+				return sign;
+			}
+			const auto power = table::values[_exponent];
+			const auto quotient = integer / power;
+			if (mantissa != quotient) {
+				return mantissa > quotient ? sign : -sign;
+			}
+			return integer % power != 0 ? -sign : 0;
+		}
+
+		// A magnitude below one is below any integer, too.
+		const auto digits = -std::intmax_t(_exponent);
+		if (static_cast<std::size_t>(digits) >= table::values.size()) {
+			return -sign;
+		}
+		const auto power = table::values[digits];
+		const auto quotient = mantissa / power;
+		if (quotient != integer) {
+			return quotient > integer ? sign : -sign;
+		}
+		return mantissa % power != 0 ? sign : 0;
+	}
+
+	//! @returns `k`, if the magnitude of the integer `value` is `BASE ^ k`,
+	//! otherwise `-1`.  Unless BASE is a power of two, only `1` and `BASE` are
+	//! recognized, since testing the other powers takes divisions.
+	template <typename Tvalue>
+	constexpr static int power_of_base(const Tvalue value) noexcept {
+		using Tunsigned = detail::magnitude_t<Tvalue>;
+		const auto magnitude = value < 0
+		                           ? Tunsigned(0) - static_cast<Tunsigned>(value)
+		                           : static_cast<Tunsigned>(value);
+
+		if constexpr (BASE_IS_POWER_OF_TWO) {
+			if (magnitude == 0 || (magnitude & (magnitude - 1)) != 0) {
+				return -1;
+			}
+			const auto bits = detail::bit_width(magnitude) - 1;
+			return bits % BASE_BITS == 0 ? bits / BASE_BITS : -1;
+		} else {
+			if (magnitude == 1) {
+				return 0;
+			}
+			return magnitude == static_cast<Tunsigned>(BASE) ? 1 : -1;
+		}
+	}
+
 public:
 	//! @returns The type's zero representation.
 	constexpr static const self_t ZERO() { return self_t(); }
 
 	//! @returns The type's zero representation.
-	constexpr static const self_t ONE() { return self_t(1); }
+	constexpr static const self_t ONE() { return from_integer(1, 0); }
 
 	//! @returns The type's infinity representation.
 	constexpr static const self_t INF() { return of(0, 1); }
@@ -226,12 +1879,104 @@ public:
 	//! @returns The type's base.
 	constexpr static const Tmantissa EXPONENT_BASE() { return BASE; }
 
+	//! @returns The type's rounding mode.
+	constexpr static rounding ROUNDING_MODE() noexcept { return ROUNDING; }
+
 	//! @returns The value's mantissa.
 	constexpr Tmantissa mantissa() const noexcept { return _mantissa; }
 
 	//! @returns The value's exponent.
 	constexpr Texponent exponent() const noexcept { return _exponent; }
 
+	//! Classifies the value.  Only values with a zero mantissa need to be
+	//! looked at further, so finite values are recognized by a single test.
+	//!
+	//! @returns The value's class.
+	constexpr classification classify() const noexcept {
+		if (_mantissa != 0) {
+			return classification::finite;
+		}
+
+		switch (_exponent) {
+		case 1:
+			return classification::inf;
+		case 2:
+			return classification::negative_inf;
+		case 3:
+			return classification::not_a_number;
+		default:
+			return classification::zero;
+		}
+	}
+
+	//! The unsigned type of `sort_key()`.  It is `void`, if the exponent and
+	//! the mantissa together take more than 126 bits.
+	using sort_key_type =
+	    typename detail::least_unsigned<DISTANCE_BITS + 2>::type;
+
+	//! Maps the value to an unsigned integer, whose natural order is the total
+	//! order `NEGATIVE_INF() < finite values < INF() < NOT_A_NUMBER()`.  The
+	//! finite values are ordered numerically, so comparing their keys takes a
+	//! single integer comparison.  Values need to be normalized.
+	//!
+	//! The exponent is folded above the magnitude of the mantissa into a
+	//! distance, which is added to the key of zero, `2 ^ DISTANCE_BITS`, for
+	//! positive values and subtracted from it for negative ones.
+	constexpr sort_key_type sort_key() const noexcept {
+		static_assert(!std::is_void<sort_key_type>::value,
+		              "The exponent and the mantissa need to fit into 126 bits.");
+		constexpr auto zero = sort_key_type(1) << DISTANCE_BITS;
+
+		if (_mantissa == 0) {
+			switch (classify()) {
+			case classification::inf:
+				return 2 * zero;
+			case classification::negative_inf:
+				return 0;
+			case classification::not_a_number:
+				return 2 * zero + 1;
+			default:
+				return zero;
+			}
+		}
+
+		return finite_key();
+	}
+
+	//! @returns The normalized value, whose `sort_key()` is `key`.
+	//!
+	//! @tparam Tkey The key's type, which is deduced as a template parameter
+	//!         only because `sort_key_type` may be `void`.
+	template <typename Tkey>
+	constexpr static self_t from_sort_key(const Tkey key) noexcept {
+		static_assert(std::is_same<Tkey, sort_key_type>::value,
+		              "The key needs to be of the type `sort_key_type`.");
+		constexpr auto zero = sort_key_type(1) << DISTANCE_BITS;
+		if (key == 0) {
+			return NEGATIVE_INF();
+		}
+		if (key == zero) {
+			return ZERO();
+		}
+		if (key >= 2 * zero) {
+			return key == 2 * zero ? INF() : NOT_A_NUMBER();
+		}
+
+		const bool negative = key < zero;
+		const auto distance = negative ? zero - key : key - zero;
+		const auto magnitude = static_cast<magnitude_t>(
+		    distance & ((sort_key_type(1) << MAGNITUDE_BITS) - 1));
+		const auto exponent = static_cast<std::uintmax_t>(
+		                          distance >> MAGNITUDE_BITS) +
+		                      static_cast<std::uintmax_t>(EXPONENT_LOWEST);
+
+		// Avoids overflowing, when the magnitude equals `-MANTISSA_LOWEST`.
+		return of(negative ? static_cast<Tmantissa>(
+		                         -static_cast<Tmantissa>(magnitude - 1) - 1)
+		                   : static_cast<Tmantissa>(magnitude),
+		          static_cast<Texponent>(exponent));
+	}
+
 	//! Default constructor.
 	Float() = default;
 
@@ -257,7 +2002,7 @@ public:
 		} else if (exponent < EXPONENT_LOWEST) {
 			*this = NEGATIVE_INF();
 		} else {
-			_exponent = exponent;
+			_exponent = static_cast<Texponent>(exponent);
 
 			// The function normalize operates on its parameter.
 			// If the max(value) is smaller than max(_mantissa), value will overflow.
@@ -272,14 +2017,70 @@ public:
 		}
 	}
 
-	//! Conversion constructor.
+#if !defined(FAS_FREESTANDING)
+	//! Conversion constructor, truncating the value towards zero.  If `double`
+	//! is an IEEE-754 binary format, its bits are decomposed in a constant
+	//! number of steps, see `from_ieee754`.  The freestanding configuration
+	//! omits it, see `FAS_FREESTANDING`.
 	//!
 	//! @param value Not normalized mantissa value.
-	//!              Caution: This constructor works only if
+	//!              Caution: Without IEEE-754 support this constructor works
+	//!              only if
 	//!              - `MANTISSA_MAX < DBL_MAX` and
 	//!              - `MANTISSA_LOWEST > (-DBL_MAX)`
-	//! @tparam Tvalue The value's type.
-	explicit constexpr Float(double value) { normalize(value); }
+	explicit constexpr Float(double value) {
+		if constexpr (detail::ieee754<double>::value) {
+			*this = from_ieee754(value);
+		} else {
+			normalize(value);
+		}
+	}
+#else
+	//! Conversion constructor of the freestanding configuration, which takes
+	//! integers like `Float(value, 0)` instead of `double`.
+	//!
+	//! @param value The integer to convert.
+	template <typename Tvalue,
+	          typename = std::enable_if_t<detail::is_integer<Tvalue>::value>>
+	explicit constexpr Float(const Tvalue value) noexcept : Float(value, 0) {}
+#endif
+
+	//! Conversion constructor from a `Float` type of the same BASE.  The
+	//! mantissa is shifted by the digits, which the mantissas differ in, and
+	//! truncated towards zero, if it has too many.  Values leaving the range
+	//! of exponents become zero or infinite, special values remain as they are.
+	//!
+	//! @param other The value to convert.
+	template <typename TotherMantissa, typename TotherExponent,
+	          TotherMantissa OTHER_BASE, TotherMantissa OTHER_MANTISSA_LOWEST,
+	          TotherMantissa OTHER_MANTISSA_MAX,
+	          TotherExponent OTHER_EXPONENT_LOWEST,
+	          TotherExponent OTHER_EXPONENT_MAX,
+	          rounding OTHER_ROUNDING, overflow OTHER_ON_OVERFLOW,
+	          typename = std::enable_if_t<OTHER_BASE == BASE>>
+	explicit constexpr Float(
+	    const Float<TotherMantissa, TotherExponent, OTHER_BASE,
+	                OTHER_MANTISSA_LOWEST, OTHER_MANTISSA_MAX,
+	                OTHER_EXPONENT_LOWEST, OTHER_EXPONENT_MAX, OTHER_ROUNDING,
+	                OTHER_ON_OVERFLOW> &other) noexcept {
+		switch (other.classify()) {
+		case classification::finite:
+			*this = from_integer(other.mantissa(), other.exponent());
+			break;
+		case classification::zero:
+			*this = ZERO();
+			break;
+		case classification::inf:
+			*this = INF();
+			break;
+		case classification::negative_inf:
+			*this = NEGATIVE_INF();
+			break;
+		case classification::not_a_number:
+			*this = NOT_A_NUMBER();
+			break;
+		}
+	}
 
 	//! Default copy assignment operator.
 	Float &operator=(const Float &) = default;
@@ -287,7 +2088,8 @@ public:
 	//! Default move assignment operator.
 	Float &operator=(Float &&) = default;
 
-	//! Returns whether the given operand is considered same to this.
+	//! Returns whether the given operand is considered same to this.  Not a
+	//! number equals itself, like its sort key and hash do, but no other value.
 	//!
 	//! @param other The value to compare. Both, `this` and `other` need to be
 	//!              normalized.
@@ -299,13 +2101,20 @@ public:
 		return _mantissa == other._mantissa && _exponent == other._exponent;
 	}
 
-	//! Returns whether the given operand is considered same to this.
+	//! Returns whether the given operand is considered same to this.  Integers
+	//! are compared exactly, see `compare_integer`.
 	//!
 	//! @param other The value to compare. Both, `this` and `other` need to be
 	//!              normalized.
 	template <typename Tvalue>
 	constexpr auto operator==(const Tvalue &other) const noexcept {
-		return *this == self_t(other);
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) == promoted_t<Tvalue>(other);
+		} else if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			return compare_integer(other) == 0;
+		} else {
+			return *this == self_t(other);
+		}
 	}
 
 	//! Returns whether the given operand is considered different from this.
@@ -322,7 +2131,13 @@ public:
 	//!              normalized.
 	template <typename Tvalue>
 	constexpr auto operator!=(const Tvalue &other) const noexcept {
-		return *this != self_t(other);
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) != promoted_t<Tvalue>(other);
+		} else if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			return compare_integer(other) != 0;
+		} else {
+			return *this != self_t(other);
+		}
 	}
 
 	//! Returns whether `this` is smaller than the given operand.
@@ -330,34 +2145,47 @@ public:
 	//! @param other The value to compare. Both, `this` and `other` need to be
 	//!              normalized.
 	constexpr auto operator<(const self_t &other) const noexcept {
-		if (*this == ZERO()) {
-			return other._mantissa > 0;
+		if (_mantissa == 0 || other._mantissa == 0) {
+			return special_less(*this, other);
 		}
 
-		if (other == ZERO()) {
-			return _mantissa < 0;
-		}
+		if constexpr (std::is_void<sort_key_type>::value) {
+			// Negative mantissas grow in magnitude with the exponent.
+			const bool negative = _mantissa < 0;
+			if (negative != (other._mantissa < 0)) {
+				return negative;
+			}
 
-		if (_exponent != other._exponent) {
-			return _exponent < other._exponent;
-		}
+			if (_exponent != other._exponent) {
+				return (_exponent < other._exponent) != negative;
+			}
 
-		return _mantissa < other._mantissa;
+			return _mantissa < other._mantissa;
+		} else {
+			return finite_key() < other.finite_key();
+		}
 	}
 
-	//! Returns whether `this` is smaller than the given operand.
+	//! Returns whether `this` is smaller than the given operand.  Integers are
+	//! compared exactly, see `compare_integer`.
 	//!
 	//! @param other The value `this` is compared to.
 	template <typename Tvalue>
 	constexpr auto operator<(const Tvalue &other) const noexcept {
-		return *this < self_t(other);
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) < promoted_t<Tvalue>(other);
+		} else if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			return compare_integer(other) == -1;
+		} else {
+			return *this < self_t(other);
+		}
 	}
 
 	//! Returns whether `this` is larger than the given operand.
 	//!
 	//! @param other The value `this` is compared to.
 	constexpr auto operator>(const self_t &other) const noexcept {
-		return (!(*this < other)) && *this != other;
+		return other < *this;
 	}
 
 	//! Returns whether `this` is larger than the given operand.
@@ -365,10 +2193,18 @@ public:
 	//! @param other The value `this` is compared to.
 	template <typename Tvalue>
 	constexpr auto operator>(const Tvalue &other) const noexcept {
-		return *this > self_t(other);
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) > promoted_t<Tvalue>(other);
+		} else if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			return compare_integer(other) == 1;
+		} else {
+			return *this > self_t(other);
+		}
 	}
 
-	//! Returns whether `this` is smaller or equals than the given operand.
+	//! Returns whether `this` is smaller or equals than the given operand,
+	//! which is `*this < other || *this == other`.  Not a number is unordered,
+	//! but equals itself, see `operator==`.
 	//!
 	//! @param other The value `this` is compared to.
 	constexpr auto operator<=(const self_t &other) const noexcept {
@@ -380,14 +2216,22 @@ public:
 	//! @param other The value `this` is compared to.
 	template <typename Tvalue>
 	constexpr auto operator<=(const Tvalue &other) const noexcept {
-		return *this <= self_t(other);
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) <= promoted_t<Tvalue>(other);
+		} else if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			const auto order = compare_integer(other);
+			return order == -1 || order == 0;
+		} else {
+			return *this <= self_t(other);
+		}
 	}
 
-	//! Returns whether `this` is larger or equals than the given operand.
+	//! Returns whether `this` is larger or equals than the given operand,
+	//! which is `other < *this || *this == other`, see `operator<=`.
 	//!
 	//! @param other The value `this` is compared to.
 	constexpr auto operator>=(const self_t &other) const noexcept {
-		return !(*this < other);
+		return other < *this || *this == other;
 	}
 
 	//! Returns whether `this` is larger or equals than the given operand.
@@ -395,7 +2239,14 @@ public:
 	//! @param other The value `this` is compared to.
 	template <typename Tvalue>
 	constexpr auto operator>=(const Tvalue &other) const noexcept {
-		return *this >= self_t(other);
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) >= promoted_t<Tvalue>(other);
+		} else if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			const auto order = compare_integer(other);
+			return order == 1 || order == 0;
+		} else {
+			return *this >= self_t(other);
+		}
 	}
 
 	//! Returns this converted to the expected type Tvalue.
@@ -403,16 +2254,63 @@ public:
 	//! @tparam Tvalue The type of the return value.
 	template <typename Tvalue>
 	constexpr explicit operator Tvalue() const noexcept {
-		Tvalue result = static_cast<Tvalue>(_mantissa);
-		for (Texponent i = 0; i < _exponent; ++i) {
-			result *= BASE;
-		}
+		// Floats of other instantiations count as floating point, too.
+		if constexpr (std::is_floating_point<Tvalue>::value &&
+		              !std::is_class<Tvalue>::value) {
+#if defined(FAS_FREESTANDING)
+			static_assert(!std::is_floating_point<Tvalue>::value,
+			              "The freestanding configuration does not convert to "
+			              "native floating point types.");
+#endif
+			switch (classify()) {
+			case classification::zero:
+				return 0;
+			case classification::inf:
+				return std::numeric_limits<Tvalue>::infinity();
+			case classification::negative_inf:
+				return -std::numeric_limits<Tvalue>::infinity();
+			case classification::not_a_number:
+				return std::numeric_limits<Tvalue>::quiet_NaN();
+			default:
+				break;
+			}
 
-		for (Texponent i = 0; i > _exponent; --i) {
-			result /= BASE;
-		}
+			if constexpr (detail::ieee754<Tvalue>::value && BASE_IS_POWER_OF_TWO) {
+				return to_ieee754<Tvalue>();
+			} else {
+				return scale(static_cast<Tvalue>(_mantissa), _exponent);
+			}
+		} else if constexpr (std::is_integral<Tvalue>::value) {
+			if (_exponent < 0) {
+				return static_cast<Tvalue>(
+				    power_negative(_mantissa, -std::intmax_t(_exponent)));
+			}
 
-		return result;
+			// Powers beyond the table overflow any integer type.
+			using table =
+			    detail::powers<std::uintmax_t, static_cast<std::uintmax_t>(BASE)>;
+			const auto power =
+			    static_cast<std::size_t>(_exponent) < table::values.size()
+			        ? table::values[_exponent]
+			        : 0;
+
+			// Multiplying unsigned wraps around (instead of being undefined) on
+			// overflow, just as multiplying digit by digit would.
+			return static_cast<Tvalue>(
+			    static_cast<std::uintmax_t>(static_cast<std::intmax_t>(_mantissa)) *
+			    power);
+		} else {
+			Tvalue result = static_cast<Tvalue>(_mantissa);
+			for (Texponent i = 0; i < _exponent; ++i) {
+				result *= BASE;
+			}
+
+			for (Texponent i = 0; i > _exponent; --i) {
+				result /= BASE;
+			}
+
+			return result;
+		}
 	}
 
 	//! Returns the operand.
@@ -420,43 +2318,44 @@ public:
 
 	//! Returns the negated operand.
 	constexpr self_t operator-() const noexcept {
-		if (*this == INF()) {
-			return NEGATIVE_INF();
+		if constexpr (UNCHECKED) {
+			expect_finite(*this);
+		} else if (_mantissa == 0) {
+			switch (classify()) {
+			case classification::inf:
+				return NEGATIVE_INF();
+			case classification::negative_inf:
+				return INF();
+			default:
+				return *this;
+			}
 		}
 
-		if (*this == NEGATIVE_INF()) {
-			return INF();
+		// Negating the lowest mantissa needs to shrink it.
+		if constexpr (MANTISSA_LOWEST < 0) {
+			return from_magnitude(magnitude_of(_mantissa), _mantissa > 0, _exponent);
+		} else {
+			return self_t(-_mantissa, _exponent);
 		}
-
-		return self_t(-_mantissa, _exponent);
 	}
 
 	//! Returns the sum of `this` and the given summand.
 	//!
 	//! @param summand The operand to add.
 	constexpr self_t operator+(const self_t &summand) const noexcept {
-		if (*this == INF() && summand == NEGATIVE_INF()) {
-			return NOT_A_NUMBER();
-		}
-
-		if (*this == NEGATIVE_INF() && summand == INF()) {
-			return NOT_A_NUMBER();
-		}
-
-		if (*this == INF() || summand == INF()) {
-			return INF();
-		}
-
-		if (*this == NEGATIVE_INF() || summand == NEGATIVE_INF()) {
-			return NEGATIVE_INF();
+		stats::count(stats::event::sum);
+		if constexpr (UNCHECKED) {
+			return unchecked_sum(*this, summand, false);
 		}
 
-		if (*this == ZERO()) {
-			return summand;
+		// Special values have a zero mantissa.  Testing both at once leaves a
+		// single branch for finite operands.
+		if ((_mantissa == 0) | (summand._mantissa == 0)) {
+			return special_sum(*this, summand);
 		}
 
-		if (summand == ZERO()) {
-			return *this;
+		if constexpr (ROUNDS_SUMS) {
+			return rounded_sum(*this, summand, false);
 		}
 
 		auto adjusted = adjust_mantissas(*this, summand);
@@ -468,8 +2367,9 @@ public:
 			if (MANTISSA_MAX - adjusted.first < adjusted.second) {
 				// Returns INF if result is out of range.
 				if (_exponent == EXPONENT_MAX || summand._exponent == EXPONENT_MAX) {
-					return INF();
+					return overflowed(false);
 				}
+				stats::count(stats::event::sum_realignment);
 				adjusted = adjust_mantissas(*this, summand, 1);
 			}
 		} else if (_mantissa < 0 && summand._mantissa < 0) {
@@ -478,8 +2378,9 @@ public:
 			if (MANTISSA_LOWEST - adjusted.first > adjusted.second) {
 				// Returns NEGATIVE_INF if result is out of range.
 				if (_exponent == EXPONENT_MAX || summand._exponent == EXPONENT_MAX) {
-					return NEGATIVE_INF();
+					return overflowed(true);
 				}
+				stats::count(stats::event::sum_realignment);
 				adjusted = adjust_mantissas(*this, summand, 1);
 			}
 		}
@@ -492,8 +2393,12 @@ public:
 	//!
 	//! @param summand The operand to add.
 	template <typename Tvalue>
-	constexpr self_t operator+(const Tvalue &summand) const noexcept {
-		return *this + self_t(summand);
+	constexpr auto operator+(const Tvalue &summand) const noexcept {
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) + promoted_t<Tvalue>(summand);
+		} else {
+			return *this + operand(summand);
+		}
 	}
 
 	//! Returns the sum of this and the given operand.
@@ -501,53 +2406,45 @@ public:
 	//! @param summand The operand to add.
 	template <typename Tvalue>
 	self_t &operator+=(const Tvalue &summand) noexcept {
-		return (*this = *this + summand);
+		return (*this = self_t(*this + summand));
 	}
 	//! Returns the difference of `this` and the given subtrahend.
 	//!
 	//! @param subtrahend The operand to substract.
 	constexpr self_t operator-(const self_t &subtrahend) const noexcept {
-		if (*this == INF() && subtrahend == INF()) {
-			return NOT_A_NUMBER();
-		}
-
-		if (*this == NEGATIVE_INF() && subtrahend == NEGATIVE_INF()) {
-			return NOT_A_NUMBER();
-		}
-
-		if (*this == INF() || subtrahend == NEGATIVE_INF()) {
-			return INF();
-		}
-
-		if (*this == NEGATIVE_INF() || subtrahend == INF()) {
-			return NEGATIVE_INF();
+		stats::count(stats::event::sum);
+		if constexpr (UNCHECKED) {
+			return unchecked_sum(*this, subtrahend, true);
 		}
 
-		if (subtrahend == ZERO()) {
-			return *this;
+		// Special values have a zero mantissa, see `operator+`.
+		if ((_mantissa == 0) | (subtrahend._mantissa == 0)) {
+			return special_sum(*this, subtrahend, true);
 		}
 
-		if (*this == ZERO()) {
-			return -subtrahend;
+		if constexpr (ROUNDS_SUMS) {
+			return rounded_sum(*this, subtrahend, true);
 		}
 
 		auto adjusted = adjust_mantissas(*this, subtrahend);
 
 		// Check for overflow/underflow.
-		if (_mantissa > 0 && subtrahend._mantissa > 0) {
+		if (_mantissa > 0 && subtrahend._mantissa < 0) {
 			// Shift mantissa and increase exponent in case of overflow.
-			if (MANTISSA_MAX - adjusted.first > adjusted.second) {
+			if (adjusted.first > MANTISSA_MAX + adjusted.second) {
 				if (_exponent == EXPONENT_MAX || subtrahend._exponent == EXPONENT_MAX) {
-					return NEGATIVE_INF();
+					return overflowed(false);
 				}
+				stats::count(stats::event::sum_realignment);
 				adjusted = adjust_mantissas(*this, subtrahend, 1);
 			}
 		} else if (_mantissa < 0 && subtrahend._mantissa > 0) {
 			// Shift mantissa and increase exponent in case of underflow.
 			if (adjusted.first < MANTISSA_LOWEST + adjusted.second) {
 				if (_exponent == EXPONENT_MAX || subtrahend._exponent == EXPONENT_MAX) {
-					return NEGATIVE_INF();
+					return overflowed(true);
 				}
+				stats::count(stats::event::sum_realignment);
 				adjusted = adjust_mantissas(*this, subtrahend, 1);
 			}
 		}
@@ -559,8 +2456,12 @@ public:
 	//!
 	//! @param subtrahend The operand to substract.
 	template <typename Tvalue>
-	constexpr self_t operator-(const Tvalue &subtrahend) const noexcept {
-		return *this - self_t(subtrahend);
+	constexpr auto operator-(const Tvalue &subtrahend) const noexcept {
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) - promoted_t<Tvalue>(subtrahend);
+		} else {
+			return *this - operand(subtrahend);
+		}
 	}
 
 	//! Returns the difference of `this` and the given subtrahend.
@@ -568,36 +2469,49 @@ public:
 	//! @param subtrahend The operand to substract.
 	template <typename Tvalue>
 	self_t &operator-=(const Tvalue &subtrahend) noexcept {
-		return (*this = *this - subtrahend);
+		return (*this = self_t(*this - subtrahend));
 	}
 
 	//! Returns the product of `this` and the given operand.
 	//!
 	//! @param other The operand to multiply.
 	constexpr self_t operator*(const self_t &factor) const noexcept {
-		if (*this == ZERO()) {
-			return *this;
+		stats::count(stats::event::product);
+		// Special values have a zero mantissa, see `operator+`.  Unchecked zeros
+		// result in a zero product anyway.
+		if constexpr (UNCHECKED) {
+			expect_finite(*this);
+			expect_finite(factor);
+		} else if ((_mantissa == 0) | (factor._mantissa == 0)) {
+			return special_product(*this, factor);
 		}
 
-		if (factor == ZERO()) {
-			return factor;
+		// Multiplies in the doubled width, so the product gets truncated once.
+		using product_t = typename detail::wider<Tmantissa>::type;
+		if constexpr (!std::is_void<product_t>::value) {
+			return from_integer(static_cast<product_t>(_mantissa) *
+			                        static_cast<product_t>(factor._mantissa),
+			                    static_cast<std::intmax_t>(_exponent) +
+			                        factor._exponent);
 		}
 
-		// multiplication function does not work
-		// if one factor is `1` or `-1`
-		if (factor == ONE()) {
+		// Otherwise the mantissas get split into parts, whose products fit.
+		// This does not work if one factor is `1` or `-1`.
+		const auto one = ONE();
+		const auto minus_one = -one;
+		if (factor == one) {
 			return *this;
 		}
 
-		if (factor == -ONE()) {
+		if (factor == minus_one) {
 			return -(*this);
 		}
 
-		if (*this == ONE()) {
+		if (*this == one) {
 			return factor;
 		}
 
-		if (*this == -ONE()) {
+		if (*this == minus_one) {
 			return -factor;
 		}
 
@@ -692,30 +2606,61 @@ public:
 	//!
 	//! @param other The operand to multiply.
 	template <typename Tvalue>
-	constexpr self_t operator*(const Tvalue &factor) const noexcept {
-		return *this * self_t(factor);
+	constexpr auto operator*(const Tvalue &factor) const noexcept {
+		// Multiplying by a power of BASE only adjusts the exponent.
+		if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			const auto power = power_of_base(factor);
+			if (power >= 0) {
+				return factor < 0 ? -scale(power) : scale(power);
+			}
+		}
+
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) * promoted_t<Tvalue>(factor);
+		} else {
+			return *this * operand(factor);
+		}
 	}
 
 	//! Returns the product of `this` and the given operand.
 	//!
 	//! @param other The operand to multiply.
 	template <typename Tvalue> self_t &operator*=(const Tvalue &factor) noexcept {
-		return (*this = *this * factor);
+		return (*this = self_t(*this * factor));
 	}
 
 	//! Returns the quotient of this and the given divisor.
 	//!
 	//! @param divisor The divisor to use.
 	constexpr self_t operator/(const self_t &divisor) const noexcept {
-		if (*this == ZERO()) {
-			return *this;
+		stats::count(stats::event::quotient);
+		// Special values have a zero mantissa, see `operator+`.  Unchecked zeros
+		// result in a zero quotient anyway.
+		if constexpr (UNCHECKED) {
+			expect_finite(*this);
+			if constexpr (SATURATES) {
+				if (divisor._mantissa == 0) {
+					return saturated_by_zero(*this);
+				}
+			}
+			assert(divisor._mantissa != 0);
+		} else if ((_mantissa == 0) | (divisor._mantissa == 0)) {
+			return special_quotient(*this, divisor);
 		}
 
-		if (divisor == ONE()) {
+		using quotient_t = typename detail::wider<Tmantissa>::type;
+		if constexpr (!std::is_void<quotient_t>::value) {
+			return quotient<typename detail::make_unsigned<quotient_t>::type>(
+			    *this, divisor);
+		}
+
+		// Otherwise the remainder gets approximated.
+		const auto one = ONE();
+		if (divisor == one) {
 			return *this;
 		}
 
-		if (divisor == -ONE()) {
+		if (divisor == -one) {
 			return -(*this);
 		}
 
@@ -731,7 +2676,7 @@ public:
 		}
 
 		// Prevents overflow.
-		if (*this == -ONE()) {
+		if (*this == -one) {
 			mantissa_this /= BASE;
 			++exponent_this;
 		}
@@ -755,19 +2700,31 @@ public:
 		}
 
 		remainer /= mantissa_divisor;
-		return (self_t((Tmantissa)(mantissa_this / mantissa_divisor),
-		               exponent_this - exponent_divisor) +
-		        self_t(remainer,
-		               exponent_this - exponent_divisor - logb(remainer) - 1)) *
-		       result_sign;
+		const auto result =
+		    self_t((Tmantissa)(mantissa_this / mantissa_divisor),
+		           exponent_this - exponent_divisor) +
+		    self_t(remainer, exponent_this - exponent_divisor - logb(remainer) - 1);
+		return result_sign < 0 ? -result : result;
 	}
 
 	//! Returns the quotient of this and the given divisor.
 	//!
 	//! @param divisor The divisor to use.
 	template <typename Tvalue>
-	constexpr self_t operator/(const Tvalue &divisor) const noexcept {
-		return *this / self_t(divisor);
+	constexpr auto operator/(const Tvalue &divisor) const noexcept {
+		// Dividing by a power of BASE only adjusts the exponent.
+		if constexpr (IS_INTEGER_OPERAND<Tvalue>) {
+			const auto power = power_of_base(divisor);
+			if (power >= 0) {
+				return divisor < 0 ? -scale(-power) : scale(-power);
+			}
+		}
+
+		if constexpr (detail::is_float<Tvalue>::value) {
+			return promoted_t<Tvalue>(*this) / promoted_t<Tvalue>(divisor);
+		} else {
+			return *this / operand(divisor);
+		}
 	}
 
 	//! Returns the quotient of this and the given divisor.
@@ -775,29 +2732,101 @@ public:
 	//! @param divisor The divisor to use.
 	template <typename Tvalue>
 	self_t &operator/=(const Tvalue &divisor) noexcept {
-		return (*this = *this / divisor);
+		return (*this = self_t(*this / divisor));
+	}
+
+	//! Returns `this * BASE ^ n`, like `ldexp` does for native floats.  Only
+	//! the exponent is adjusted, so the value becomes zero or infinite, if it
+	//! leaves the exponent's range.  Special values remain as they are.
+	//!
+	//! @param n The exponent to scale by.
+	constexpr self_t scale(const std::intmax_t n) const noexcept {
+		if (_mantissa == 0) {
+			return *this;
+		}
+
+		// Compares `n` before adding it, so it cannot overflow.
+		if (n > static_cast<std::intmax_t>(EXPONENT_MAX) - _exponent) {
+			return overflowed(_mantissa < 0);
+		}
+		if (n < static_cast<std::intmax_t>(EXPONENT_LOWEST) - _exponent) {
+			return underflowed();
+		}
+		return of(_mantissa, static_cast<Texponent>(_exponent + n));
 	}
 
 	//! Returns the incremented value.
-	self_t &operator++() noexcept { return (*this += ONE()); }
+	self_t &operator++() noexcept {
+		constexpr self_t one = ONE();
+		return (*this += one);
+	}
 
 	//! Increments the value and returns the previous one.
 	self_t operator++(int) noexcept {
 		self_t result(*this);
-		*this += ONE();
+		++*this;
 		return result;
 	}
 
 	//! Returns the decremented value.
-	self_t &operator--() noexcept { return (*this -= ONE()); }
+	self_t &operator--() noexcept {
+		constexpr self_t one = ONE();
+		return (*this -= one);
+	}
 
 	//! Decrements the value and returns the previous one.
 	self_t operator--(int) noexcept {
 		self_t result(*this);
-		*this -= ONE();
+		--*this;
 		return result;
 	}
 };
+
+//! Returns the reciprocal `1 / value`.  Multiplying by a reciprocal is faster
+//! than dividing, so it pays off to compute it once, when dividing many values
+//! by the same divisor.  The products may differ from the quotients in the
+//! last digit, because the reciprocal is truncated itself.
+//!
+//! @param value The value to invert.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+constexpr auto reciprocal(
+    const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                ON_OVERFLOW> &value) noexcept {
+	return value.ONE() / value;
+}
+
+//! Returns `value * BASE ^ n`, see `Float::scale`.
+//!
+//! @param value The value to scale.
+//! @param n The exponent to scale by.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+constexpr auto scale(const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+                                 MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+                                 ROUNDING, ON_OVERFLOW> &value,
+                     const std::intmax_t n) noexcept {
+	return value.scale(n);
+}
+
+//! Returns an unsigned integer ordered like `value`, see `Float::sort_key`.
+//!
+//! @param value The value to map.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+constexpr auto sort_key(
+    const Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
+                EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING, ON_OVERFLOW>
+        &value) noexcept {
+	return value.sort_key();
+}
 } // namespace fas
 
 namespace std {
@@ -808,42 +2837,52 @@ struct is_fundamental<fas::Float<args...>>
 
 template <typename Tmantissa, typename Texponent, Tmantissa BASE,
           Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
-          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX>
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          fas::rounding ROUNDING, fas::overflow ON_OVERFLOW>
 
 struct is_floating_point<
     fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST, MANTISSA_MAX,
-               EXPONENT_LOWEST, EXPONENT_MAX>>
+               EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING, ON_OVERFLOW>>
     : std::integral_constant<bool, true> {};
 
 template <typename Tmantissa, typename Texponent, Tmantissa BASE,
           Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
-          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX>
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          fas::rounding ROUNDING, fas::overflow ON_OVERFLOW>
 struct is_arithmetic<fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
-                                MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX>>
+                                MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+                                ROUNDING, ON_OVERFLOW>>
     : std::integral_constant<bool, true> {};
 
 template <typename Tmantissa, typename Texponent, Tmantissa BASE,
           Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
-          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX>
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          fas::rounding ROUNDING, fas::overflow ON_OVERFLOW>
 struct is_scalar<fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
-                            MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX>>
+                            MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+                            ROUNDING, ON_OVERFLOW>>
     : std::integral_constant<bool, true> {};
 
 template <typename Tmantissa, typename Texponent, Tmantissa BASE,
           Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
-          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX>
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          fas::rounding ROUNDING, fas::overflow ON_OVERFLOW>
 struct is_object<fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
-                            MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX>>
+                            MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+                            ROUNDING, ON_OVERFLOW>>
     : std::integral_constant<bool, true> {};
 
 //! Numeric limits -------------------------------------------------------------
 template <typename Tmantissa, typename Texponent, Tmantissa BASE,
           Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
-          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX>
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          fas::rounding ROUNDING, fas::overflow ON_OVERFLOW>
 struct numeric_limits<fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
-                                 MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX>> {
+                                 MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+                                 ROUNDING, ON_OVERFLOW>> {
 	using Ttarget = fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
-	                           MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX>;
+	                           MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+	                           ROUNDING, ON_OVERFLOW>;
 	//! @returns The type's largest value.
 	static const Ttarget max() noexcept { return Ttarget::MAX(); }
 
@@ -853,5 +2892,37 @@ struct numeric_limits<fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
 	//! @returns The type's smallest value.
 	static const Ttarget lowest() noexcept { return Ttarget::LOWEST(); }
 };
+
+//! Hash -----------------------------------------------------------------------
+//! Hashes the mantissa and the exponent, which `operator==` compares.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          fas::rounding ROUNDING, fas::overflow ON_OVERFLOW>
+struct hash<fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+                       MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                       ON_OVERFLOW>> {
+	using Ttarget = fas::Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+	                           MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX,
+	                           ROUNDING, ON_OVERFLOW>;
+
+	//! @returns The hash of `value`.
+	std::size_t operator()(const Ttarget &value) const noexcept {
+		const auto mantissa =
+		    static_cast<typename fas::detail::make_unsigned<Tmantissa>::type>(
+		        value.mantissa());
+		auto bits = static_cast<std::uint64_t>(mantissa);
+		if constexpr (sizeof(mantissa) > sizeof(std::uint64_t)) {
+			bits ^= static_cast<std::uint64_t>(mantissa >> 64);
+		}
+
+		// Spreads the exponent over the bits, which the mantissas of normalized
+		// values share.
+		const auto exponent = static_cast<std::uint64_t>(
+		    static_cast<std::make_unsigned_t<Texponent>>(value.exponent()));
+		return std::hash<std::uint64_t>()(bits ^
+		                                  exponent * 0x9e3779b97f4a7c15);
+	}
+};
 } // namespace std
 #endif // FLOATING_POINT_HPP
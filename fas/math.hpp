@@ -0,0 +1,630 @@
+#ifndef FLOATING_POINT_MATH_HPP
+#define FLOATING_POINT_MATH_HPP
+#include "fas/float.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace fas {
+namespace detail {
+
+//! @returns The largest integer, whose square is at most `value`.
+template <typename Tunsigned>
+constexpr Tunsigned integer_sqrt(const Tunsigned value) noexcept {
+	if (value < 2) {
+		return value;
+	}
+
+	// Starts above the root, from which Newton's method descends monotonically.
+	auto root = Tunsigned(1) << ((bit_width(value) + 1) / 2);
+	for (auto next = (root + value / root) / 2; next < root;
+	     next = (root + value / root) / 2) {
+		root = next;
+	}
+	return root;
+}
+
+#if defined(__SIZEOF_INT128__)
+//! Fixed point arithmetic of 60 binary digits after the point in 64 bits,
+//! which evaluates the series of the elementary functions.  Products are
+//! taken in 128 bits, as are the constants reducing the arguments.
+struct fixed {
+	//! A fixed point value, `value * 2 ^ -FRACTION`.
+	using Tvalue = std::int64_t;
+
+	//! Products and values of more digits.
+	using Twide = __int128;
+
+	//! The magnitudes of `Twide` values and the constants.
+	using Tmagnitude = unsigned __int128;
+
+	//! The binary digits after the point.
+	constexpr static int FRACTION = 60;
+
+	//! The value `1`.
+	constexpr static Tvalue ONE = Tvalue(1) << FRACTION;
+
+	//! `ln(2) * 2 ^ 127`, truncated.
+	constexpr static Tmagnitude LN2 =
+	    Tmagnitude(0x58b90bfbe8e7bcd5) << 64 | 0xe4f1d9cc01f97b57;
+
+	//! `pi / 2 * 2 ^ 126`, truncated.
+	constexpr static Tmagnitude HALF_PI =
+	    Tmagnitude(0x6487ed5110b4611a) << 64 | 0x62633145c06e0e68;
+
+	//! `sqrt(2)`, truncated.
+	constexpr static Tvalue SQRT2 = 0x16a09e667f3bcc90;
+
+	//! @returns `first * second`, truncated towards negative infinity.
+	constexpr static Tvalue mul(const Tvalue first,
+	                            const Tvalue second) noexcept {
+		return static_cast<Tvalue>((Twide(first) * second) >> FRACTION);
+	}
+
+	//! A value split into a multiple of a constant and a remainder.
+	struct reduced {
+		//! The multiple of the constant.
+		std::intmax_t quotient;
+
+		//! The remainder, of the value's fraction digits.
+		Twide remainder;
+	};
+
+	//! Splits `value` into `quotient * constant + remainder`, with the
+	//! nearest quotient, so `|remainder| <= constant / 2` roughly.
+	//!
+	//! The remainder keeps the digits of `value`, as the constant's digits
+	//! below those of `value` are subtracted separately.
+	//!
+	//! @param value The value, `value * 2 ^ -fraction`, needs to be `< 2 ^ 126`
+	//!        in magnitude.
+	//! @param fraction The value's binary digits after the point.
+	//! @param constant The constant, `constant * 2 ^ -constant_fraction`.
+	//! @param constant_fraction The constant's binary digits after the point,
+	//!        which need to exceed `fraction` by up to 63.
+	constexpr static reduced reduce(const Twide value, const int fraction,
+	                                const Tmagnitude constant,
+	                                const int constant_fraction) noexcept {
+		const auto low_bits = constant_fraction - fraction;
+		const auto high = static_cast<Twide>(constant >> low_bits);
+		const auto low =
+		    static_cast<Twide>(constant & ((Tmagnitude(1) << low_bits) - 1));
+
+		auto quotient = ((value < 0 ? -value : value) + high / 2) / high;
+		if (value < 0) {
+			quotient = -quotient;
+		}
+		return {static_cast<std::intmax_t>(quotient),
+		        value - quotient * high - ((quotient * low) >> low_bits)};
+	}
+
+	//! @returns `ln(magnitude * 2 ^ twos)` of 64 binary digits after the point.
+	//!
+	//! @param magnitude The magnitude, needs to be `> 0`.
+	//! @param twos The binary exponent.
+	//! @param negligible The magnitude of the series' terms, below which they
+	//!        are dropped.
+	constexpr static Twide log(const std::uint64_t magnitude, std::intmax_t twos,
+	                           const Tvalue negligible) noexcept {
+		// Scales the magnitude into `[sqrt(2) / 2, sqrt(2)]`.
+		const int width = bit_width(magnitude);
+		auto z = static_cast<Tvalue>(width <= FRACTION + 1
+		                                 ? magnitude << (FRACTION + 1 - width)
+		                                 : magnitude >> (width - FRACTION - 1));
+		twos += width - 1;
+		if (z > SQRT2) {
+			z /= 2;
+			++twos;
+		}
+
+		// `ln(z) == 2 * atanh(s)`, with `|s| <= 0.172`.
+		const auto s = static_cast<Tvalue>(Twide(z - ONE) * ONE / (z + ONE));
+		const auto square = mul(s, s);
+		auto sum = s;
+		for (Tvalue power = s, n = 3; power > negligible || -power > negligible;
+		     n += 2) {
+			power = mul(power, square);
+			sum += power / n;
+		}
+		return twos * static_cast<Twide>(LN2 >> 63) +
+		       Twide(sum) * (Twide(2) << (64 - FRACTION));
+	}
+
+	//! @returns `e ^ value`, see `log` for `negligible`.
+	//!
+	//! @param value The exponent, needs to be `<= ln(2)` in magnitude.
+	constexpr static Tvalue exp(const Tvalue value,
+	                            const Tvalue negligible) noexcept {
+		Tvalue sum = ONE;
+		for (Tvalue term = ONE, n = 1; term > negligible || -term > negligible;
+		     ++n) {
+			term = mul(term, value) / n;
+			sum += term;
+		}
+		return sum;
+	}
+
+	//! @returns `sin(r) / r` of `square == r * r`, see `log` for `negligible`.
+	//!
+	//! @param square The square, needs to be `<= 1`.
+	constexpr static Tvalue sinc(const Tvalue square,
+	                             const Tvalue negligible) noexcept {
+		Tvalue sum = ONE;
+		for (Tvalue term = ONE, n = 2; term > negligible || -term > negligible;
+		     n += 2) {
+			term = -mul(term, square) / (n * (n + 1));
+			sum += term;
+		}
+		return sum;
+	}
+
+	//! @returns `cos(r)` of `square == r * r`, see `sinc`.
+	constexpr static Tvalue cos(const Tvalue square,
+	                            const Tvalue negligible) noexcept {
+		Tvalue sum = ONE;
+		for (Tvalue term = ONE, n = 1; term > negligible || -term > negligible;
+		     n += 2) {
+			term = -mul(term, square) / (n * (n + 1));
+			sum += term;
+		}
+		return sum;
+	}
+};
+#endif
+
+//! Evaluates the elementary functions of `Tfloat`.
+//!
+//! `sqrt` takes the integer root of the mantissa, grown by an even number of
+//! digits, and halves the exponent.  The others reduce their arguments by
+//! multiples of `ln(2)`, `ln(BASE)` or `pi / 2` and evaluate series of the
+//! remainders in `fixed` point.  The series stop at the mantissa's digits and
+//! a few more, so narrow floats take fewer terms.  Their results are accurate
+//! to about the last digit of mantissas of up to 56 bits, but truncated and
+//! not rounded by ROUNDING.
+//!
+//! @tparam Tfloat The `Float` type to evaluate.
+template <typename Tfloat> struct elementary {
+	//! The float's mantissa type.
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+
+	//! The type holding the squared magnitudes for `sqrt`.
+	using Tsquare = magnitude_t<std::conditional_t<
+	    std::is_void<typename wider<Tmantissa>::type>::value, Tmantissa,
+	    typename wider<Tmantissa>::type>>;
+
+	//! @returns The square root of `value`.  The root is taken of the doubled
+	//! width mantissa, so it is exact to the last digit if BASE is a power of
+	//! two, and rounded by ROUNDING if there is a doubled width type.
+	constexpr static Tfloat sqrt(const Tfloat &value) noexcept {
+		switch (value.classify()) {
+		case classification::zero:
+		case classification::inf:
+		case classification::not_a_number:
+			return value;
+		case classification::negative_inf:
+			return Tfloat::NOT_A_NUMBER();
+		case classification::finite:
+			break;
+		}
+
+		if (value._mantissa < 0) {
+			return Tfloat::NOT_A_NUMBER();
+		}
+
+		// Grows the mantissa by an even number of digits, such that the
+		// exponent becomes even.
+		constexpr auto limit = static_cast<Tsquare>(-1);
+		auto magnitude = static_cast<Tsquare>(value._mantissa);
+		std::intmax_t exponent = value._exponent;
+		if (magnitude > limit / Tfloat::EXPONENT_BASE()) {
+			// Without a wider type, the mantissa may not grow at all.
+			if (exponent % 2 != 0) {
+				magnitude /= Tfloat::EXPONENT_BASE();
+				++exponent;
+			}
+		} else {
+			auto digits = Tfloat::grow_digits(magnitude, limit);
+			digits -= (exponent - digits) % 2 != 0;
+			if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+				magnitude <<= digits * Tfloat::BASE_BITS;
+			} else {
+				magnitude *= powers<Tsquare, Tfloat::EXPONENT_BASE()>::values[digits];
+			}
+			exponent -= digits;
+		}
+
+		const auto root = integer_sqrt(magnitude);
+		if constexpr (Tfloat::ROUNDING_MODE() != rounding::truncate &&
+		              !std::is_void<typename wider<Tmantissa>::type>::value) {
+			// The root lies `remainder / (2 * root + 1)` of a digit above
+			// `root`, with the same order to `1 / 2`, which is never a tie.
+			return Tfloat::from_magnitude(
+			    root, false, exponent / 2,
+			    fraction<Tsquare>{magnitude - root * root, 2 * root + 1});
+		} else {
+			return Tfloat::from_magnitude(root, false, exponent / 2);
+		}
+	}
+
+#if defined(__SIZEOF_INT128__)
+	//! The fixed point values.
+	using Tvalue = fixed::Tvalue;
+
+	//! The fixed point values of more digits.
+	using Twide = fixed::Twide;
+
+	//! The magnitudes of `Twide` values.
+	using Tmagnitude = fixed::Tmagnitude;
+
+	//! The binary digits to which the series are evaluated, those of the
+	//! mantissa and a few guard digits.
+	constexpr static int PRECISION =
+	    std::min(mantissa_digits<Tfloat>() + 4, fixed::FRACTION - 4);
+
+	//! The magnitude of the series' terms, below which they are dropped.
+	constexpr static Tvalue NEGLIGIBLE = Tvalue(1)
+	                                     << (fixed::FRACTION - PRECISION);
+
+	//! The binary digits after the point of `LN_BASE`.
+	constexpr static int LN_BASE_FRACTION = 120;
+
+	//! `ln(BASE) * 2 ^ LN_BASE_FRACTION`, needed unless BASE is a power of two.
+	constexpr static Tmagnitude LN_BASE =
+	    static_cast<Tmagnitude>(
+	        fixed::log(static_cast<std::uint64_t>(Tfloat::EXPONENT_BASE()), 0, 1))
+	    << (LN_BASE_FRACTION - 64);
+
+	//! @returns An upper bound of `log2(|value|)`, for a finite `value`.  It
+	//! exceeds the logarithm by less than one, if BASE is a power of two.
+	constexpr static std::intmax_t binary_exponent(const Tfloat &value) noexcept {
+		const auto digits = bit_width(Tfloat::magnitude_of(value._mantissa));
+		std::intmax_t per_digit = Tfloat::BASE_BITS;
+		if constexpr (!Tfloat::BASE_IS_POWER_OF_TWO) {
+			per_digit = bit_width(static_cast<std::uintmax_t>(
+			                Tfloat::EXPONENT_BASE())) -
+			            (value._exponent < 0);
+		}
+		return digits + value._exponent * per_digit;
+	}
+
+	//! @returns The magnitude of `value`'s mantissa, shrunk to 64 bits, and
+	//! its exponent adjusted accordingly.
+	constexpr static std::pair<std::uint64_t, std::intmax_t>
+	mantissa_of(const Tfloat &value) noexcept {
+		auto magnitude =
+		    static_cast<Tmagnitude>(Tfloat::magnitude_of(value._mantissa));
+		std::intmax_t exponent = value._exponent;
+		constexpr auto limit = static_cast<Tmagnitude>(~std::uint64_t(0));
+		if (magnitude > limit) {
+			exponent += Tfloat::shrink_digits(magnitude, limit);
+		}
+		return {static_cast<std::uint64_t>(magnitude), exponent};
+	}
+
+	//! @returns `value * 2 ^ 64`, truncated towards zero.
+	//!
+	//! @param value The value, needs to be `< 2 ^ 62` in magnitude.
+	constexpr static Twide to_fixed(const Tfloat &value) noexcept {
+		auto [mantissa, exponent] = mantissa_of(value);
+		auto magnitude = static_cast<Tmagnitude>(mantissa);
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+			const auto shift = exponent * Tfloat::BASE_BITS + 64;
+			magnitude = shift >= 0 ? magnitude << shift
+			                       : (shift > -128 ? magnitude >> -shift : 0);
+		} else {
+			// Keeps 62 bits, so the magnitude shifted by 64 does not overflow.
+			constexpr auto limit = Tmagnitude(~std::uint64_t(0) >> 2);
+			if (magnitude > limit) {
+				exponent += Tfloat::shrink_digits(magnitude, limit);
+			}
+
+			using table = powers<Tmagnitude, Tfloat::EXPONENT_BASE()>;
+			if (exponent >= 0) {
+				magnitude = (magnitude * table::values[exponent]) << 64;
+			} else if (static_cast<std::size_t>(-exponent) < table::values.size()) {
+				magnitude = (magnitude << 64) / table::values[-exponent];
+			} else {
+				magnitude = 0;
+			}
+		}
+		return value._mantissa < 0 ? -static_cast<Twide>(magnitude)
+		                           : static_cast<Twide>(magnitude);
+	}
+
+	//! A value `value * 2 ^ -fraction` of 61 or 62 significant bits.
+	struct scaled {
+		Tvalue value;
+		int fraction;
+	};
+
+	//! @returns Whether `value`'s square is negligible, it is below `2 ^ -62`
+	//! in magnitude at least.
+	constexpr static bool is_tiny(const Tfloat &value) noexcept {
+		if constexpr (!Tfloat::BASE_IS_POWER_OF_TWO) {
+			// Otherwise `to_scaled` takes a power larger than 128 bits.
+			using table = powers<Tmagnitude, Tfloat::EXPONENT_BASE()>;
+			if (mantissa_of(value).second <=
+			    -static_cast<std::intmax_t>(table::values.size())) {
+				return true;
+			}
+		}
+		return binary_exponent(value) < -62;
+	}
+
+	//! @returns `value` scaled to 61 or 62 significant bits.
+	//!
+	//! @param value The value, needs to be `< 1` in magnitude and not
+	//!        `is_tiny`.
+	constexpr static scaled to_scaled(const Tfloat &value) noexcept {
+		const auto [mantissa, exponent] = mantissa_of(value);
+		const auto magnitude = static_cast<Tmagnitude>(mantissa);
+		const int width = bit_width(magnitude);
+		scaled result{};
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+			result = {static_cast<Tvalue>(width > 61 ? magnitude >> (width - 61)
+			                                         : magnitude << (61 - width)),
+			          static_cast<int>(61 - width - exponent * Tfloat::BASE_BITS)};
+		} else {
+			// Divides by the power's 64 leading bits.
+			using table = powers<Tmagnitude, Tfloat::EXPONENT_BASE()>;
+			auto power = table::values[-exponent];
+			const int dropped = std::max(bit_width(power) - 64, 0);
+			power >>= dropped;
+			const int shift = 61 + bit_width(power) - width;
+			result = {static_cast<Tvalue>((magnitude << shift) / power),
+			          shift + dropped};
+		}
+		if (value._mantissa < 0) {
+			result.value = -result.value;
+		}
+		return result;
+	}
+
+	//! @returns `value * 2 ^ -fraction * BASE ^ exponent`, truncated.
+	//!
+	//! @param value The value, needs to be `< 2 ^ 120` in magnitude.
+	//! @param fraction The binary digits after the point, may be negative, but
+	//!        not by more than the value's leading zeros.
+	//! @param exponent The exponent to BASE.
+	constexpr static Tfloat from_fixed(const Twide value, int fraction,
+	                                   std::intmax_t exponent) noexcept {
+		const auto negative = value < 0;
+		auto magnitude = negative ? Tmagnitude(0) - static_cast<Tmagnitude>(value)
+		                          : static_cast<Tmagnitude>(value);
+		if (magnitude == 0) {
+			return Tfloat::ZERO();
+		}
+		if (fraction < 0) {
+			magnitude <<= -fraction;
+			fraction = 0;
+		}
+
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+			// Aligns the point to whole digits.
+			const auto digits =
+			    (fraction + Tfloat::BASE_BITS - 1) / Tfloat::BASE_BITS;
+			magnitude <<= digits * Tfloat::BASE_BITS - fraction;
+			exponent -= digits;
+		} else {
+			// Trades the binary digits for those of BASE, by up to 64 at once.
+			using table = powers<Tmagnitude, Tfloat::EXPONENT_BASE()>;
+			while (fraction > 0) {
+				const auto digits =
+				    Tfloat::grow_digits(magnitude, static_cast<Tmagnitude>(-1));
+				const auto shift = std::min(fraction, 64);
+				magnitude = (magnitude * table::values[digits]) >> shift;
+				exponent -= digits;
+				fraction -= shift;
+			}
+		}
+		return Tfloat::from_magnitude(magnitude, negative, exponent);
+	}
+
+	//! @returns `e ^ value`.  Arguments beyond `2 ^ 62` in magnitude result in
+	//! infinity or zero.
+	constexpr static Tfloat exp(const Tfloat &value) noexcept {
+		switch (value.classify()) {
+		case classification::zero:
+			return Tfloat::ONE();
+		case classification::inf:
+		case classification::not_a_number:
+			return value;
+		case classification::negative_inf:
+			return Tfloat::ZERO();
+		case classification::finite:
+			break;
+		}
+
+		if (binary_exponent(value) > 62) {
+			return value._mantissa < 0 ? Tfloat::ZERO() : Tfloat::INF();
+		}
+
+		// `e ^ value == BASE ^ exponent * 2 ^ shift * e ^ remainder`.
+		std::intmax_t exponent = 0;
+		std::intmax_t shift = 0;
+		Twide remainder = 0;
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+			const auto twos = fixed::reduce(to_fixed(value), 64, fixed::LN2, 127);
+			exponent = twos.quotient / Tfloat::BASE_BITS;
+			shift = twos.quotient % Tfloat::BASE_BITS;
+			if (shift < 0) {
+				shift += Tfloat::BASE_BITS;
+				--exponent;
+			}
+			remainder = twos.remainder;
+		} else {
+			const auto digits =
+			    fixed::reduce(to_fixed(value), 64, LN_BASE, LN_BASE_FRACTION);
+			const auto twos = fixed::reduce(digits.remainder, 64, fixed::LN2, 127);
+			exponent = digits.quotient;
+			shift = twos.quotient;
+			remainder = twos.remainder;
+		}
+
+		const auto result = fixed::exp(
+		    static_cast<Tvalue>(remainder >> (64 - fixed::FRACTION)), NEGLIGIBLE);
+		return from_fixed(result, fixed::FRACTION - static_cast<int>(shift),
+		                  exponent);
+	}
+
+	//! @returns The natural logarithm of `value`, not a number for negative
+	//! values.
+	constexpr static Tfloat log(const Tfloat &value) noexcept {
+		switch (value.classify()) {
+		case classification::zero:
+			return Tfloat::NEGATIVE_INF();
+		case classification::inf:
+		case classification::not_a_number:
+			return value;
+		case classification::negative_inf:
+			return Tfloat::NOT_A_NUMBER();
+		case classification::finite:
+			break;
+		}
+
+		if (value._mantissa < 0) {
+			return Tfloat::NOT_A_NUMBER();
+		}
+
+		const auto [mantissa, exponent] = mantissa_of(value);
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO) {
+			return from_fixed(fixed::log(mantissa, exponent * Tfloat::BASE_BITS,
+			                             NEGLIGIBLE),
+			                  64, 0);
+		} else {
+			return from_fixed(
+			    fixed::log(mantissa, 0, NEGLIGIBLE) +
+			        exponent * static_cast<Twide>(LN_BASE >> (LN_BASE_FRACTION - 64)),
+			    64, 0);
+		}
+	}
+
+	//! An angle reduced by `quadrant * pi / 2`, so it is at most `pi / 4` in
+	//! magnitude, or `1` if it is not reduced at all.
+	struct angle {
+		//! The remainder.
+		scaled remainder;
+
+		//! The quadrant modulo 4.
+		int quadrant;
+	};
+
+	//! @returns `value` reduced by multiples of `pi / 2`.
+	//!
+	//! @param value The value, needs to be `< 2 ^ 62` in magnitude and not
+	//!        `is_tiny`.
+	constexpr static angle reduce_angle(const Tfloat &value) noexcept {
+		if (binary_exponent(value) <= 0) {
+			return {to_scaled(value), 0};
+		}
+
+		const auto reduced =
+		    fixed::reduce(to_fixed(value), 64, fixed::HALF_PI, 126);
+		const auto magnitude = reduced.remainder < 0 ? -reduced.remainder
+		                                             : reduced.remainder;
+		const int width = bit_width(static_cast<Tmagnitude>(magnitude));
+		const auto quadrant = static_cast<int>(reduced.quotient & 3);
+		if (width > 61) {
+			return {{static_cast<Tvalue>(reduced.remainder >> (width - 61)),
+			         64 - (width - 61)},
+			        quadrant};
+		}
+		return {{static_cast<Tvalue>(reduced.remainder *
+		                             (Twide(1) << (61 - width))),
+		         64 + (61 - width)},
+		        quadrant};
+	}
+
+	//! @returns `sin(value)` if `sine`, otherwise `cos(value)`.
+	constexpr static Tfloat sin_or_cos(const Tfloat &value,
+	                                   const bool sine) noexcept {
+		switch (value.classify()) {
+		case classification::zero:
+			return sine ? value : Tfloat::ONE();
+		case classification::inf:
+		case classification::negative_inf:
+			return Tfloat::NOT_A_NUMBER();
+		case classification::not_a_number:
+			return value;
+		case classification::finite:
+			break;
+		}
+
+		// Beyond `2 ^ 62` few multiples of `pi / 2` are representable at all.
+		if (binary_exponent(value) > 62) {
+			return Tfloat::NOT_A_NUMBER();
+		}
+		if (is_tiny(value)) {
+			return sine ? value : Tfloat::ONE();
+		}
+
+		const auto [remainder, quadrant] = reduce_angle(value);
+		const auto square_shift = 2 * remainder.fraction - fixed::FRACTION;
+		const auto square =
+		    square_shift < 127
+		        ? static_cast<Tvalue>((Twide(remainder.value) * remainder.value) >>
+		                              square_shift)
+		        : Tvalue(0);
+
+		// `cos(x) == sin(x + pi / 2)`, a quadrant further.
+		const auto turns = quadrant + !sine;
+		const auto negative = (turns & 2) != 0;
+		if (turns % 2 == 0) {
+			const auto result =
+			    fixed::mul(remainder.value, fixed::sinc(square, NEGLIGIBLE));
+			return from_fixed(negative ? -Twide(result) : Twide(result),
+			                  remainder.fraction, 0);
+		}
+		const auto result = fixed::cos(square, NEGLIGIBLE);
+		return from_fixed(negative ? -Twide(result) : Twide(result),
+		                  fixed::FRACTION, 0);
+	}
+#endif
+};
+
+} // namespace detail
+
+//! @returns The square root of `value`, not a number for negative values.
+//! See `detail::elementary` for the accuracy of this and the other functions.
+template <typename Tfloat,
+          typename = std::enable_if_t<detail::is_float<Tfloat>::value>>
+constexpr Tfloat sqrt(const Tfloat &value) noexcept {
+	return detail::elementary<Tfloat>::sqrt(value);
+}
+
+#if defined(__SIZEOF_INT128__)
+//! @returns `e ^ value`.
+template <typename Tfloat,
+          typename = std::enable_if_t<detail::is_float<Tfloat>::value>>
+constexpr Tfloat exp(const Tfloat &value) noexcept {
+	return detail::elementary<Tfloat>::exp(value);
+}
+
+//! @returns The natural logarithm of `value`, not a number for negative
+//! values.
+template <typename Tfloat,
+          typename = std::enable_if_t<detail::is_float<Tfloat>::value>>
+constexpr Tfloat log(const Tfloat &value) noexcept {
+	return detail::elementary<Tfloat>::log(value);
+}
+
+//! @returns The sine of `value` in radians, not a number for infinities and
+//! magnitudes of `2 ^ 62` and more.
+template <typename Tfloat,
+          typename = std::enable_if_t<detail::is_float<Tfloat>::value>>
+constexpr Tfloat sin(const Tfloat &value) noexcept {
+	return detail::elementary<Tfloat>::sin_or_cos(value, true);
+}
+
+//! @returns The cosine of `value` in radians, see `sin`.
+template <typename Tfloat,
+          typename = std::enable_if_t<detail::is_float<Tfloat>::value>>
+constexpr Tfloat cos(const Tfloat &value) noexcept {
+	return detail::elementary<Tfloat>::sin_or_cos(value, false);
+}
+#endif
+
+} // namespace fas
+#endif // FLOATING_POINT_MATH_HPP
@@ -0,0 +1,298 @@
+#ifndef FLOATING_POINT_PACKED_HPP
+#define FLOATING_POINT_PACKED_HPP
+#include "fas/float.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace fas {
+namespace detail {
+
+//! @returns The number of bits of a field holding every value of
+//!          `[lowest, max]`, in two's complement if `T` is signed.
+template <typename T> constexpr int field_bits(const T lowest, const T max) {
+	using Tunsigned = detail::magnitude_t<T>;
+
+	if constexpr (std::is_signed<T>::value) {
+		// The magnitude of a negative `lowest` may be one larger than `max`.
+		const auto negative =
+		    lowest < 0 ? Tunsigned(0) - static_cast<Tunsigned>(lowest) - 1 : 0;
+		const auto positive = max > 0 ? static_cast<Tunsigned>(max) : 0;
+		return 1 +
+		       std::max(detail::bit_width(negative), detail::bit_width(positive));
+	} else {
+		return std::max(1, detail::bit_width(static_cast<Tunsigned>(max)));
+	}
+}
+
+//! Converts `Tfloat` from and to the packed format.
+//!
+//! A packed value takes the fewest whole bytes holding both fields, in little
+//! endian order: The mantissa occupies the lowest `MANTISSA_BITS`, followed by
+//! the exponent's `EXPONENT_BITS`.  Either field holds its value in two's
+//! complement if its type is signed.  The remaining bits are zero.
+template <typename Tfloat> struct packing {
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+	using Texponent = std::remove_cv_t<decltype(Tfloat::MAX().exponent())>;
+
+	//! The bits of the mantissa's field.
+	constexpr static int MANTISSA_BITS =
+	    field_bits<Tmantissa>(Tfloat::LOWEST().mantissa(),
+	                          Tfloat::MAX().mantissa());
+
+	//! The bits of the exponent's field.  It also holds the exponents of the
+	//! special values, `0` to `3`.
+	constexpr static int EXPONENT_BITS = field_bits<Texponent>(
+	    std::min(Tfloat::MIN().exponent(), Texponent(0)),
+	    std::max(Tfloat::MAX().exponent(), Texponent(3)));
+
+	//! The bytes of a packed value.
+	constexpr static std::size_t SIZE = (MANTISSA_BITS + EXPONENT_BITS + 7) / 8;
+
+#if defined(__SIZEOF_INT128__)
+	//! Holds a packed value.
+	using record_t = std::conditional_t<(SIZE <= 8), std::uint64_t,
+	                                    unsigned __int128>;
+#else
+	using record_t = std::uint64_t;
+#endif
+	static_assert(MANTISSA_BITS + EXPONENT_BITS <= detail::digits<record_t>,
+	              "The packed format supports up to 64 bits, 128 bits if "
+	              "__int128 is available.");
+
+	//! @returns A mask of the lowest `bits` bits.
+	constexpr static record_t mask(const int bits) noexcept {
+		return (record_t(1) << bits) - 1;
+	}
+
+	//! @returns The field of `BITS` bits `field` as `T`.
+	template <typename T, int BITS>
+	constexpr static T extend(record_t field) noexcept {
+		if constexpr (std::is_signed<T>::value) {
+			if ((field >> (BITS - 1)) & 1) {
+				field |= ~mask(BITS);
+			}
+		}
+		return static_cast<T>(static_cast<typename make_unsigned<T>::type>(field));
+	}
+
+	//! Packs `value` into the `SIZE` bytes at `target`.
+	static void store(const Tfloat &value, std::byte *const target) noexcept {
+		using Tunsigned_mantissa = typename make_unsigned<Tmantissa>::type;
+		using Tunsigned_exponent = typename make_unsigned<Texponent>::type;
+
+		const auto mantissa = static_cast<record_t>(
+		    static_cast<Tunsigned_mantissa>(value._mantissa));
+		const auto exponent = static_cast<record_t>(
+		    static_cast<Tunsigned_exponent>(value._exponent));
+		const auto record = (mantissa & mask(MANTISSA_BITS)) |
+		                    ((exponent & mask(EXPONENT_BITS)) << MANTISSA_BITS);
+		for (std::size_t i = 0; i < SIZE; ++i) {
+			target[i] = static_cast<std::byte>(record >> (8 * i));
+		}
+	}
+
+	//! @returns The value packed into the `SIZE` bytes at `source`.
+	static Tfloat load(const std::byte *const source) noexcept {
+		record_t record = 0;
+		for (std::size_t i = 0; i < SIZE; ++i) {
+			record |= static_cast<record_t>(std::to_integer<unsigned>(source[i]))
+			          << (8 * i);
+		}
+		return Tfloat::of(
+		    extend<Tmantissa, MANTISSA_BITS>(record & mask(MANTISSA_BITS)),
+		    extend<Texponent, EXPONENT_BITS>((record >> MANTISSA_BITS) &
+		                                     mask(EXPONENT_BITS)));
+	}
+};
+
+} // namespace detail
+
+//! The number of bytes of a packed `Tfloat`, see `detail::packing` for the
+//! format.  For example `Float<int16_t, int8_t>` takes `3` bytes and
+//! `Float<int32_t, int8_t>` `5` bytes.
+template <typename Tfloat>
+constexpr std::size_t packed_size = detail::packing<Tfloat>::SIZE;
+
+//! Packs `count` values into `target`, which needs to hold
+//! `count * packed_size<Tfloat>` bytes.  No alignment is needed.
+//!
+//! @returns The end of the packed values.
+template <typename Tfloat>
+std::byte *pack(const Tfloat *const values, const std::size_t count,
+                std::byte *target) noexcept {
+	for (std::size_t i = 0; i < count; ++i, target += packed_size<Tfloat>) {
+		detail::packing<Tfloat>::store(values[i], target);
+	}
+	return target;
+}
+
+//! Unpacks `count` values from `source`, which holds
+//! `count * packed_size<Tfloat>` bytes, into `target`.  No alignment is
+//! needed.
+//!
+//! @returns The end of the unpacked bytes.
+template <typename Tfloat>
+const std::byte *unpack(const std::byte *source, const std::size_t count,
+                        Tfloat *const target) noexcept {
+	for (std::size_t i = 0; i < count; ++i, source += packed_size<Tfloat>) {
+		target[i] = detail::packing<Tfloat>::load(source);
+	}
+	return source;
+}
+
+//! A read-only view of packed values, for example of a memory mapped file.
+//! The values are unpacked on access, so neither a copy nor a deserialization
+//! pass is needed, and the buffer needs no alignment.
+//!
+//! @tparam Tfloat The `Float` type of the values.
+template <typename Tfloat> class PackedView {
+	//! The packed values.
+	const std::byte *_data = nullptr;
+
+	//! The number of values.
+	std::size_t _size = 0;
+
+public:
+	//! Iterates over the values, which are unpacked on dereferencing.  Hence
+	//! `*iterator` returns a value, not a reference.
+	class iterator {
+		const std::byte *_position = nullptr;
+
+	public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = Tfloat;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = Tfloat;
+
+		iterator() = default;
+
+		//! Points to the value packed at `position`.
+		explicit iterator(const std::byte *const position) noexcept
+		    : _position(position) {}
+
+		Tfloat operator*() const noexcept {
+			return detail::packing<Tfloat>::load(_position);
+		}
+
+		Tfloat operator[](const difference_type n) const noexcept {
+			return *(*this + n);
+		}
+
+		iterator &operator+=(const difference_type n) noexcept {
+			_position += n * static_cast<difference_type>(packed_size<Tfloat>);
+			return *this;
+		}
+
+		iterator &operator-=(const difference_type n) noexcept {
+			return *this += -n;
+		}
+
+		iterator &operator++() noexcept { return *this += 1; }
+
+		iterator &operator--() noexcept { return *this -= 1; }
+
+		iterator operator++(int) noexcept {
+			auto result = *this;
+			++*this;
+			return result;
+		}
+
+		iterator operator--(int) noexcept {
+			auto result = *this;
+			--*this;
+			return result;
+		}
+
+		friend iterator operator+(iterator target,
+		                          const difference_type n) noexcept {
+			return target += n;
+		}
+
+		friend iterator operator+(const difference_type n,
+		                          iterator target) noexcept {
+			return target += n;
+		}
+
+		friend iterator operator-(iterator target,
+		                          const difference_type n) noexcept {
+			return target -= n;
+		}
+
+		friend difference_type operator-(const iterator &first,
+		                                 const iterator &second) noexcept {
+			return (first._position - second._position) /
+			       static_cast<difference_type>(packed_size<Tfloat>);
+		}
+
+		friend bool operator==(const iterator &first,
+		                       const iterator &second) noexcept {
+			return first._position == second._position;
+		}
+
+		friend bool operator!=(const iterator &first,
+		                       const iterator &second) noexcept {
+			return first._position != second._position;
+		}
+
+		friend bool operator<(const iterator &first,
+		                      const iterator &second) noexcept {
+			return first._position < second._position;
+		}
+
+		friend bool operator>(const iterator &first,
+		                      const iterator &second) noexcept {
+			return first._position > second._position;
+		}
+
+		friend bool operator<=(const iterator &first,
+		                       const iterator &second) noexcept {
+			return first._position <= second._position;
+		}
+
+		friend bool operator>=(const iterator &first,
+		                       const iterator &second) noexcept {
+			return first._position >= second._position;
+		}
+	};
+
+	using value_type = Tfloat;
+	using const_iterator = iterator;
+
+	//! Creates an empty view.
+	PackedView() = default;
+
+	//! Creates a view of `size` values packed at `data`.
+	PackedView(const void *const data, const std::size_t size) noexcept
+	    : _data(static_cast<const std::byte *>(data)), _size(size) {}
+
+	//! @returns The number of values.
+	std::size_t size() const noexcept { return _size; }
+
+	//! @returns Whether there are no values.
+	bool empty() const noexcept { return _size == 0; }
+
+	//! @returns The packed values.
+	const std::byte *data() const noexcept { return _data; }
+
+	//! @returns The number of bytes of the packed values.
+	std::size_t size_bytes() const noexcept {
+		return _size * packed_size<Tfloat>;
+	}
+
+	//! @returns The value at the given index, which needs to be `< size()`.
+	Tfloat operator[](const std::size_t index) const noexcept {
+		return detail::packing<Tfloat>::load(_data + index * packed_size<Tfloat>);
+	}
+
+	iterator begin() const noexcept { return iterator(_data); }
+
+	iterator end() const noexcept { return iterator(_data + size_bytes()); }
+};
+
+} // namespace fas
+#endif // FLOATING_POINT_PACKED_HPP
@@ -0,0 +1,382 @@
+#ifndef FLOATING_POINT_REDUCE_HPP
+#define FLOATING_POINT_REDUCE_HPP
+#include "fas/accumulator.hpp"
+#include "fas/expr.hpp"
+#include "fas/float.hpp"
+#include "fas/math.hpp"
+#include "fas/vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fas {
+namespace detail {
+
+//! Evaluates sums, dot products and norms of ranges of `Tfloat`.
+//!
+//! A range is split into blocks of `BLOCK` values, which threads pick to sum.
+//! If `IS_EXACT`, each thread sums its blocks by an `Accumulator`.  Otherwise
+//! each block is summed on its own and the blocks' sums are added in their
+//! order.  Either way, the result does not depend on the number of threads.
+//!
+//! @tparam Tfloat The `Float` type to reduce.
+template <typename Tfloat> struct reduction {
+	//! The float's mantissa type.
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+
+	//! The float's exponent type.
+	using Texponent = std::remove_cv_t<decltype(Tfloat::MAX().exponent())>;
+
+	//! The type of the intermediate sums.
+	using Tsum = unnormalized<Tfloat>;
+
+	//! The type of the intermediate sums' mantissas.
+	using Tstorage = typename Tsum::Tstorage;
+
+	//! The type holding a block's sum in fixed point, of the quadrupled
+	//! mantissa width if available.
+	using Tfixed = std::conditional_t<
+	    std::is_void<typename wider<Tstorage>::type>::value, Tstorage,
+	    typename wider<Tstorage>::type>;
+
+	//! The number of values per block.
+	constexpr static std::size_t BLOCK = 256;
+
+	//! The binary digits of `BLOCK`, which a block's sum may carry.
+	constexpr static int BLOCK_BITS = 8;
+
+	//! The least number of blocks per thread.  Fewer are summed faster than a
+	//! thread starts.
+	constexpr static std::size_t BLOCKS_PER_THREAD = 64;
+
+	//! Whether blocks of finite values are summed in fixed point, see
+	//! `sum_block`.
+	constexpr static bool IS_FIXED =
+	    Tsum::IS_WIDE && Tfloat::BASE_IS_POWER_OF_TWO;
+
+	//! Whether the terms are summed exactly by an `Accumulator`, which is the
+	//! case for floats of up to 32 bit mantissas, 8 bit exponents and a power
+	//! of two as BASE.
+	constexpr static bool IS_EXACT = [] {
+		if constexpr (Tfloat::BASE_IS_POWER_OF_TWO &&
+		              !std::is_void<typename wider<Tmantissa>::type>::value) {
+			return Accumulator<Tfloat>::SIZE <= 64;
+		} else {
+			return false;
+		}
+	}();
+
+	//! The magnitude of a fixed point sum.
+	using Tunsigned = typename make_unsigned<Tfixed>::type;
+
+	//! @returns The magnitude of `value`.
+	constexpr static Tunsigned magnitude_of(const Tfixed value) noexcept {
+		return value < 0 ? Tunsigned(0) - static_cast<Tunsigned>(value)
+		                 : static_cast<Tunsigned>(value);
+	}
+
+	//! Reads the values of an array of floats.
+	struct array_terms {
+		const Tfloat *values;
+
+		//! The binary digits of a term's magnitude.
+		constexpr static int DIGITS =
+		    digits<typename make_unsigned<Tmantissa>::type>;
+
+		Tfixed mantissa(const std::size_t i) const noexcept {
+			return values[i]._mantissa;
+		}
+
+		std::intmax_t exponent(const std::size_t i) const noexcept {
+			return values[i]._exponent;
+		}
+
+		Tfloat at(const std::size_t i) const noexcept { return values[i]; }
+
+		Tsum value(const std::size_t i) const noexcept { return Tsum(at(i)); }
+
+		template <typename Taccumulator>
+		void accumulate(Taccumulator &target, const std::size_t i) const noexcept {
+			target.add(at(i));
+		}
+	};
+
+	//! Reads the values of the arrays of a `FloatVector`.
+	struct vector_terms {
+		const Tmantissa *mantissas;
+		const Texponent *exponents;
+
+		constexpr static int DIGITS = array_terms::DIGITS;
+
+		Tfixed mantissa(const std::size_t i) const noexcept {
+			return mantissas[i];
+		}
+
+		std::intmax_t exponent(const std::size_t i) const noexcept {
+			return exponents[i];
+		}
+
+		Tfloat at(const std::size_t i) const noexcept {
+			return Tfloat::of(mantissas[i], exponents[i]);
+		}
+
+		Tsum value(const std::size_t i) const noexcept { return Tsum(at(i)); }
+
+		template <typename Taccumulator>
+		void accumulate(Taccumulator &target, const std::size_t i) const noexcept {
+			target.add(at(i));
+		}
+	};
+
+	//! Reads the products of the terms of `first` and `second`.
+	template <typename Tterms> struct product_terms {
+		Tterms first;
+		Tterms second;
+
+		constexpr static int DIGITS = 2 * Tterms::DIGITS;
+
+		Tfixed mantissa(const std::size_t i) const noexcept {
+			return first.mantissa(i) * second.mantissa(i);
+		}
+
+		std::intmax_t exponent(const std::size_t i) const noexcept {
+			return first.exponent(i) + second.exponent(i);
+		}
+
+		Tsum value(const std::size_t i) const noexcept {
+			return first.value(i) * second.value(i);
+		}
+
+		template <typename Taccumulator>
+		void accumulate(Taccumulator &target, const std::size_t i) const noexcept {
+			target.add_product(first.at(i), second.at(i));
+		}
+	};
+
+	//! @returns The sum of the terms `[first, last)`.
+	//!
+	//! Unless a term is a special value, the terms are summed in fixed point:
+	//! Its lowest digit is chosen from the largest exponent, such that
+	//! `BLOCK` terms sum up without overflowing.  Digits below are truncated
+	//! towards zero term by term, which keeps at least the mantissa's digits of
+	//! the largest term.  Otherwise the terms are summed without normalizing,
+	//! see `detail::unnormalized`.
+	template <typename Tterms>
+	static Tsum sum_block(const Tterms &terms, const std::size_t first,
+	                      const std::size_t last) noexcept {
+		if constexpr (IS_FIXED) {
+			constexpr int width = digits<Tfixed>;
+
+			// Special values have a zero mantissa and a non-zero exponent.
+			constexpr auto none = std::numeric_limits<std::intmax_t>::lowest();
+			auto top = none;
+			bool special = false;
+			for (auto i = first; i < last; ++i) {
+				const auto mantissa = terms.mantissa(i);
+				const auto exponent = terms.exponent(i);
+				special |= mantissa == 0 && exponent != 0;
+				top = mantissa != 0 && exponent > top ? exponent : top;
+			}
+
+			if (!special) {
+				if (top == none) {
+					return Tsum(Tfloat::ZERO());
+				}
+
+				// The binary digits, by which the largest term may grow.  The lowest
+				// digit is rounded up to a whole digit of BASE.
+				constexpr int headroom = width - 1 - BLOCK_BITS - Tterms::DIGITS;
+				constexpr int headroom_digits =
+				    headroom >= 0 ? headroom / Tfloat::BASE_BITS
+				                  : -((Tfloat::BASE_BITS - 1 - headroom) /
+				                      Tfloat::BASE_BITS);
+				const auto lowest = top - headroom_digits;
+
+				Tfixed result = 0;
+				for (auto i = first; i < last; ++i) {
+					const auto mantissa = terms.mantissa(i);
+					const auto shift =
+					    (terms.exponent(i) - lowest) * Tfloat::BASE_BITS;
+					const auto magnitude = magnitude_of(mantissa);
+					const auto shifted =
+					    shift >= 0
+					        ? magnitude << shift
+					        : magnitude >> std::min<std::intmax_t>(-shift, width - 1);
+					result += mantissa < 0 ? -static_cast<Tfixed>(shifted)
+					                       : static_cast<Tfixed>(shifted);
+				}
+
+				// Truncates the sum to the intermediate sums' width.
+				auto magnitude = magnitude_of(result);
+				const auto digits =
+				    magnitude > Tsum::SUM_LIMIT
+				        ? Tfloat::shrink_digits(magnitude, Tunsigned(Tsum::SUM_LIMIT))
+				        : 0;
+				const auto mantissa = static_cast<Tstorage>(magnitude);
+				return Tsum(result < 0 ? -mantissa : mantissa, lowest + digits);
+			}
+		}
+
+		auto result = terms.value(first);
+		for (auto i = first + 1; i < last; ++i) {
+			result = result + terms.value(i);
+		}
+		return result;
+	}
+
+	//! Runs `work(shard, first, last)` for the blocks `[first, last)` of each
+	//! of `threads` shards, each on its own thread.  The calling thread works
+	//! on the first shard.
+	template <typename Twork>
+	static void run(const std::size_t blocks, const unsigned threads,
+	                const Twork &work) {
+		const auto first = [blocks, threads](const unsigned shard) {
+			return blocks * shard / threads;
+		};
+
+		std::vector<std::thread> workers;
+		workers.reserve(threads - 1);
+		for (unsigned shard = 1; shard < threads; ++shard) {
+			try {
+				workers.emplace_back(work, shard, first(shard), first(shard + 1));
+			} catch (const std::system_error &) {
+				work(shard, first(shard), first(shard + 1));
+			}
+		}
+		work(0u, first(0), first(1));
+		for (auto &worker : workers) {
+			worker.join();
+		}
+	}
+
+	//! @returns The sum of the first `count` terms.
+	//!
+	//! @param threads The number of threads, `0` for one per processor.
+	template <typename Tterms>
+	static Tfloat sum(const Tterms &terms, const std::size_t count,
+	                  unsigned threads) {
+		const auto blocks = (count + BLOCK - 1) / BLOCK;
+		if (blocks == 0) {
+			return Tfloat::ZERO();
+		}
+
+		if (threads == 0) {
+			threads = std::max(1u, std::thread::hardware_concurrency());
+		}
+		threads = static_cast<unsigned>(std::min<std::size_t>(
+		    threads, std::max<std::size_t>(1, blocks / BLOCKS_PER_THREAD)));
+
+		if constexpr (IS_EXACT) {
+			std::vector<Accumulator<Tfloat>> sums(threads);
+			run(blocks, threads,
+			    [&terms, &sums, count](const unsigned shard, const std::size_t first,
+			                           const std::size_t last) {
+				    // Avoids sharing the accumulators' cache lines while summing.
+				    Accumulator<Tfloat> result;
+				    const auto end = std::min(count, last * BLOCK);
+				    for (auto i = first * BLOCK; i < end; ++i) {
+					    terms.accumulate(result, i);
+				    }
+				    sums[shard] = result;
+			    });
+
+			for (unsigned shard = 1; shard < threads; ++shard) {
+				sums[0].merge(sums[shard]);
+			}
+			return sums[0].result();
+		} else {
+			std::vector<Tsum> sums(blocks, Tsum(Tfloat::ZERO()));
+			run(blocks, threads,
+			    [&terms, &sums, count](unsigned, const std::size_t first,
+			                           const std::size_t last) {
+				    for (auto block = first; block < last; ++block) {
+					    sums[block] = sum_block(terms, block * BLOCK,
+					                            std::min(count, (block + 1) * BLOCK));
+				    }
+			    });
+
+			auto result = sums[0];
+			for (std::size_t block = 1; block < blocks; ++block) {
+				result = result + sums[block];
+			}
+			return result.value();
+		}
+	}
+};
+
+} // namespace detail
+
+//! @returns The sum of the `count` values at `values`, which are summed block
+//! by block on `threads` threads, `0` for one per processor.  Floats of up to
+//! 32 bit mantissas, 8 bit exponents and a power of two as BASE are summed
+//! exactly by an `Accumulator`.  Otherwise neither sum is normalized, see
+//! `detail::reduction::sum_block`.  Either way, the total gets truncated once
+//! and does not depend on the number of threads.
+template <typename Tfloat>
+Tfloat reduce_sum(const Tfloat *const values, const std::size_t count,
+                  const unsigned threads = 0) {
+	using reduction = detail::reduction<Tfloat>;
+	return reduction::sum(typename reduction::array_terms{values}, count,
+	                      threads);
+}
+
+//! @returns The sum of the values of `values`, see the other `reduce_sum`.
+template <typename Tfloat>
+Tfloat reduce_sum(const FloatVector<Tfloat> &values,
+                  const unsigned threads = 0) {
+	using reduction = detail::reduction<Tfloat>;
+	return reduction::sum(
+	    typename reduction::vector_terms{values.mantissas(), values.exponents()},
+	    values.size(), threads);
+}
+
+//! @returns The sum of the products of the `count` values at `first` and
+//! `second`.  Each product is exact if the mantissa has a doubled width type,
+//! the products are summed like by `reduce_sum`.
+template <typename Tfloat>
+Tfloat dot(const Tfloat *const first, const Tfloat *const second,
+           const std::size_t count, const unsigned threads = 0) {
+	using reduction = detail::reduction<Tfloat>;
+	using terms = typename reduction::array_terms;
+	return reduction::sum(
+	    typename reduction::template product_terms<terms>{{first}, {second}},
+	    count, threads);
+}
+
+//! @returns The dot product of the common values of `first` and `second`,
+//! see the other `dot`.
+template <typename Tfloat>
+Tfloat dot(const FloatVector<Tfloat> &first, const FloatVector<Tfloat> &second,
+           const unsigned threads = 0) {
+	using reduction = detail::reduction<Tfloat>;
+	using terms = typename reduction::vector_terms;
+	return reduction::sum(
+	    typename reduction::template product_terms<terms>{
+	        {first.mantissas(), first.exponents()},
+	        {second.mantissas(), second.exponents()}},
+	    std::min(first.size(), second.size()), threads);
+}
+
+//! @returns The euclidean norm of the `count` values at `values`, the square
+//! root of their `dot` product with themselves, see `sqrt`.
+template <typename Tfloat>
+Tfloat norm2(const Tfloat *const values, const std::size_t count,
+             const unsigned threads = 0) {
+	return fas::sqrt(dot(values, values, count, threads));
+}
+
+//! @returns The euclidean norm of the values of `values`, see the other
+//! `norm2`.
+template <typename Tfloat>
+Tfloat norm2(const FloatVector<Tfloat> &values, const unsigned threads = 0) {
+	return fas::sqrt(dot(values, values, threads));
+}
+
+} // namespace fas
+#endif // FLOATING_POINT_REDUCE_HPP
@@ -0,0 +1,413 @@
+#ifndef FLOATING_POINT_SIMD_HPP
+#define FLOATING_POINT_SIMD_HPP
+#include "fas/float.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__)) && !defined(FAS_FREESTANDING)
+#define FAS_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace fas {
+namespace detail {
+namespace simd {
+
+//! Kernels processing arrays of mantissas and exponents, as stored by
+//! `FloatVector`.  Each kernel processes blocks of `WIDTH` values and stops
+//! at the first block, which it can not process or which is incomplete.  The
+//! remaining block is left to the scalar operators.  Kernels produce the
+//! same results as the scalar operators, bit for bit.
+//!
+//! This version provides no kernels.
+//!
+//! @tparam Tfloat The `Float` type to process.
+template <typename Tfloat> struct kernels {
+	//! Whether there are any kernels.
+	constexpr static bool ENABLED = false;
+};
+
+#if defined(FAS_SIMD_AVX2)
+
+//! @returns Whether the processor supports AVX2.
+inline bool has_avx2() noexcept {
+	static const bool result = __builtin_cpu_supports("avx2");
+	return result;
+}
+
+//! AVX2 kernels for `Float<int16_t, int8_t>`, processing 8 values per block.
+//! Blocks containing special values are left to the scalar operators.
+struct avx2 {
+	//! The number of values per block.
+	constexpr static std::size_t WIDTH = 8;
+
+	//! @returns The number of binary digits of each value in `[1, 2 ^ 30]`.
+	__attribute__((target("avx2"))) static __m256i
+	bit_width(const __m256i value) noexcept {
+		// The float's exponent is the bit width, unless rounding carried into
+		// the next power of two.
+		const auto as_float = _mm256_castps_si256(_mm256_cvtepi32_ps(value));
+		auto result = _mm256_sub_epi32(_mm256_srli_epi32(as_float, 23),
+		                               _mm256_set1_epi32(126));
+		const auto power = _mm256_sllv_epi32(
+		    _mm256_set1_epi32(1), _mm256_sub_epi32(result, _mm256_set1_epi32(1)));
+		return _mm256_add_epi32(result, _mm256_cmpgt_epi32(power, value));
+	}
+
+	//! Normalizes each `magnitude * 2 ^ exponent` like `Float::from_magnitude`
+	//! does and stores the results.
+	//!
+	//! @param magnitude The magnitudes, each in `[0, 2 ^ 30]`.
+	//! @param negative The lanes, whose values are negative.
+	//! @param exponent The exponents, each in `[-2 ^ 24, 2 ^ 24]`.
+	__attribute__((target("avx2"))) static void
+	store(const __m256i magnitude, const __m256i negative,
+	      const __m256i exponent, std::int16_t *mantissas,
+	      std::int8_t *exponents) noexcept {
+		const auto one = _mm256_set1_epi32(1);
+		const auto limit = _mm256_sub_epi32(_mm256_set1_epi32(0x7fff), negative);
+		const auto limit_width = _mm256_sub_epi32(_mm256_set1_epi32(15), negative);
+
+		// Shifts by the difference of the bit widths, which is at most one digit
+		// too little.
+		auto digits = _mm256_sub_epi32(bit_width(magnitude), limit_width);
+		auto shifted = _mm256_blendv_epi8(
+		    _mm256_sllv_epi32(magnitude, _mm256_sub_epi32(_mm256_setzero_si256(),
+		                                                  digits)),
+		    _mm256_srlv_epi32(magnitude, digits),
+		    _mm256_cmpgt_epi32(digits, _mm256_setzero_si256()));
+		const auto too_large = _mm256_cmpgt_epi32(shifted, limit);
+		shifted = _mm256_blendv_epi8(shifted, _mm256_srli_epi32(shifted, 1),
+		                             too_large);
+		digits = _mm256_sub_epi32(digits, too_large);
+
+		// Shrinking the lowest magnitudes leaves them a digit short, then they
+		// truncate to the limit one digit lower, see `Float::from_magnitude`.
+		const auto short_digit = _mm256_and_si256(
+		    too_large,
+		    _mm256_cmpeq_epi32(_mm256_slli_epi32(shifted, 1), limit));
+		shifted = _mm256_blendv_epi8(shifted, limit, short_digit);
+		digits = _mm256_add_epi32(digits, short_digit);
+
+		const auto result_exponent = _mm256_add_epi32(exponent, digits);
+		const auto zero = _mm256_or_si256(
+		    _mm256_cmpeq_epi32(magnitude, _mm256_setzero_si256()),
+		    _mm256_cmpgt_epi32(_mm256_set1_epi32(-128), result_exponent));
+		const auto infinite =
+		    _mm256_cmpgt_epi32(result_exponent, _mm256_set1_epi32(127));
+
+		// Zero has the exponent 0, INF 1 and NEGATIVE_INF 2.
+		const auto special = _mm256_or_si256(zero, infinite);
+		auto mantissa = _mm256_blendv_epi8(
+		    shifted, _mm256_sub_epi32(_mm256_setzero_si256(), shifted), negative);
+		mantissa = _mm256_andnot_si256(special, mantissa);
+		const auto special_exponent =
+		    _mm256_andnot_si256(zero, _mm256_sub_epi32(one, negative));
+		const auto final_exponent =
+		    _mm256_blendv_epi8(result_exponent, special_exponent, special);
+
+		const auto packed_mantissas =
+		    _mm_packs_epi32(_mm256_castsi256_si128(mantissa),
+		                    _mm256_extracti128_si256(mantissa, 1));
+		const auto packed_exponents =
+		    _mm_packs_epi32(_mm256_castsi256_si128(final_exponent),
+		                    _mm256_extracti128_si256(final_exponent, 1));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(mantissas), packed_mantissas);
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(exponents),
+		                 _mm_packs_epi16(packed_exponents, packed_exponents));
+	}
+
+	//! @returns The mantissas at the given address, widened to 32 bits.
+	__attribute__((target("avx2"))) static __m256i
+	load(const std::int16_t *mantissas) noexcept {
+		return _mm256_cvtepi16_epi32(
+		    _mm_loadu_si128(reinterpret_cast<const __m128i *>(mantissas)));
+	}
+
+	//! @returns The exponents at the given address, widened to 32 bits.
+	__attribute__((target("avx2"))) static __m256i
+	load(const std::int8_t *exponents) noexcept {
+		return _mm256_cvtepi8_epi32(
+		    _mm_loadl_epi64(reinterpret_cast<const __m128i *>(exponents)));
+	}
+
+	//! @returns Whether any of the given mantissas is zero.
+	__attribute__((target("avx2"))) static bool
+	any_zero(const __m256i first, const __m256i second) noexcept {
+		const auto zero = _mm256_setzero_si256();
+		return !_mm256_testz_si256(
+		    _mm256_or_si256(_mm256_cmpeq_epi32(first, zero),
+		                    _mm256_cmpeq_epi32(second, zero)),
+		    _mm256_set1_epi32(-1));
+	}
+
+	//! The binary digits, which the larger summand takes below its mantissa.
+	//! Since mantissas of larger exponents are normalized, the sum of the
+	//! shifted magnitudes is exact, unless the smaller one gets shifted out.
+	constexpr static int GUARD = 14;
+
+	//! Adds the values like `Float::operator+` does, which truncates the exact
+	//! sum towards zero once, see `Float::rounded_sum`.
+	//!
+	//! @returns The number of values processed.
+	__attribute__((target("avx2"))) static std::size_t
+	add(const std::int16_t *first_mantissas, const std::int8_t *first_exponents,
+	    const std::int16_t *second_mantissas, const std::int8_t *second_exponents,
+	    std::int16_t *result_mantissas, std::int8_t *result_exponents,
+	    const std::size_t size) noexcept {
+		const auto zero = _mm256_setzero_si256();
+		const auto guard = _mm256_set1_epi32(GUARD);
+		std::size_t i = 0;
+		for (; i + WIDTH <= size; i += WIDTH) {
+			const auto first = load(first_mantissas + i);
+			const auto second = load(second_mantissas + i);
+			if (any_zero(first, second)) {
+				break;
+			}
+
+			const auto first_exponent = load(first_exponents + i);
+			const auto second_exponent = load(second_exponents + i);
+			const auto swap = _mm256_cmpgt_epi32(second_exponent, first_exponent);
+			const auto larger = _mm256_blendv_epi8(first, second, swap);
+			const auto smaller = _mm256_blendv_epi8(second, first, swap);
+			const auto exponent = _mm256_max_epi32(first_exponent, second_exponent);
+			const auto shift = _mm256_sub_epi32(
+			    exponent, _mm256_min_epi32(first_exponent, second_exponent));
+
+			// Shifting by negative counts, which are huge unsigned ones, results
+			// in zero, so only one of both shifts applies.
+			const auto magnitude = _mm256_abs_epi32(smaller);
+			const auto up = _mm256_sub_epi32(guard, shift);
+			const auto down = _mm256_sub_epi32(shift, guard);
+			const auto aligned = _mm256_or_si256(_mm256_sllv_epi32(magnitude, up),
+			                                     _mm256_srlv_epi32(magnitude, down));
+
+			// Truncating the difference towards zero takes one more, if any
+			// digits were shifted out.
+			const auto dropped = _mm256_andnot_si256(
+			    _mm256_cmpeq_epi32(
+			        _mm256_sllv_epi32(_mm256_srlv_epi32(magnitude, down), down),
+			        magnitude),
+			    _mm256_cmpgt_epi32(shift, guard));
+			const auto opposite =
+			    _mm256_cmpgt_epi32(zero, _mm256_xor_si256(larger, smaller));
+			const auto taken =
+			    _mm256_sub_epi32(aligned, _mm256_and_si256(opposite, dropped));
+
+			// Both terms are within `[-2 ^ 29, 2 ^ 29]`.
+			const auto sum = _mm256_add_epi32(_mm256_slli_epi32(larger, GUARD),
+			                                  _mm256_sign_epi32(taken, smaller));
+			store(_mm256_abs_epi32(sum), _mm256_cmpgt_epi32(zero, sum),
+			      _mm256_sub_epi32(exponent, guard), result_mantissas + i,
+			      result_exponents + i);
+		}
+		return i;
+	}
+
+	//! Multiplies the values like `Float::operator*` does.
+	//!
+	//! @returns The number of values processed.
+	__attribute__((target("avx2"))) static std::size_t
+	mul(const std::int16_t *first_mantissas, const std::int8_t *first_exponents,
+	    const std::int16_t *second_mantissas, const std::int8_t *second_exponents,
+	    std::int16_t *result_mantissas, std::int8_t *result_exponents,
+	    const std::size_t size) noexcept {
+		std::size_t i = 0;
+		for (; i + WIDTH <= size; i += WIDTH) {
+			const auto first = load(first_mantissas + i);
+			const auto second = load(second_mantissas + i);
+			if (any_zero(first, second)) {
+				break;
+			}
+
+			const auto product = _mm256_mullo_epi32(first, second);
+			store(_mm256_abs_epi32(product),
+			      _mm256_cmpgt_epi32(_mm256_setzero_si256(), product),
+			      _mm256_add_epi32(load(first_exponents + i),
+			                       load(second_exponents + i)),
+			      result_mantissas + i, result_exponents + i);
+		}
+		return i;
+	}
+
+	//! @returns The lower 32 bits of each lane of `low` and `high`, in order.
+	__attribute__((target("avx2"))) static __m256i
+	narrow(const __m256i low, const __m256i high) noexcept {
+		const auto order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+		return _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(low, order),
+		                                 _mm256_permutevar8x32_epi32(high, order),
+		                                 0x20);
+	}
+
+	//! @returns The highest 30 of the 53 digits of the doubles' significands,
+	//! which suffice since truncating twice equals truncating once.  Subnormal
+	//! values are far below the smallest float, so they are flushed to zero.
+	//!
+	//! @param bits The doubles' bits.
+	//! @param biased The doubles' biased exponents, still shifted by 52 bits.
+	__attribute__((target("avx2"))) static __m256i
+	significand(const __m256i bits, const __m256i biased) noexcept {
+		const auto digits = _mm256_srli_epi64(
+		    _mm256_or_si256(
+		        _mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffff)),
+		        _mm256_set1_epi64x(0x0010000000000000)),
+		    23);
+		return _mm256_andnot_si256(
+		    _mm256_cmpeq_epi64(biased, _mm256_setzero_si256()), digits);
+	}
+
+	//! Converts the doubles like `Float(double)` does.  Blocks containing
+	//! infinities or NaNs are left to the scalar constructor.
+	//!
+	//! @returns The number of values processed.
+	__attribute__((target("avx2"))) static std::size_t
+	from_double(const double *source, std::int16_t *mantissas,
+	            std::int8_t *exponents, const std::size_t size) noexcept {
+		const auto exponent_mask = _mm256_set1_epi64x(0x7ff0000000000000);
+
+		std::size_t i = 0;
+		for (; i + WIDTH <= size; i += WIDTH) {
+			const auto low =
+			    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+			const auto high = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i *>(source + i + WIDTH / 2));
+			const auto low_biased = _mm256_and_si256(low, exponent_mask);
+			const auto high_biased = _mm256_and_si256(high, exponent_mask);
+			if (!_mm256_testz_si256(
+			        _mm256_or_si256(_mm256_cmpeq_epi64(low_biased, exponent_mask),
+			                        _mm256_cmpeq_epi64(high_biased, exponent_mask)),
+			        _mm256_set1_epi32(-1))) {
+				break;
+			}
+
+			const auto magnitude = narrow(significand(low, low_biased),
+			                              significand(high, high_biased));
+			const auto negative = _mm256_sub_epi32(
+			    _mm256_setzero_si256(),
+			    narrow(_mm256_srli_epi64(low, 63), _mm256_srli_epi64(high, 63)));
+
+			// The value is `magnitude * 2 ^ (biased - 1075 + 23)`.
+			const auto exponent = _mm256_sub_epi32(
+			    narrow(_mm256_srli_epi64(low_biased, 52),
+			           _mm256_srli_epi64(high_biased, 52)),
+			    _mm256_set1_epi32(1075 - 23));
+			store(magnitude, negative, exponent, mantissas + i, exponents + i);
+		}
+		return i;
+	}
+
+	//! @returns Each `mantissa * 2 ^ exponent` as a double, which is exact,
+	//! since any `2 ^ exponent` is a normal double.
+	__attribute__((target("avx2"))) static __m256d
+	convert(const __m128i mantissa, const __m128i exponent) noexcept {
+		const auto power = _mm256_slli_epi64(
+		    _mm256_add_epi64(_mm256_cvtepi32_epi64(exponent),
+		                     _mm256_set1_epi64x(1023)),
+		    52);
+		return _mm256_mul_pd(_mm256_cvtepi32_pd(mantissa),
+		                     _mm256_castsi256_pd(power));
+	}
+
+	//! Converts the values like `Float::operator double` does, which is exact.
+	//! Blocks containing infinities or NaNs are left to the scalar operator.
+	//!
+	//! @returns The number of values processed.
+	__attribute__((target("avx2"))) static std::size_t
+	to_double(const std::int16_t *mantissas, const std::int8_t *exponents,
+	          double *target, const std::size_t size) noexcept {
+		std::size_t i = 0;
+		for (; i + WIDTH <= size; i += WIDTH) {
+			const auto mantissa = load(mantissas + i);
+			const auto exponent = load(exponents + i);
+
+			// Their mantissas are zero and their exponents `1` to `3`.
+			const auto special = _mm256_and_si256(
+			    _mm256_cmpeq_epi32(mantissa, _mm256_setzero_si256()),
+			    _mm256_and_si256(
+			        _mm256_cmpgt_epi32(exponent, _mm256_setzero_si256()),
+			        _mm256_cmpgt_epi32(_mm256_set1_epi32(4), exponent)));
+			if (!_mm256_testz_si256(special, special)) {
+				break;
+			}
+
+			_mm256_storeu_pd(target + i,
+			                 convert(_mm256_castsi256_si128(mantissa),
+			                         _mm256_castsi256_si128(exponent)));
+			_mm256_storeu_pd(target + i + WIDTH / 2,
+			                 convert(_mm256_extracti128_si256(mantissa, 1),
+			                         _mm256_extracti128_si256(exponent, 1)));
+		}
+		return i;
+	}
+};
+
+//! Dispatches to the AVX2 kernels, if the processor supports them.
+template <> struct kernels<Float<std::int16_t, std::int8_t>> {
+	//! Whether there are any kernels.
+	constexpr static bool ENABLED = true;
+
+	//! The number of values per block.
+	constexpr static std::size_t WIDTH = avx2::WIDTH;
+
+	//! Adds the values like `Float::operator+` does.
+	//!
+	//! @returns The number of values processed.
+	static std::size_t add(const std::int16_t *first_mantissas,
+	                       const std::int8_t *first_exponents,
+	                       const std::int16_t *second_mantissas,
+	                       const std::int8_t *second_exponents,
+	                       std::int16_t *result_mantissas,
+	                       std::int8_t *result_exponents,
+	                       const std::size_t size) noexcept {
+		return has_avx2() ? avx2::add(first_mantissas, first_exponents,
+		                              second_mantissas, second_exponents,
+		                              result_mantissas, result_exponents, size)
+		                  : 0;
+	}
+
+	//! Multiplies the values like `Float::operator*` does.
+	//!
+	//! @returns The number of values processed.
+	static std::size_t mul(const std::int16_t *first_mantissas,
+	                       const std::int8_t *first_exponents,
+	                       const std::int16_t *second_mantissas,
+	                       const std::int8_t *second_exponents,
+	                       std::int16_t *result_mantissas,
+	                       std::int8_t *result_exponents,
+	                       const std::size_t size) noexcept {
+		return has_avx2() ? avx2::mul(first_mantissas, first_exponents,
+		                              second_mantissas, second_exponents,
+		                              result_mantissas, result_exponents, size)
+		                  : 0;
+	}
+
+	//! Converts the doubles like `Float(double)` does.
+	//!
+	//! @returns The number of values processed.
+	static std::size_t from_double(const double *source,
+	                               std::int16_t *mantissas,
+	                               std::int8_t *exponents,
+	                               const std::size_t size) noexcept {
+		return has_avx2() ? avx2::from_double(source, mantissas, exponents, size)
+		                  : 0;
+	}
+
+	//! Converts the values like `Float::operator double` does.
+	//!
+	//! @returns The number of values processed.
+	static std::size_t to_double(const std::int16_t *mantissas,
+	                             const std::int8_t *exponents, double *target,
+	                             const std::size_t size) noexcept {
+		return has_avx2() ? avx2::to_double(mantissas, exponents, target, size)
+		                  : 0;
+	}
+};
+
+#endif
+
+} // namespace simd
+} // namespace detail
+} // namespace fas
+#endif // FLOATING_POINT_SIMD_HPP
@@ -0,0 +1,206 @@
+#ifndef FLOATING_POINT_STATS_HPP
+#define FLOATING_POINT_STATS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#if !defined(FAS_FREESTANDING)
+#include <cstdio>
+#endif
+
+//! Instruments the operators of `fas::Float`, if `FAS_STATS` is defined before
+//! any header of this library is included.  Each thread counts the operations
+//! and the slow paths taken by them, and may install a hook, which is called
+//! whenever an operation overflows, divides by zero or results in a new
+//! `NOT_A_NUMBER`.  Otherwise `count` is empty, so the operators take no
+//! additional instruction.
+//!
+//! Operations evaluated by the compiler are not counted.  `FAS_STATS` needs to
+//! be defined with the same value in all translation units of a program.
+//! ```
+//! #define FAS_STATS
+//! #include "fas/float.hpp"
+//!
+//! fas::stats::reset();
+//! run(); // computes with floats
+//! fas::stats::dump(); // prints the counters of this thread to stderr
+//! ```
+//!
+//! The freestanding configuration omits `dump`, so it does not need `stdio`,
+//! see `FAS_FREESTANDING`.
+
+namespace fas {
+namespace stats {
+
+//! The counted events.
+enum class event : std::uint8_t {
+	//! Sums and differences.
+	sum,
+	//! Products.
+	product,
+	//! Quotients.
+	quotient,
+	//! Operations, of which an operand is zero or a special value.
+	special_operand,
+	//! Sums, whose mantissas overflow and get aligned once more.  Only those
+	//! of mantissas without a type of the doubled width do, see
+	//! `Float::ROUNDS_SUMS`.
+	sum_realignment,
+	//! Steps of long divisions, which append digits to the quotient.
+	quotient_step,
+	//! Digits, by which `normalize` shifts mantissas one at a time.
+	normalize_step,
+	//! Infinite results of finite values.
+	overflow,
+	//! Results of nonzero finite values, which become zero.
+	underflow,
+	//! Divisions of nonzero values by zero.
+	division_by_zero,
+	//! `NOT_A_NUMBER` results of operands, which are numbers.
+	not_a_number,
+};
+
+//! The number of events.
+constexpr std::size_t EVENTS =
+    static_cast<std::size_t>(event::not_a_number) + 1;
+
+//! Whether the operators are instrumented, see `FAS_STATS`.
+#if defined(FAS_STATS)
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+//! @returns Whether `hook` gets called on `what`.
+constexpr bool is_hooked(const event what) noexcept {
+	return what == event::overflow || what == event::division_by_zero ||
+	       what == event::not_a_number;
+}
+
+//! @returns The name of the given event.
+constexpr const char *name(const event what) noexcept {
+	switch (what) {
+	case event::sum:
+		return "sum";
+	case event::product:
+		return "product";
+	case event::quotient:
+		return "quotient";
+	case event::special_operand:
+		return "special_operand";
+	case event::sum_realignment:
+		return "sum_realignment";
+	case event::quotient_step:
+		return "quotient_step";
+	case event::normalize_step:
+		return "normalize_step";
+	case event::overflow:
+		return "overflow";
+	case event::underflow:
+		return "underflow";
+	case event::division_by_zero:
+		return "division_by_zero";
+	case event::not_a_number:
+		return "not_a_number";
+	}
+	return "unknown";
+}
+
+//! Holds a counter per event.
+struct counters {
+	//! The counters, indexed by the events.
+	std::array<std::uint64_t, EVENTS> values{};
+
+	//! @returns The counter of the given event.
+	constexpr std::uint64_t &operator[](const event what) noexcept {
+		return values[static_cast<std::size_t>(what)];
+	}
+
+	//! @returns The counter of the given event.
+	constexpr std::uint64_t operator[](const event what) const noexcept {
+		return values[static_cast<std::size_t>(what)];
+	}
+
+	//! Adds the counters of another thread.
+	counters &operator+=(const counters &other) noexcept {
+		for (std::size_t i = 0; i < EVENTS; ++i) {
+			values[i] += other.values[i];
+		}
+		return *this;
+	}
+};
+
+//! A hook, which gets called by the thread on which the event occurred.
+using hook_t = void (*)(event);
+
+namespace detail {
+
+//! The state of a thread.
+struct state {
+	counters counted;
+	hook_t hook = nullptr;
+};
+
+//! @returns The state of the calling thread.
+inline state &local() noexcept {
+	thread_local state result;
+	return result;
+}
+
+//! Counts `n` events of `what` on the calling thread.
+inline void record(const event what, const std::uint64_t n) noexcept {
+	auto &target = local();
+	target.counted[what] += n;
+	if (n != 0 && is_hooked(what) && target.hook != nullptr) {
+		target.hook(what);
+	}
+}
+
+} // namespace detail
+
+//! Counts `n` events of `what` on the calling thread, if `FAS_STATS` is
+//! defined and the caller is not evaluated by the compiler.
+constexpr void count(const event what, const std::uint64_t n = 1) noexcept {
+#if defined(FAS_STATS)
+	if (!__builtin_is_constant_evaluated()) {
+		detail::record(what, n);
+	}
+#else
+	static_cast<void>(what);
+	static_cast<void>(n);
+#endif
+}
+
+//! @returns The counters of the calling thread.
+inline counters snapshot() noexcept { return detail::local().counted; }
+
+//! Resets the counters of the calling thread.
+inline void reset() noexcept { detail::local().counted = {}; }
+
+//! Installs the hook of the calling thread, `nullptr` removes it.
+//!
+//! @returns The previous hook.
+inline hook_t set_hook(const hook_t hook) noexcept {
+	auto &target = detail::local();
+	const auto result = target.hook;
+	target.hook = hook;
+	return result;
+}
+
+#if !defined(FAS_FREESTANDING)
+//! Prints the given counters, one event per line.
+inline void dump(const counters &source, std::FILE *target = stderr) {
+	for (std::size_t i = 0; i < EVENTS; ++i) {
+		std::fprintf(target, "%-17s %llu\n", name(static_cast<event>(i)),
+		             static_cast<unsigned long long>(source.values[i]));
+	}
+}
+
+//! Prints the counters of the calling thread, one event per line.
+inline void dump(std::FILE *target = stderr) { dump(snapshot(), target); }
+#endif
+
+} // namespace stats
+} // namespace fas
+
+#endif // FLOATING_POINT_STATS_HPP
@@ -1,55 +1,55 @@
 #ifndef FLOATING_POINT_STREAMS_HPP
 #define FLOATING_POINT_STREAMS_HPP
+#include "fas/charconv.hpp"
 #include "fas/float.hpp"
 
-#include <cmath>
+#include <array>
+#include <charconv>
 #include <iostream>
-#include <string>
+#include <string_view>
 
 namespace fas {
 
-//! @returns the target as it is. This should work for all non
-//! char types, since these are shown as numbers.
-template <typename Ttarget> Ttarget char_to_int(Ttarget target) {
-	return target;
-}
+//! Prints the shortest decimal representation of the given float to the
+//! given stream, see `fas::to_chars`.  The stream's width and fill are
+//! respected, while its other formatting flags are neither used nor altered.
+//!
+//! Values of exponents too extreme to convert are printed exactly as
+//! `mantissa*BASE^exponent`.
+template <typename Tmantissa, typename Texponent, Tmantissa BASE,
+          Tmantissa MANTISSA_LOWEST, Tmantissa MANTISSA_MAX,
+          Texponent EXPONENT_LOWEST, Texponent EXPONENT_MAX,
+          rounding ROUNDING, overflow ON_OVERFLOW>
+std::ostream &operator<<(std::ostream &target,
+                         const Float<Tmantissa, Texponent, BASE,
+                                     MANTISSA_LOWEST, MANTISSA_MAX,
+                                     EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+                                     ON_OVERFLOW>
+                             &source) {
+	using float_t = Float<Tmantissa, Texponent, BASE, MANTISSA_LOWEST,
+	                      MANTISSA_MAX, EXPONENT_LOWEST, EXPONENT_MAX, ROUNDING,
+	                      ON_OVERFLOW>;
 
-//! @returns the char converted into an int, since we want to print the
-//! values and not their ascii letter.
-template <char> char char_to_int(char target) { return (int)target; }
+	// Holds the fallback's three integers, too.
+	std::array<char, std::max<std::size_t>(max_chars<float_t>, 128)> buffer;
+	auto *const first = buffer.data();
+	auto *const last = first + buffer.size();
 
-//! Converts the given Floating_Point into a double.
-template <typename Ttarget> double double_value(const Ttarget &target) {
-	return target.mantissa() *
-	       std::pow(target.EXPONENT_BASE(), target.exponent());
-}
-
-//! Pretty prints the given Floating_Point to the given stream.
-template <typename Tmantissa, typename Texponent, Tmantissa BASE>
-std::ostream &operator<<(std::ostream &target,
-                         const fas::Float<Tmantissa, Texponent, BASE> &source) {
-	if (fas::Float<Tmantissa, Texponent>::ZERO() == source) {
-		target << "ZERO";
-	} else if (fas::Float<Tmantissa, Texponent>::ONE() == source) {
-		target << "One";
-	} else if (fas::Float<Tmantissa, Texponent>::INF() == source) {
-		target << "INF";
-	} else if (fas::Float<Tmantissa, Texponent>::NEGATIVE_INF() == source) {
-		target << "NEGATIVE INF";
-	} else if (fas::Float<Tmantissa, Texponent>::NOT_A_NUMBER() == source) {
-		target << "NOT A NUMBER";
-	} else if (fas::Float<Tmantissa, Texponent>::MIN() == source) {
-		target << "MIN";
-	} else if (fas::Float<Tmantissa, Texponent>::LOWEST() == source) {
-		target << "LOWEST";
-	} else if (fas::Float<Tmantissa, Texponent>::MAX() == source) {
-		target << "MAX";
-	} else {
-		target << std::hex << char_to_int((int) source.mantissa()) << " * "
-		       << char_to_int((int) source.EXPONENT_BASE()) << " ^ "
-		       << char_to_int((int) source.exponent()) << " ≈ " << double_value(source);
+	auto result = to_chars(first, last, source);
+	if (result.ec != std::errc()) {
+		const auto append = [last](char *end, const char separator) {
+			if (end != last) {
+				*end++ = separator;
+			}
+			return end;
+		};
+		result = detail::integer_to_chars(first, last, source.mantissa());
+		result = detail::integer_to_chars(append(result.ptr, '*'), last,
+		                                  source.EXPONENT_BASE());
+		result = detail::integer_to_chars(append(result.ptr, '^'), last,
+		                                  source.exponent());
 	}
-	return target;
+	return target << std::string_view(first, result.ptr - first);
 }
 } // namespace fas
 #endif // FLOATING_POINT_STREAMS_HPP
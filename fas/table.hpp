@@ -0,0 +1,292 @@
+#ifndef FLOATING_POINT_TABLE_HPP
+#define FLOATING_POINT_TABLE_HPP
+#include "fas/float.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace fas {
+namespace detail {
+
+//! Indexes the tables of operations of `Tfloat`: Each representation of a
+//! value, its mantissa and its exponent, gets a code of its own.  Since the
+//! special values have a zero mantissa and an exponent of `0` up to `3`, those
+//! exponents are included.
+template <typename Tfloat> struct tabulation {
+	//! The mantissa type.
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+
+	//! The exponent type.
+	using Texponent = std::remove_cv_t<decltype(Tfloat::MAX().exponent())>;
+
+	//! The limits of the mantissas and the exponents, including those of the
+	//! special values.
+	constexpr static std::intmax_t MANTISSA_LOWEST =
+	    std::min<std::intmax_t>(Tfloat::LOWEST().mantissa(), 0);
+	constexpr static std::intmax_t MANTISSA_MAX = Tfloat::MAX().mantissa();
+	constexpr static std::intmax_t EXPONENT_LOWEST =
+	    std::min<std::intmax_t>(Tfloat::MIN().exponent(), 0);
+	constexpr static std::intmax_t EXPONENT_MAX =
+	    std::max<std::intmax_t>(Tfloat::MAX().exponent(), 3);
+
+	//! The largest number of codes per operand, which bounds `ENTRIES`.
+	constexpr static std::uintmax_t CODES_LIMIT = std::uintmax_t(1) << 32;
+
+	//! The number of exponents.
+	constexpr static std::uintmax_t EXPONENTS =
+	    static_cast<std::uintmax_t>(EXPONENT_MAX) -
+	    static_cast<std::uintmax_t>(EXPONENT_LOWEST) + 1;
+
+	//! The number of codes, or `CODES_LIMIT` if they would exceed it.  The
+	//! numbers of mantissas and exponents may exceed `std::uintmax_t` by one.
+	constexpr static std::uintmax_t CODES = [] {
+		const auto mantissas = static_cast<std::uintmax_t>(MANTISSA_MAX) -
+		                       static_cast<std::uintmax_t>(MANTISSA_LOWEST);
+		const auto exponents = EXPONENTS - 1;
+		return mantissas >= CODES_LIMIT || exponents >= CODES_LIMIT ||
+		               (mantissas + 1) * EXPONENTS > CODES_LIMIT
+		           ? CODES_LIMIT
+		           : (mantissas + 1) * EXPONENTS;
+	}();
+
+	//! The number of entries of a table of the results of all pairs of codes,
+	//! or the largest `std::uintmax_t` if there are `CODES_LIMIT` codes.
+	constexpr static std::uintmax_t ENTRIES =
+	    CODES < CODES_LIMIT ? CODES * CODES
+	                        : std::numeric_limits<std::uintmax_t>::max();
+
+	//! @returns The code of `value`.
+	constexpr static std::size_t code(const Tfloat &value) noexcept {
+		return static_cast<std::size_t>(
+		    static_cast<std::uintmax_t>(value._mantissa - MANTISSA_LOWEST) *
+		        EXPONENTS +
+		    static_cast<std::uintmax_t>(value._exponent - EXPONENT_LOWEST));
+	}
+
+	//! @returns The value of the given code, which may not be normalized.
+	constexpr static Tfloat value(const std::size_t code) noexcept {
+		return Tfloat::of(
+		    static_cast<Tmantissa>(static_cast<std::intmax_t>(code / EXPONENTS) +
+		                           MANTISSA_LOWEST),
+		    static_cast<Texponent>(static_cast<std::intmax_t>(code % EXPONENTS) +
+		                           EXPONENT_LOWEST));
+	}
+};
+
+//! Holds the table of `Top` of `Tfloat`, which is built once at compile time,
+//! see `make_table`.
+template <typename Top, typename Tfloat> struct table;
+
+} // namespace detail
+
+//! @returns The index of the result of `first` and `second` in a table made
+//! by `make_table`.
+//!
+//! @param first The first operand.
+//! @param second The second operand.
+template <typename Tfloat>
+constexpr std::size_t table_index(const Tfloat &first,
+                                  const Tfloat &second) noexcept {
+	using Ttabulation = detail::tabulation<Tfloat>;
+	return Ttabulation::code(first) *
+	           static_cast<std::size_t>(Ttabulation::CODES) +
+	       Ttabulation::code(second);
+}
+
+//! @returns The results of `Top()(first, second)` of all pairs of values of
+//! `Tfloat`.  The result of `first` and `second` is stored at
+//! `table_index(first, second)`.
+//!
+//! The table gets indexed by the mantissas and the exponents of both
+//! operands, so it holds an entry per pair of their representations,
+//! including those which are not normalized.  This is feasible only for
+//! floats of a few bits, such as `fas::Float<int8_t, int8_t, 2, -8, 7, -4, 3>`
+//! of 16 mantissas and 8 exponents, whose tables hold `128 ^ 2` entries.  The
+//! table is computed by the compiler, which may need a larger limit of
+//! operations for larger tables, such as `-fconstexpr-ops-limit` of gcc.
+//!
+//! @tparam Top The binary operation, a default constructible type such as
+//!         `std::multiplies<>`, whose call operator is a constant expression.
+//! @tparam Tfloat The `Float` type of the operands.
+template <typename Top, typename Tfloat> constexpr auto make_table() noexcept {
+	using Ttabulation = detail::tabulation<Tfloat>;
+	using Tresult = std::decay_t<decltype(Top()(Tfloat(), Tfloat()))>;
+	static_assert(Ttabulation::CODES < Ttabulation::CODES_LIMIT,
+	              "The table's entries need to fit into the memory.");
+	constexpr auto codes = static_cast<std::size_t>(Ttabulation::CODES);
+
+	std::array<Tresult, codes * codes> result{};
+	for (std::size_t first = 0; first < codes; ++first) {
+		const auto first_value = Ttabulation::value(first);
+		for (std::size_t second = 0; second < codes; ++second) {
+			result[first * codes + second] =
+			    Top()(first_value, Ttabulation::value(second));
+		}
+	}
+	return result;
+}
+
+namespace detail {
+
+template <typename Top, typename Tfloat> struct table {
+	//! The results, see `make_table`.
+	constexpr static auto values = make_table<Top, Tfloat>();
+
+	//! @returns The result of `first` and `second`, by a single load.
+	constexpr static auto lookup(const Tfloat &first,
+	                             const Tfloat &second) noexcept {
+		return values[table_index(first, second)];
+	}
+};
+
+} // namespace detail
+
+//! Holds a value of `Tfloat`, whose operators `+ - * /` load their results
+//! from a table built at compile time, if the table of the results of all
+//! pairs of values takes at most `MAX_ENTRIES` entries, see `make_table`.
+//! Otherwise the float's operators are evaluated, so `TabledFloat` may be used
+//! generically.  The results equal those of the float's operators.
+//!
+//! The default of `MAX_ENTRIES` admits floats, whose mantissas and exponents
+//! take up to 8 bits together, such as the following float of 4 and 3 bits.
+//! Its tables take 32 KiB each:
+//! ```
+//! using tiny_t = fas::Float<int8_t, int8_t, 2, -8, 7, -4, 3>;
+//! fas::TabledFloat<tiny_t> a = tiny_t(1.5), b = tiny_t(-3);
+//! tiny_t product = (a * b).value(); // a single load
+//! ```
+//!
+//! @tparam Tfloat The `Float` type to hold.
+//! @tparam MAX_ENTRIES The largest number of entries of a table.
+template <typename Tfloat, std::uintmax_t MAX_ENTRIES = std::uintmax_t(1) << 16>
+class TabledFloat {
+	//! The held value.
+	Tfloat _value;
+
+	//! @returns The result of `Top()(first, second)`.
+	template <typename Top>
+	constexpr static TabledFloat apply(const TabledFloat &first,
+	                                   const TabledFloat &second) noexcept {
+		if constexpr (TABULATED) {
+			return detail::table<Top, Tfloat>::lookup(first._value, second._value);
+		} else {
+			return Top()(first._value, second._value);
+		}
+	}
+
+public:
+	//! Whether the operators load their results from tables.
+	constexpr static bool TABULATED =
+	    detail::tabulation<Tfloat>::ENTRIES <= MAX_ENTRIES;
+
+	//! Holds zero.
+	constexpr TabledFloat() noexcept : _value(Tfloat::ZERO()) {}
+
+	//! Holds the given value.
+	constexpr TabledFloat(const Tfloat &value) noexcept : _value(value) {}
+
+	//! @returns The held value.
+	constexpr Tfloat value() const noexcept { return _value; }
+
+	//! @returns The held value.
+	constexpr explicit operator Tfloat() const noexcept { return _value; }
+
+	//! @returns The negated value.
+	constexpr TabledFloat operator-() const noexcept { return -_value; }
+
+	//! @returns The sum of the given operands.
+	constexpr friend TabledFloat operator+(const TabledFloat &first,
+	                                       const TabledFloat &second) noexcept {
+		return apply<std::plus<>>(first, second);
+	}
+
+	//! @returns The difference of the given operands.
+	constexpr friend TabledFloat
+	operator-(const TabledFloat &minuend,
+	          const TabledFloat &subtrahend) noexcept {
+		return apply<std::minus<>>(minuend, subtrahend);
+	}
+
+	//! @returns The product of the given operands.
+	constexpr friend TabledFloat operator*(const TabledFloat &first,
+	                                       const TabledFloat &second) noexcept {
+		return apply<std::multiplies<>>(first, second);
+	}
+
+	//! @returns The quotient of the given operands.
+	constexpr friend TabledFloat operator/(const TabledFloat &dividend,
+	                                       const TabledFloat &divisor) noexcept {
+		return apply<std::divides<>>(dividend, divisor);
+	}
+
+	//! Adds the given value.
+	constexpr TabledFloat &operator+=(const TabledFloat &summand) noexcept {
+		return *this = *this + summand;
+	}
+
+	//! Subtracts the given value.
+	constexpr TabledFloat &operator-=(const TabledFloat &subtrahend) noexcept {
+		return *this = *this - subtrahend;
+	}
+
+	//! Multiplies by the given value.
+	constexpr TabledFloat &operator*=(const TabledFloat &factor) noexcept {
+		return *this = *this * factor;
+	}
+
+	//! Divides by the given value.
+	constexpr TabledFloat &operator/=(const TabledFloat &divisor) noexcept {
+		return *this = *this / divisor;
+	}
+
+	//! Compares the held values.
+	constexpr friend bool operator==(const TabledFloat &first,
+	                                 const TabledFloat &second) noexcept {
+		return first._value == second._value;
+	}
+
+	//! Compares the held values.
+	constexpr friend bool operator!=(const TabledFloat &first,
+	                                 const TabledFloat &second) noexcept {
+		return first._value != second._value;
+	}
+
+	//! Compares the held values.
+	constexpr friend bool operator<(const TabledFloat &first,
+	                                const TabledFloat &second) noexcept {
+		return first._value < second._value;
+	}
+
+	//! Compares the held values.
+	constexpr friend bool operator<=(const TabledFloat &first,
+	                                 const TabledFloat &second) noexcept {
+		return first._value <= second._value;
+	}
+
+	//! Compares the held values.
+	constexpr friend bool operator>(const TabledFloat &first,
+	                                const TabledFloat &second) noexcept {
+		return first._value > second._value;
+	}
+
+	//! Compares the held values.
+	constexpr friend bool operator>=(const TabledFloat &first,
+	                                 const TabledFloat &second) noexcept {
+		return first._value >= second._value;
+	}
+
+	//! Prints the held value, see `fas/stream.hpp`.
+	template <typename Tstream>
+	friend decltype(auto) operator<<(Tstream &target, const TabledFloat &source) {
+		return target << source._value;
+	}
+};
+
+} // namespace fas
+
+#endif // FLOATING_POINT_TABLE_HPP
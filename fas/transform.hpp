@@ -0,0 +1,148 @@
+#ifndef FLOATING_POINT_TRANSFORM_HPP
+#define FLOATING_POINT_TRANSFORM_HPP
+#include "fas/reduce.hpp"
+#include "fas/vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+namespace fas {
+
+//! How `transform` distributes the values to threads:  The values are split
+//! into chunks, which the threads claim one after the other, so a thread done
+//! early claims more of them.
+struct execution {
+	//! The number of threads, `0` for one per processor.
+	unsigned threads = 0;
+
+	//! The number of values per chunk.  A chunk of the mantissas and the
+	//! exponents of the operands and the result should fit into the cache.
+	std::size_t chunk = std::size_t(1) << 14;
+};
+
+//! Processes all values on the calling thread.
+constexpr execution sequential{1};
+
+//! Processes the values on one thread per processor.
+constexpr execution parallel{0};
+
+namespace detail {
+
+//! Runs `work(first, last)` for the chunks `[first, last)` of `count` values
+//! taken by `policy`, on the threads of `reduction::run`.
+template <typename Tfloat, typename Twork>
+void for_chunks(const execution &policy, const std::size_t count,
+                const Twork &work) {
+	const auto chunk = std::max<std::size_t>(1, policy.chunk);
+	const auto chunks = (count + chunk - 1) / chunk;
+
+	auto threads = policy.threads;
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = static_cast<unsigned>(std::min<std::size_t>(threads, chunks));
+	if (threads <= 1) {
+		if (count != 0) {
+			work(std::size_t(0), count);
+		}
+		return;
+	}
+
+	std::atomic<std::size_t> next(0);
+	reduction<Tfloat>::run(
+	    threads, threads,
+	    [&next, &work, chunk, chunks, count](unsigned, std::size_t, std::size_t) {
+		    for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < chunks;
+		         i = next.fetch_add(1, std::memory_order_relaxed)) {
+			    work(i * chunk, std::min(count, (i + 1) * chunk));
+		    }
+	    });
+}
+
+//! @returns `value`, after all steps have been applied.
+template <typename Tvalue>
+constexpr Tvalue apply_steps(const Tvalue &value) {
+	return value;
+}
+
+//! @returns The result of the remaining `steps` applied to `step(value)`.
+template <typename Tvalue, typename Tstep, typename... Tsteps>
+constexpr auto apply_steps(const Tvalue &value, const Tstep &step,
+                           const Tsteps &...steps) {
+	return apply_steps(step(value), steps...);
+}
+
+} // namespace detail
+
+//! @returns The operation, which applies `steps` one after the other to the
+//! result of `operation`.  Passed to `transform`, all of them are evaluated
+//! in a single pass over the values, for example:
+//! ```
+//! fas::transform(fas::parallel, gains, samples, result,
+//!                fas::fuse(std::multiplies<>(),
+//!                          [bias](const auto &value) { return value + bias; },
+//!                          [](const auto &value) {
+//!                            return std::clamp(value, low, high);
+//!                          }));
+//! ```
+//!
+//! @param operation The first operation, taking the operands.
+//! @param steps The unary operations, each taking the previous result.
+template <typename Toperation, typename... Tsteps>
+constexpr auto fuse(Toperation operation, Tsteps... steps) {
+	return [operation, steps...](const auto &...operands) {
+		return detail::apply_steps(operation(operands...), steps...);
+	};
+}
+
+//! Applies `operation` to each pair of values of `first` and `second` and
+//! stores the results in `result`, like `FloatVector::transform` does.  Only
+//! the common values are processed and `result` gets resized to their
+//! number.  `result` may be one of the operands.  The chunks are processed
+//! as `policy` selects, so `operation` needs to be safe to call concurrently.
+//!
+//! @param policy The threads and chunks, such as `sequential` or `parallel`.
+//! @param operation The binary operation, taking and returning `Tfloat`, see
+//!        `fuse`.
+template <typename Tfloat, typename Toperation>
+void transform(const execution &policy, const FloatVector<Tfloat> &first,
+               const FloatVector<Tfloat> &second, FloatVector<Tfloat> &result,
+               const Toperation &operation) {
+	const auto size = std::min(first.size(), second.size());
+	result.resize(size);
+	detail::for_chunks<Tfloat>(
+	    policy, size,
+	    [&first, &second, &result, &operation](const std::size_t begin,
+	                                          const std::size_t end) {
+		    for (auto i = begin; i < end; ++i) {
+			    result.set(i, operation(first[i], second[i]));
+		    }
+	    });
+}
+
+//! Applies `operation` to each value of `source` and stores the results in
+//! `result`, which gets resized to the size of `source` and may be `source`,
+//! see the other `transform`.
+//!
+//! @param policy The threads and chunks, such as `sequential` or `parallel`.
+//! @param operation The unary operation, taking and returning `Tfloat`, see
+//!        `fuse`.
+template <typename Tfloat, typename Toperation>
+void transform(const execution &policy, const FloatVector<Tfloat> &source,
+               FloatVector<Tfloat> &result, const Toperation &operation) {
+	const auto size = source.size();
+	result.resize(size);
+	detail::for_chunks<Tfloat>(
+	    policy, size,
+	    [&source, &result, &operation](const std::size_t begin,
+	                                   const std::size_t end) {
+		    for (auto i = begin; i < end; ++i) {
+			    result.set(i, operation(source[i]));
+		    }
+	    });
+}
+
+} // namespace fas
+#endif // FLOATING_POINT_TRANSFORM_HPP
@@ -0,0 +1,498 @@
+#ifndef FLOATING_POINT_VECTOR_HPP
+#define FLOATING_POINT_VECTOR_HPP
+#include "fas/float.hpp"
+#include "fas/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace fas {
+namespace detail {
+
+//! An allocator, whose allocations are aligned to `ALIGNMENT` bytes.
+//!
+//! @tparam T The type to allocate.
+//! @tparam ALIGNMENT The alignment in bytes, needs to be a power of two.
+template <typename T, std::size_t ALIGNMENT> struct aligned_allocator {
+	using value_type = T;
+
+	//! Allows to rebind the allocator to other types.
+	template <typename Tother> struct rebind {
+		using other = aligned_allocator<Tother, ALIGNMENT>;
+	};
+
+	aligned_allocator() = default;
+
+	//! Converts an allocator of another type.
+	template <typename Tother>
+	constexpr aligned_allocator(
+	    const aligned_allocator<Tother, ALIGNMENT> &) noexcept {}
+
+	//! @returns Storage for `n` values of `T`.
+	T *allocate(const std::size_t n) {
+		return static_cast<T *>(
+		    ::operator new(n * sizeof(T), std::align_val_t(ALIGNMENT)));
+	}
+
+	//! Releases the storage, which has been returned by `allocate`.
+	void deallocate(T *target, std::size_t) noexcept {
+		::operator delete(target, std::align_val_t(ALIGNMENT));
+	}
+
+	//! All instances are interchangeable.
+	template <typename Tother>
+	constexpr bool
+	operator==(const aligned_allocator<Tother, ALIGNMENT> &) const noexcept {
+		return true;
+	}
+
+	//! All instances are interchangeable.
+	template <typename Tother>
+	constexpr bool
+	operator!=(const aligned_allocator<Tother, ALIGNMENT> &) const noexcept {
+		return false;
+	}
+};
+
+} // namespace detail
+
+//! Stores floats as structure of arrays: The mantissas and the exponents are
+//! held in separate arrays, each aligned to a cache line.  Unlike a
+//! `std::vector<Tfloat>`, no space gets wasted by padding, and the operations
+//! below process whole arrays at once.
+//!
+//! @tparam Tfloat The `Float` type to store.
+template <typename Tfloat> class FloatVector {
+public:
+	//! The floats' mantissa type.
+	using mantissa_type = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+
+	//! The floats' exponent type.
+	using exponent_type = std::remove_cv_t<decltype(Tfloat::MAX().exponent())>;
+
+	//! The alignment of either array in bytes.
+	constexpr static std::size_t ALIGNMENT = 64;
+
+private:
+	//! An array aligned to `ALIGNMENT`.
+	template <typename T>
+	using array_t = std::vector<T, detail::aligned_allocator<T, ALIGNMENT>>;
+
+	//! Holds the mantissas.
+	array_t<mantissa_type> _mantissas;
+
+	//! Holds the exponents.
+	array_t<exponent_type> _exponents;
+
+public:
+	//! Creates an empty vector.
+	FloatVector() = default;
+
+	//! Creates a vector of `size` zeros.
+	explicit FloatVector(const std::size_t size)
+	    : _mantissas(size), _exponents(size) {}
+
+	//! Creates a vector holding the given values.
+	FloatVector(const std::initializer_list<Tfloat> values) {
+		reserve(values.size());
+		for (const auto &value : values) {
+			push_back(value);
+		}
+	}
+
+	//! @returns The number of values.
+	std::size_t size() const noexcept { return _mantissas.size(); }
+
+	//! @returns Whether there are no values.
+	bool empty() const noexcept { return _mantissas.empty(); }
+
+	//! Reserves storage for `capacity` values.
+	void reserve(const std::size_t capacity) {
+		_mantissas.reserve(capacity);
+		_exponents.reserve(capacity);
+	}
+
+	//! Resizes the vector to `size` values, appending zeros if needed.
+	void resize(const std::size_t size) {
+		_mantissas.resize(size);
+		_exponents.resize(size);
+	}
+
+	//! Removes all values.
+	void clear() noexcept {
+		_mantissas.clear();
+		_exponents.clear();
+	}
+
+	//! Appends the given value.
+	void push_back(const Tfloat &value) {
+		_mantissas.push_back(value._mantissa);
+		_exponents.push_back(value._exponent);
+	}
+
+	//! @returns The value at the given index, which needs to be `< size()`.
+	Tfloat operator[](const std::size_t index) const noexcept {
+		return Tfloat::of(_mantissas[index], _exponents[index]);
+	}
+
+	//! Replaces the value at the given index, which needs to be `< size()`.
+	void set(const std::size_t index, const Tfloat &value) noexcept {
+		_mantissas[index] = value._mantissa;
+		_exponents[index] = value._exponent;
+	}
+
+	//! @returns The array of mantissas.
+	const mantissa_type *mantissas() const noexcept { return _mantissas.data(); }
+
+	//! @returns The array of mantissas.
+	mantissa_type *mantissas() noexcept { return _mantissas.data(); }
+
+	//! @returns The array of exponents.
+	const exponent_type *exponents() const noexcept { return _exponents.data(); }
+
+	//! @returns The array of exponents.
+	exponent_type *exponents() noexcept { return _exponents.data(); }
+
+	//! Applies `operation` to each pair of values of `first` and `second`
+	//! and stores the results in `result`.  Only the common values are
+	//! processed and `result` gets resized to their number.  `result` may be
+	//! one of the operands.
+	//!
+	//! @param operation The binary operation, taking and returning `Tfloat`.
+	//! @param kernel Processes the values block by block and returns the
+	//!        number of values processed, see `detail::simd::kernels`.  The
+	//!        next block is processed by `operation`, before `kernel` resumes.
+	//! @tparam WIDTH The number of values per block, `0` if there is no
+	//!         kernel.
+	template <std::size_t WIDTH = 0, typename Toperation,
+	          typename Tkernel = std::nullptr_t>
+	static void transform(const FloatVector &first, const FloatVector &second,
+	                      FloatVector &result, Toperation operation,
+	                      Tkernel kernel = nullptr) {
+		const auto size = std::min(first.size(), second.size());
+		result.resize(size);
+
+		const auto *first_mantissas = first.mantissas();
+		const auto *first_exponents = first.exponents();
+		const auto *second_mantissas = second.mantissas();
+		const auto *second_exponents = second.exponents();
+		auto *result_mantissas = result.mantissas();
+		auto *result_exponents = result.exponents();
+
+		for (std::size_t i = 0; i < size;) {
+			auto end = size;
+			if constexpr (WIDTH != 0) {
+				i += kernel(first_mantissas + i, first_exponents + i,
+				            second_mantissas + i, second_exponents + i,
+				            result_mantissas + i, result_exponents + i, size - i);
+				end = std::min(size, i + WIDTH);
+			}
+
+			for (; i < end; ++i) {
+				const auto value =
+				    operation(Tfloat::of(first_mantissas[i], first_exponents[i]),
+				              Tfloat::of(second_mantissas[i], second_exponents[i]));
+				result_mantissas[i] = value._mantissa;
+				result_exponents[i] = value._exponent;
+			}
+		}
+	}
+
+	//! Converts `count` native floats of `source` like `Tfloat(double)` does
+	//! and stores them in `result`, which gets resized to `count`.
+	//!
+	//! @param kernel Converts the values block by block and returns the number
+	//!        of values converted, see `detail::simd::kernels`.  The next block
+	//!        is converted one by one, before `kernel` resumes.
+	//! @tparam WIDTH The number of values per block, `0` if there is no
+	//!         kernel.
+	//! @tparam Tnative A native floating point type.
+	template <std::size_t WIDTH = 0, typename Tnative,
+	          typename Tkernel = std::nullptr_t>
+	static void convert(const Tnative *source, const std::size_t count,
+	                    FloatVector &result, Tkernel kernel = nullptr) {
+		result.resize(count);
+		auto *result_mantissas = result.mantissas();
+		auto *result_exponents = result.exponents();
+
+		for (std::size_t i = 0; i < count;) {
+			auto end = count;
+			if constexpr (WIDTH != 0) {
+				i += kernel(source + i, result_mantissas + i, result_exponents + i,
+				            count - i);
+				end = std::min(count, i + WIDTH);
+			}
+
+			for (; i < end; ++i) {
+				const auto value = Tfloat(static_cast<double>(source[i]));
+				result_mantissas[i] = value._mantissa;
+				result_exponents[i] = value._exponent;
+			}
+		}
+	}
+
+	//! Converts the values of `source` like `Tfloat::operator Tnative` does
+	//! and stores them in `target`, which needs to hold `source.size()`
+	//! values.
+	//!
+	//! @param kernel Converts the values block by block, see the other
+	//!        `convert`.
+	//! @tparam WIDTH The number of values per block, `0` if there is no
+	//!         kernel.
+	//! @tparam Tnative A native floating point type.
+	template <std::size_t WIDTH = 0, typename Tnative,
+	          typename Tkernel = std::nullptr_t>
+	static void convert(const FloatVector &source, Tnative *target,
+	                    Tkernel kernel = nullptr) {
+		const auto size = source.size();
+		const auto *source_mantissas = source.mantissas();
+		const auto *source_exponents = source.exponents();
+
+		for (std::size_t i = 0; i < size;) {
+			auto end = size;
+			if constexpr (WIDTH != 0) {
+				i += kernel(source_mantissas + i, source_exponents + i, target + i,
+				            size - i);
+				end = std::min(size, i + WIDTH);
+			}
+
+			for (; i < end; ++i) {
+				target[i] = static_cast<Tnative>(
+				    Tfloat::of(source_mantissas[i], source_exponents[i]));
+			}
+		}
+	}
+
+	//! Multiplies each value of `source` by `BASE ^ n` and stores the results
+	//! in `result`, which may be `source`.  Only the exponents are adjusted,
+	//! so values leaving the exponent's range become zero or infinite, or
+	//! saturate, see `overflow::saturate`.
+	static void scale(const FloatVector &source, const std::intmax_t n,
+	                  FloatVector &result) {
+		constexpr std::intmax_t lowest = Tfloat::MIN().exponent();
+		constexpr std::intmax_t max = Tfloat::MAX().exponent();
+
+		const auto size = source.size();
+		result.resize(size);
+
+		const auto *source_mantissas = source.mantissas();
+		const auto *source_exponents = source.exponents();
+		auto *result_mantissas = result.mantissas();
+		auto *result_exponents = result.exponents();
+
+		for (std::size_t i = 0; i < size; ++i) {
+			const auto mantissa = source_mantissas[i];
+			const auto exponent = source_exponents[i] + n;
+
+			// Special values have a zero mantissa and remain as they are.
+			if (mantissa == 0) {
+				result_mantissas[i] = 0;
+				result_exponents[i] = source_exponents[i];
+			} else if (exponent < lowest) {
+				result_mantissas[i] = 0;
+				result_exponents[i] = Tfloat::ZERO()._exponent;
+			} else if (exponent > max) {
+				const auto overflowed = Tfloat::overflowed(mantissa < 0);
+				result_mantissas[i] = overflowed._mantissa;
+				result_exponents[i] = overflowed._exponent;
+			} else {
+				result_mantissas[i] = mantissa;
+				result_exponents[i] = static_cast<exponent_type>(exponent);
+			}
+		}
+	}
+
+	//! Sorts the values of `target` by their `sort_key`s: Not a number is
+	//! sorted last.  The keys get sorted by a least significant digit radix
+	//! sort, a byte per pass, and are decoded afterwards.  Passes over bytes
+	//! all keys share are skipped, such as the exponents' upper bits.
+	static void sort(FloatVector &target) {
+		using Tkey = typename Tfloat::sort_key_type;
+		constexpr std::size_t RADIX = 256;
+		constexpr std::size_t PASSES = (Tfloat::DISTANCE_BITS + 2 + 7) / 8;
+
+		const auto size = target.size();
+		auto *mantissas = target.mantissas();
+		auto *exponents = target.exponents();
+
+		std::vector<Tkey> keys(size);
+		for (std::size_t i = 0; i < size; ++i) {
+			keys[i] = Tfloat::of(mantissas[i], exponents[i]).sort_key();
+		}
+
+		// Comparing takes less than counting for a few values.
+		if (size < RADIX) {
+			std::sort(keys.begin(), keys.end());
+		} else {
+			// Counts the bytes of all passes at once.
+			std::vector<std::array<std::size_t, RADIX>> counts(PASSES);
+			for (const auto key : keys) {
+				for (std::size_t pass = 0; pass < PASSES; ++pass) {
+					++counts[pass][static_cast<std::uint8_t>(key >> (8 * pass))];
+				}
+			}
+
+			std::vector<Tkey> sorted(size);
+			for (std::size_t pass = 0; pass < PASSES; ++pass) {
+				auto &offsets = counts[pass];
+				if (offsets[static_cast<std::uint8_t>(keys[0] >> (8 * pass))] ==
+				    size) {
+					continue;
+				}
+
+				std::size_t offset = 0;
+				for (auto &count : offsets) {
+					offset += count;
+					count = offset - count;
+				}
+				for (const auto key : keys) {
+					sorted[offsets[static_cast<std::uint8_t>(key >> (8 * pass))]++] =
+					    key;
+				}
+				keys.swap(sorted);
+			}
+		}
+
+		for (std::size_t i = 0; i < size; ++i) {
+			const auto value = Tfloat::from_sort_key(keys[i]);
+			mantissas[i] = value._mantissa;
+			exponents[i] = value._exponent;
+		}
+	}
+};
+
+//! Stores the sums of the values of `first` and `second` in `result`, see
+//! `FloatVector::transform`.
+template <typename Tfloat>
+void add(const FloatVector<Tfloat> &first, const FloatVector<Tfloat> &second,
+         FloatVector<Tfloat> &result) {
+	const auto operation = [](const Tfloat &augend, const Tfloat &addend) {
+		return augend + addend;
+	};
+
+	using kernels = detail::simd::kernels<Tfloat>;
+	if constexpr (kernels::ENABLED) {
+		FloatVector<Tfloat>::template transform<kernels::WIDTH>(
+		    first, second, result, operation, kernels::add);
+	} else {
+		FloatVector<Tfloat>::transform(first, second, result, operation);
+	}
+}
+
+//! Stores the differences of the values of `first` and `second` in `result`,
+//! see `FloatVector::transform`.
+template <typename Tfloat>
+void sub(const FloatVector<Tfloat> &first, const FloatVector<Tfloat> &second,
+         FloatVector<Tfloat> &result) {
+	FloatVector<Tfloat>::transform(
+	    first, second, result,
+	    [](const Tfloat &minuend, const Tfloat &subtrahend) {
+		    return minuend - subtrahend;
+	    });
+}
+
+//! Stores the products of the values of `first` and `second` in `result`,
+//! see `FloatVector::transform`.
+template <typename Tfloat>
+void mul(const FloatVector<Tfloat> &first, const FloatVector<Tfloat> &second,
+         FloatVector<Tfloat> &result) {
+	const auto operation = [](const Tfloat &factor, const Tfloat &other) {
+		return factor * other;
+	};
+
+	using kernels = detail::simd::kernels<Tfloat>;
+	if constexpr (kernels::ENABLED) {
+		FloatVector<Tfloat>::template transform<kernels::WIDTH>(
+		    first, second, result, operation, kernels::mul);
+	} else {
+		FloatVector<Tfloat>::transform(first, second, result, operation);
+	}
+}
+
+//! Stores the quotients of the values of `first` and `second` in `result`,
+//! see `FloatVector::transform`.
+template <typename Tfloat>
+void div(const FloatVector<Tfloat> &first, const FloatVector<Tfloat> &second,
+         FloatVector<Tfloat> &result) {
+	FloatVector<Tfloat>::transform(
+	    first, second, result,
+	    [](const Tfloat &dividend, const Tfloat &divisor) {
+		    return dividend / divisor;
+	    });
+}
+
+//! Stores the values of `source` multiplied by `BASE ^ n` in `result`, see
+//! `FloatVector::scale`.
+template <typename Tfloat>
+void scale(const FloatVector<Tfloat> &source, const std::intmax_t n,
+           FloatVector<Tfloat> &result) {
+	FloatVector<Tfloat>::scale(source, n, result);
+}
+
+//! Sorts the values of `target` in ascending order, with not a number last,
+//! see `FloatVector::sort`.  Unlike `std::sort`, this takes a constant number
+//! of passes over the values.
+template <typename Tfloat> void sort(FloatVector<Tfloat> &target) {
+	FloatVector<Tfloat>::sort(target);
+}
+
+//! Converts `count` native floats of `source` into `result`, which gets
+//! resized to `count`.  Each value is converted like `Tfloat(double)` does,
+//! truncating towards zero.
+//!
+//! For `fas::Float<int16_t, int8_t>` and doubles, this uses AVX2 kernels if
+//! the processor supports them.
+template <typename Tfloat, typename Tnative>
+void convert(const Tnative *source, const std::size_t count,
+             FloatVector<Tfloat> &result) {
+	using kernels = detail::simd::kernels<Tfloat>;
+	if constexpr (kernels::ENABLED && std::is_same<Tnative, double>::value) {
+		FloatVector<Tfloat>::template convert<kernels::WIDTH>(
+		    source, count, result, kernels::from_double);
+	} else {
+		FloatVector<Tfloat>::convert(source, count, result);
+	}
+}
+
+//! Converts the values of `source` into the native floats at `target`,
+//! which needs to hold `source.size()` values.  Each value is converted like
+//! `Tfloat::operator Tnative` does.
+//!
+//! For `fas::Float<int16_t, int8_t>` and doubles, this uses AVX2 kernels if
+//! the processor supports them.
+template <typename Tfloat, typename Tnative>
+void convert(const FloatVector<Tfloat> &source, Tnative *target) {
+	using kernels = detail::simd::kernels<Tfloat>;
+	if constexpr (kernels::ENABLED && std::is_same<Tnative, double>::value) {
+		FloatVector<Tfloat>::template convert<kernels::WIDTH>(source, target,
+		                                                      kernels::to_double);
+	} else {
+		FloatVector<Tfloat>::convert(source, target);
+	}
+}
+
+//! Compares the values of `first` and `second` and stores `-1`, `0` or `1`
+//! in `result`, if the value of `first` is smaller, equal or larger.  Only
+//! the common values are compared and `result` gets resized to their number.
+template <typename Tfloat, typename Tresult>
+void compare(const FloatVector<Tfloat> &first,
+             const FloatVector<Tfloat> &second, std::vector<Tresult> &result) {
+	const auto size = std::min(first.size(), second.size());
+	result.resize(size);
+
+	for (std::size_t i = 0; i < size; ++i) {
+		const auto first_value = first[i];
+		const auto second_value = second[i];
+		result[i] = first_value < second_value
+		                ? Tresult(-1)
+		                : (first_value == second_value ? Tresult(0) : Tresult(1));
+	}
+}
+} // namespace fas
+#endif // FLOATING_POINT_VECTOR_HPP
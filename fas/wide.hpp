@@ -0,0 +1,795 @@
+#ifndef FLOATING_POINT_WIDE_HPP
+#define FLOATING_POINT_WIDE_HPP
+#include "fas/float.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace fas {
+namespace detail {
+
+//! The number of binary digits of a limb of `WideInt`.
+constexpr int LIMB_DIGITS = 64;
+
+//! @returns The low limb of `first * second + addend + carry` and stores its
+//! high limb in `carry`.  The result cannot overflow two limbs.
+constexpr std::uint64_t multiply_add(const std::uint64_t first,
+                                     const std::uint64_t second,
+                                     const std::uint64_t addend,
+                                     std::uint64_t &carry) noexcept {
+#if defined(__SIZEOF_INT128__)
+	const auto result = static_cast<unsigned __int128>(first) * second +
+	                    addend + carry;
+	carry = static_cast<std::uint64_t>(result >> LIMB_DIGITS);
+	return static_cast<std::uint64_t>(result);
+#else
+	// Multiplies the halves, whose products fit into a limb.
+	constexpr std::uint64_t mask = 0xffffffff;
+	const auto low_low = (first & mask) * (second & mask);
+	const auto low_high = (first & mask) * (second >> 32);
+	const auto high_low = (first >> 32) * (second & mask);
+	const auto high_high = (first >> 32) * (second >> 32);
+	const auto middle = (low_low >> 32) + (low_high & mask) + (high_low & mask);
+
+	auto low = (middle << 32) | (low_low & mask);
+	auto high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+	low += addend;
+	high += low < addend;
+	low += carry;
+	high += low < carry;
+	carry = high;
+	return low;
+#endif
+}
+
+//! Whether `T` is a `WideInt`.
+template <typename T> struct is_wide : std::false_type {};
+
+template <std::size_t LIMBS, bool SIGNED>
+struct is_wide<WideInt<LIMBS, SIGNED>> : std::true_type {};
+
+//! @returns The number of leading zero bits of a nonzero digit of 32 bits.
+constexpr int leading_zeros(const std::uint32_t digit) noexcept {
+	return 32 - bit_width(static_cast<unsigned long long>(digit));
+}
+
+//! Subtracts `factor` times the `n` digits of `divisor` from the digits of
+//! `target` starting at `offset`, like a step of a long division does.  Adds
+//! the divisor back, if `factor` was one too large.
+//!
+//! @returns The digit of the quotient, which is `factor` or `factor - 1`.
+template <std::size_t SIZE, std::size_t DIVISOR_SIZE>
+constexpr std::uint64_t
+subtract_multiple(std::array<std::uint32_t, SIZE> &target,
+                  const std::size_t offset,
+                  const std::array<std::uint32_t, DIVISOR_SIZE> &divisor,
+                  const std::size_t n, const std::uint64_t factor) noexcept {
+	std::int64_t borrow = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto product = factor * divisor[i];
+		const auto difference = static_cast<std::int64_t>(target[offset + i]) -
+		                        borrow -
+		                        static_cast<std::int64_t>(product & 0xffffffff);
+		target[offset + i] = static_cast<std::uint32_t>(difference);
+		borrow = static_cast<std::int64_t>(product >> 32) - (difference >> 32);
+	}
+	const auto difference =
+	    static_cast<std::int64_t>(target[offset + n]) - borrow;
+	target[offset + n] = static_cast<std::uint32_t>(difference);
+	if (difference >= 0) {
+		return factor;
+	}
+
+	std::uint64_t carry = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto sum =
+		    static_cast<std::uint64_t>(target[offset + i]) + divisor[i] + carry;
+		target[offset + i] = static_cast<std::uint32_t>(sum);
+		carry = sum >> 32;
+	}
+	target[offset + n] += static_cast<std::uint32_t>(carry);
+	return factor - 1;
+}
+
+} // namespace detail
+
+//! An integer of `LIMBS` limbs of 64 bits, which is stored on the stack and
+//! may be used as the mantissa of `Float`, for example
+//! `Float<WideInt<4>, std::int32_t>` with a mantissa of 255 bits.  It
+//! provides the operators of the native integers, which wrap around like
+//! unsigned integers do.  Products and quotients of floats use the integers
+//! of twice the limbs, so they are exact before they get rounded.
+//!
+//! Class types are template arguments since C++20, so `Float` takes
+//! `WideInt` as its mantissa only since then.  `WideInt` itself needs C++17.
+//!
+//! @tparam LIMBS The number of limbs, needs to be `>= 1`.
+//! @tparam SIGNED Whether the integer is signed, it is stored as two's
+//!         complement then.
+template <std::size_t LIMBS, bool SIGNED> struct WideInt {
+	static_assert(LIMBS >= 1, "WideInt needs at least one limb.");
+
+	//! The type of `this`.
+	using self_t = WideInt<LIMBS, SIGNED>;
+
+	//! The limbs, the least significant one first.  They are public, so
+	//! `WideInt` may be a template argument.
+	std::array<std::uint64_t, LIMBS> limbs{};
+
+	constexpr WideInt() noexcept = default;
+
+	//! Converts an integer, negative ones get sign extended.
+	//!
+	//! @param value The integer to convert.
+	template <typename Tinteger,
+	          typename = std::enable_if_t<detail::is_integer<Tinteger>::value &&
+	                                      !detail::is_wide<Tinteger>::value>>
+	constexpr WideInt(const Tinteger value) noexcept {
+		if constexpr (std::is_same<Tinteger, bool>::value) {
+			limbs[0] = value;
+		} else {
+			constexpr int digits = detail::digits<Tinteger>;
+			const std::uint64_t fill = value < Tinteger(0) ? ~std::uint64_t(0) : 0;
+			auto bits =
+			    static_cast<typename detail::make_unsigned<Tinteger>::type>(value);
+			for (std::size_t i = 0; i < LIMBS; ++i) {
+				if (static_cast<int>(i) * detail::LIMB_DIGITS >= digits) {
+					limbs[i] = fill;
+				} else if (static_cast<int>(i + 1) * detail::LIMB_DIGITS > digits) {
+					// Extends the most significant limb of narrower integers.
+					limbs[i] = static_cast<std::uint64_t>(bits) |
+					           (fill << (digits % detail::LIMB_DIGITS));
+				} else {
+					limbs[i] = static_cast<std::uint64_t>(bits);
+					if constexpr (digits > detail::LIMB_DIGITS) {
+						bits >>= detail::LIMB_DIGITS;
+					}
+				}
+			}
+		}
+	}
+
+	//! Converts a narrower `WideInt` or one of the same limbs, which is
+	//! signed, implicitly.  So mixed operands get converted like native
+	//! integers do.
+	//!
+	//! @param other The integer to convert.
+	template <std::size_t OTHER_LIMBS, bool OTHER_SIGNED,
+	          std::enable_if_t<(OTHER_LIMBS < LIMBS ||
+	                            (OTHER_LIMBS == LIMBS && !SIGNED)),
+	                           int> = 0>
+	constexpr WideInt(const WideInt<OTHER_LIMBS, OTHER_SIGNED> &other) noexcept
+	    : WideInt(other, 0) {}
+
+	//! Converts a wider `WideInt`, which gets truncated, or an unsigned one of
+	//! the same limbs to a signed one.
+	//!
+	//! @param other The integer to convert.
+	template <std::size_t OTHER_LIMBS, bool OTHER_SIGNED,
+	          std::enable_if_t<!(OTHER_LIMBS < LIMBS ||
+	                             (OTHER_LIMBS == LIMBS && !SIGNED)),
+	                           int> = 0>
+	explicit constexpr WideInt(
+	    const WideInt<OTHER_LIMBS, OTHER_SIGNED> &other) noexcept
+	    : WideInt(other, 0) {}
+
+#if !defined(FAS_FREESTANDING)
+	//! Converts a native float, which gets truncated towards zero.  The float
+	//! needs to be representable.
+	//!
+	//! @param value The float to convert.
+	template <typename Tvalue,
+	          typename = std::enable_if_t<std::is_floating_point<Tvalue>::value &&
+	                                      !detail::is_float<Tvalue>::value>,
+	          typename = void>
+	explicit constexpr WideInt(Tvalue value) noexcept {
+		const bool negative = value < 0;
+		if (negative) {
+			value = -value;
+		}
+
+		// Takes the limbs from the most significant one, each one is an integer
+		// below `2 ^ 64` after the higher ones got subtracted.
+		constexpr auto limb = static_cast<Tvalue>(18446744073709551616.0);
+		Tvalue power = 1;
+		std::size_t top = 0;
+		while (top + 1 < LIMBS && power * limb <= value) {
+			power *= limb;
+			++top;
+		}
+		for (auto i = top + 1; i-- > 0; power /= limb) {
+			const auto digit = static_cast<std::uint64_t>(value / power);
+			limbs[i] = digit;
+			value -= static_cast<Tvalue>(digit) * power;
+		}
+		if (negative) {
+			*this = -*this;
+		}
+	}
+
+	//! @returns The value as a native float, which might get rounded.
+	template <typename Tvalue,
+	          typename = std::enable_if_t<std::is_floating_point<Tvalue>::value &&
+	                                      !detail::is_float<Tvalue>::value>,
+	          typename = void>
+	explicit constexpr operator Tvalue() const noexcept {
+		const auto source = magnitude();
+		Tvalue result = 0;
+		for (auto i = LIMBS; i-- > 0;) {
+			result = result * static_cast<Tvalue>(18446744073709551616.0) +
+			         static_cast<Tvalue>(source.limbs[i]);
+		}
+		return negative() ? -result : result;
+	}
+#endif
+
+	//! @returns The value truncated to the given integer type.
+	template <typename Tinteger,
+	          typename = std::enable_if_t<detail::is_integer<Tinteger>::value &&
+	                                      !detail::is_wide<Tinteger>::value &&
+	                                      !std::is_same<Tinteger, bool>::value>>
+	explicit constexpr operator Tinteger() const noexcept {
+		using Tunsigned = typename detail::make_unsigned<Tinteger>::type;
+		if constexpr (detail::digits<Tunsigned> <= detail::LIMB_DIGITS) {
+			return static_cast<Tinteger>(static_cast<Tunsigned>(limbs[0]));
+		} else {
+			Tunsigned result = 0;
+			for (auto i = LIMBS; i-- > 0;) {
+				result = (result << detail::LIMB_DIGITS) |
+				         static_cast<Tunsigned>(limbs[i]);
+			}
+			return static_cast<Tinteger>(result);
+		}
+	}
+
+	//! @returns Whether the value is not zero.
+	explicit constexpr operator bool() const noexcept {
+		std::uint64_t any = 0;
+		for (const auto limb : limbs) {
+			any |= limb;
+		}
+		return any != 0;
+	}
+
+	//! @returns Whether the value is negative.
+	constexpr bool negative() const noexcept {
+		return SIGNED && (limbs[LIMBS - 1] >> (detail::LIMB_DIGITS - 1)) != 0;
+	}
+
+	//! @returns The absolute value as unsigned integer, which holds the
+	//! magnitude of the lowest value too.
+	constexpr WideInt<LIMBS, false> magnitude() const noexcept {
+		const auto result = WideInt<LIMBS, false>(*this);
+		return negative() ? -result : result;
+	}
+
+	//! @returns The number of binary digits needed to represent the value,
+	//! which is taken as unsigned.  Skips the zero limbs and counts the
+	//! leading zeros of the first other one.
+	constexpr int bit_width() const noexcept {
+		for (auto i = LIMBS; i-- > 0;) {
+			if (limbs[i] != 0) {
+				return static_cast<int>(i) * detail::LIMB_DIGITS +
+				       detail::bit_width(static_cast<unsigned long long>(limbs[i]));
+			}
+		}
+		return 0;
+	}
+
+	//! @returns The number of limbs without the leading zero ones.
+	constexpr std::size_t used_limbs() const noexcept {
+		auto result = LIMBS;
+		while (result > 0 && limbs[result - 1] == 0) {
+			--result;
+		}
+		return result;
+	}
+
+	constexpr self_t operator+() const noexcept { return *this; }
+
+	constexpr self_t operator-() const noexcept {
+		self_t result;
+		std::uint64_t carry = 1;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			result.limbs[i] = ~limbs[i] + carry;
+			carry = carry && result.limbs[i] == 0;
+		}
+		return result;
+	}
+
+	constexpr self_t operator~() const noexcept {
+		self_t result;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			result.limbs[i] = ~limbs[i];
+		}
+		return result;
+	}
+
+	constexpr bool operator!() const noexcept {
+		return !static_cast<bool>(*this);
+	}
+
+	//! Adds limb by limb and carries.
+	friend constexpr self_t operator+(const self_t &first,
+	                                  const self_t &second) noexcept {
+		self_t result;
+		std::uint64_t carry = 0;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			const auto sum = first.limbs[i] + second.limbs[i];
+			result.limbs[i] = sum + carry;
+			carry = (sum < first.limbs[i]) | (result.limbs[i] < sum);
+		}
+		return result;
+	}
+
+	//! Subtracts limb by limb and borrows.
+	friend constexpr self_t operator-(const self_t &first,
+	                                  const self_t &second) noexcept {
+		self_t result;
+		std::uint64_t borrow = 0;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			const auto difference = first.limbs[i] - second.limbs[i];
+			result.limbs[i] = difference - borrow;
+			borrow = (first.limbs[i] < second.limbs[i]) | (difference < borrow);
+		}
+		return result;
+	}
+
+	//! Multiplies the magnitudes by the schoolbook method, the limbs beyond the
+	//! result are skipped.  Karatsuba's method pays off for thousands of bits
+	//! only.
+	friend constexpr self_t operator*(const self_t &first,
+	                                  const self_t &second) noexcept {
+		const auto first_magnitude = first.magnitude();
+		const auto second_magnitude = second.magnitude();
+		const auto first_limbs = first_magnitude.used_limbs();
+		const auto second_limbs = second_magnitude.used_limbs();
+
+		WideInt<LIMBS, false> product;
+		for (std::size_t i = 0; i < first_limbs; ++i) {
+			std::uint64_t carry = 0;
+			const auto end = std::min(second_limbs, LIMBS - i);
+			for (std::size_t j = 0; j < end; ++j) {
+				product.limbs[i + j] =
+				    detail::multiply_add(first_magnitude.limbs[i],
+				                         second_magnitude.limbs[j],
+				                         product.limbs[i + j], carry);
+			}
+			if (i + end < LIMBS) {
+				product.limbs[i + end] = carry;
+			}
+		}
+
+		const auto result = self_t(product);
+		return first.negative() != second.negative() ? -result : result;
+	}
+
+	//! Divides towards zero like the native integers do.
+	//!
+	//! @param divisor The divisor, needs to be nonzero.
+	friend constexpr self_t operator/(const self_t &dividend,
+	                                  const self_t &divisor) noexcept {
+		WideInt<LIMBS, false> quotient;
+		WideInt<LIMBS, false> remainder;
+		divide(dividend.magnitude(), divisor.magnitude(), quotient, remainder);
+		const auto result = self_t(quotient);
+		return dividend.negative() != divisor.negative() ? -result : result;
+	}
+
+	//! @returns The remainder of `operator/`, which has the sign of the
+	//! dividend.
+	friend constexpr self_t operator%(const self_t &dividend,
+	                                  const self_t &divisor) noexcept {
+		WideInt<LIMBS, false> quotient;
+		WideInt<LIMBS, false> remainder;
+		divide(dividend.magnitude(), divisor.magnitude(), quotient, remainder);
+		const auto result = self_t(remainder);
+		return dividend.negative() ? -result : result;
+	}
+
+	friend constexpr self_t operator&(const self_t &first,
+	                                  const self_t &second) noexcept {
+		self_t result;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			result.limbs[i] = first.limbs[i] & second.limbs[i];
+		}
+		return result;
+	}
+
+	friend constexpr self_t operator|(const self_t &first,
+	                                  const self_t &second) noexcept {
+		self_t result;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			result.limbs[i] = first.limbs[i] | second.limbs[i];
+		}
+		return result;
+	}
+
+	friend constexpr self_t operator^(const self_t &first,
+	                                  const self_t &second) noexcept {
+		self_t result;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			result.limbs[i] = first.limbs[i] ^ second.limbs[i];
+		}
+		return result;
+	}
+
+	//! Shifts by whole limbs and the remaining bits.  Shifts by all digits or
+	//! more result in zero.
+	//!
+	//! @param shift The number of bits, needs to be `>= 0`.
+	constexpr self_t operator<<(const int shift) const noexcept {
+		const auto whole = static_cast<std::size_t>(shift) / detail::LIMB_DIGITS;
+		const auto bits = shift % detail::LIMB_DIGITS;
+		self_t result;
+		for (auto i = LIMBS; i-- > whole;) {
+			result.limbs[i] = limbs[i - whole] << bits;
+			if (bits != 0 && i > whole) {
+				result.limbs[i] |=
+				    limbs[i - whole - 1] >> (detail::LIMB_DIGITS - bits);
+			}
+		}
+		return result;
+	}
+
+	//! Shifts by whole limbs and the remaining bits, signed integers get
+	//! extended by their sign.
+	//!
+	//! @param shift The number of bits, needs to be `>= 0`.
+	constexpr self_t operator>>(const int shift) const noexcept {
+		const auto whole = static_cast<std::size_t>(shift) / detail::LIMB_DIGITS;
+		const auto bits = shift % detail::LIMB_DIGITS;
+		const std::uint64_t fill = negative() ? ~std::uint64_t(0) : 0;
+		self_t result;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			const auto low = i + whole;
+			const auto high = low + 1;
+			const auto low_limb = low < LIMBS ? limbs[low] : fill;
+			const auto high_limb = high < LIMBS ? limbs[high] : fill;
+			result.limbs[i] =
+			    bits == 0 ? low_limb
+			              : (low_limb >> bits) |
+			                    (high_limb << (detail::LIMB_DIGITS - bits));
+		}
+		return result;
+	}
+
+	friend constexpr bool operator==(const self_t &first,
+	                                 const self_t &second) noexcept {
+		std::uint64_t difference = 0;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			difference |= first.limbs[i] ^ second.limbs[i];
+		}
+		return difference == 0;
+	}
+
+	friend constexpr bool operator!=(const self_t &first,
+	                                 const self_t &second) noexcept {
+		return !(first == second);
+	}
+
+	//! Compares the most significant limbs first, whose sign bits decide for
+	//! signed integers.
+	friend constexpr bool operator<(const self_t &first,
+	                                const self_t &second) noexcept {
+		if (first.negative() != second.negative()) {
+			return first.negative();
+		}
+		for (auto i = LIMBS; i-- > 0;) {
+			if (first.limbs[i] != second.limbs[i]) {
+				return first.limbs[i] < second.limbs[i];
+			}
+		}
+		return false;
+	}
+
+	friend constexpr bool operator>(const self_t &first,
+	                                const self_t &second) noexcept {
+		return second < first;
+	}
+
+	friend constexpr bool operator<=(const self_t &first,
+	                                 const self_t &second) noexcept {
+		return !(second < first);
+	}
+
+	friend constexpr bool operator>=(const self_t &first,
+	                                 const self_t &second) noexcept {
+		return !(first < second);
+	}
+
+	constexpr self_t &operator+=(const self_t &other) noexcept {
+		return *this = *this + other;
+	}
+
+	constexpr self_t &operator-=(const self_t &other) noexcept {
+		return *this = *this - other;
+	}
+
+	constexpr self_t &operator*=(const self_t &other) noexcept {
+		return *this = *this * other;
+	}
+
+	constexpr self_t &operator/=(const self_t &other) noexcept {
+		return *this = *this / other;
+	}
+
+	constexpr self_t &operator%=(const self_t &other) noexcept {
+		return *this = *this % other;
+	}
+
+	constexpr self_t &operator&=(const self_t &other) noexcept {
+		return *this = *this & other;
+	}
+
+	constexpr self_t &operator|=(const self_t &other) noexcept {
+		return *this = *this | other;
+	}
+
+	constexpr self_t &operator^=(const self_t &other) noexcept {
+		return *this = *this ^ other;
+	}
+
+	constexpr self_t &operator<<=(const int shift) noexcept {
+		return *this = *this << shift;
+	}
+
+	constexpr self_t &operator>>=(const int shift) noexcept {
+		return *this = *this >> shift;
+	}
+
+	constexpr self_t &operator++() noexcept { return *this += 1; }
+
+	constexpr self_t &operator--() noexcept { return *this -= 1; }
+
+	constexpr self_t operator++(int) noexcept {
+		const auto result = *this;
+		++*this;
+		return result;
+	}
+
+	constexpr self_t operator--(int) noexcept {
+		const auto result = *this;
+		--*this;
+		return result;
+	}
+
+private:
+	//! Integers of other limbs get converted limb by limb.
+	template <std::size_t, bool> friend struct WideInt;
+
+	//! Converts another `WideInt`, which gets truncated or extended by its
+	//! sign.
+	template <std::size_t OTHER_LIMBS, bool OTHER_SIGNED>
+	constexpr WideInt(const WideInt<OTHER_LIMBS, OTHER_SIGNED> &other,
+	                  int) noexcept {
+		const std::uint64_t fill = other.negative() ? ~std::uint64_t(0) : 0;
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			limbs[i] = i < OTHER_LIMBS ? other.limbs[i] : fill;
+		}
+	}
+
+	//! The number of digits of 32 bits, by which `divide` divides.
+	constexpr static std::size_t DIGITS = 2 * LIMBS;
+
+	//! Divides the magnitudes by Knuth's algorithm D on digits of 32 bits, so
+	//! the estimates of the quotient's digits fit into a limb.  Divisors of a
+	//! single digit take a short division.
+	//!
+	//! @param dividend The dividend.
+	//! @param divisor The divisor, needs to be nonzero.
+	//! @param quotient Gets the quotient, rounded towards zero.
+	//! @param remainder Gets the remainder.
+	constexpr static void divide(const WideInt<LIMBS, false> &dividend,
+	                             const WideInt<LIMBS, false> &divisor,
+	                             WideInt<LIMBS, false> &quotient,
+	                             WideInt<LIMBS, false> &remainder) noexcept {
+		assert(divisor != 0);
+		constexpr std::uint64_t digit_base = std::uint64_t(1) << 32;
+
+		std::array<std::uint32_t, DIGITS + 1> u{};
+		std::array<std::uint32_t, DIGITS> v{};
+		std::array<std::uint32_t, DIGITS> q{};
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			u[2 * i] = static_cast<std::uint32_t>(dividend.limbs[i]);
+			u[2 * i + 1] = static_cast<std::uint32_t>(dividend.limbs[i] >> 32);
+			v[2 * i] = static_cast<std::uint32_t>(divisor.limbs[i]);
+			v[2 * i + 1] = static_cast<std::uint32_t>(divisor.limbs[i] >> 32);
+		}
+
+		auto m = DIGITS;
+		while (m > 0 && u[m - 1] == 0) {
+			--m;
+		}
+		auto n = DIGITS;
+		while (n > 0 && v[n - 1] == 0) {
+			--n;
+		}
+
+		quotient = 0;
+		remainder = dividend;
+		if (m < n) {
+			return;
+		}
+
+		if (n == 1) {
+			std::uint64_t rest = 0;
+			for (auto i = m; i-- > 0;) {
+				const auto current = (rest << 32) | u[i];
+				q[i] = static_cast<std::uint32_t>(current / v[0]);
+				rest = current % v[0];
+			}
+			remainder = rest;
+		} else {
+			// Normalizes the divisor, so its leading digit has its top bit set.
+			const int shift = detail::leading_zeros(v[n - 1]);
+			const auto shifted = [shift](const std::uint32_t high,
+			                             const std::uint32_t low) {
+				return shift == 0 ? high
+				                  : static_cast<std::uint32_t>(
+				                        (high << shift) | (low >> (32 - shift)));
+			};
+			for (auto i = n; i-- > 1;) {
+				v[i] = shifted(v[i], v[i - 1]);
+			}
+			v[0] <<= shift;
+			u[m] = shift == 0 ? 0 : u[m - 1] >> (32 - shift);
+			for (auto i = m; i-- > 1;) {
+				u[i] = shifted(u[i], u[i - 1]);
+			}
+			u[0] <<= shift;
+
+			for (auto j = m - n + 1; j-- > 0;) {
+				// Estimates the digit, which is at most two too large.
+				const auto top =
+				    (static_cast<std::uint64_t>(u[j + n]) << 32) | u[j + n - 1];
+				auto estimate = top / v[n - 1];
+				auto rest = top % v[n - 1];
+				while (estimate >= digit_base ||
+				       estimate * v[n - 2] > ((rest << 32) | u[j + n - 2])) {
+					--estimate;
+					rest += v[n - 1];
+					if (rest >= digit_base) {
+						break;
+					}
+				}
+
+				q[j] = static_cast<std::uint32_t>(
+				    detail::subtract_multiple(u, j, v, n, estimate));
+			}
+
+			remainder = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				auto digit = u[i] >> shift;
+				if (shift != 0) {
+					digit |= u[i + 1] << (32 - shift);
+				}
+				remainder.limbs[i / 2] |= static_cast<std::uint64_t>(digit)
+				                          << (i % 2 * 32);
+			}
+		}
+
+		for (std::size_t i = 0; i < LIMBS; ++i) {
+			quotient.limbs[i] =
+			    q[2 * i] | (static_cast<std::uint64_t>(q[2 * i + 1]) << 32);
+		}
+	}
+};
+
+//! An unsigned integer of `LIMBS` limbs of 64 bits, see `WideInt`.
+template <std::size_t LIMBS> using WideUInt = WideInt<LIMBS, false>;
+
+//! Writes `value` in decimal like `std::to_chars` does for integers.
+//!
+//! @returns The end of the characters written and `std::errc()`, or `last`
+//!          and `std::errc::value_too_large`, if they do not fit.
+template <std::size_t LIMBS, bool SIGNED>
+std::to_chars_result to_chars(char *const first, char *const last,
+                              const WideInt<LIMBS, SIGNED> &value) noexcept {
+	// Splits off 19 decimal digits per division, the most a limb holds.  A
+	// limb takes 20 digits at most, including the sign.
+	constexpr std::uint64_t split = 10000000000000000000u;
+	std::array<char, LIMBS * 20 + 1> digits{};
+	auto *const end = digits.data() + digits.size();
+	auto *begin = end;
+
+	auto magnitude = value.magnitude();
+	do {
+		const auto quotient = magnitude / split;
+		auto rest = static_cast<std::uint64_t>(magnitude - quotient * split);
+		magnitude = quotient;
+		for (int i = 0; i < 19 && (rest != 0 || magnitude != 0); ++i) {
+			*--begin = static_cast<char>('0' + rest % 10);
+			rest /= 10;
+		}
+	} while (magnitude != 0);
+
+	if (begin == end) {
+		*--begin = '0';
+	}
+	if (value.negative()) {
+		*--begin = '-';
+	}
+
+	if (last - first < end - begin) {
+		return {last, std::errc::value_too_large};
+	}
+	return {std::copy(begin, end, first), std::errc()};
+}
+
+namespace detail {
+
+template <std::size_t LIMBS, bool SIGNED>
+constexpr int bit_width(const WideInt<LIMBS, SIGNED> &value) noexcept {
+	return value.bit_width();
+}
+
+template <std::size_t LIMBS, bool SIGNED>
+struct is_integer<WideInt<LIMBS, SIGNED>> : std::true_type {};
+
+template <std::size_t LIMBS, bool SIGNED>
+struct make_unsigned<WideInt<LIMBS, SIGNED>> {
+	using type = WideInt<LIMBS, false>;
+};
+
+//! Integers of limbs are multiplied in twice the limbs.
+template <std::size_t LIMBS, bool SIGNED>
+struct wider<WideInt<LIMBS, SIGNED>> {
+	using type = WideInt<2 * LIMBS, SIGNED>;
+};
+
+} // namespace detail
+} // namespace fas
+
+namespace std {
+template <std::size_t LIMBS, bool SIGNED>
+struct numeric_limits<fas::WideInt<LIMBS, SIGNED>> {
+	using type = fas::WideInt<LIMBS, SIGNED>;
+
+	constexpr static bool is_specialized = true;
+	constexpr static bool is_signed = SIGNED;
+	constexpr static bool is_integer = true;
+	constexpr static bool is_exact = true;
+	constexpr static bool has_infinity = false;
+	constexpr static bool has_quiet_NaN = false;
+	constexpr static bool has_signaling_NaN = false;
+	constexpr static bool has_denorm_loss = false;
+	constexpr static float_denorm_style has_denorm = denorm_absent;
+	constexpr static float_round_style round_style = round_toward_zero;
+	constexpr static bool is_iec559 = false;
+	constexpr static bool is_bounded = true;
+	constexpr static bool is_modulo = !SIGNED;
+	constexpr static int digits =
+	    static_cast<int>(LIMBS) * fas::detail::LIMB_DIGITS - SIGNED;
+	constexpr static int digits10 = digits * 30103 / 100000;
+	constexpr static int max_digits10 = 0;
+	constexpr static int radix = 2;
+	constexpr static int min_exponent = 0;
+	constexpr static int min_exponent10 = 0;
+	constexpr static int max_exponent = 0;
+	constexpr static int max_exponent10 = 0;
+	constexpr static bool traps = true;
+	constexpr static bool tinyness_before = false;
+
+	constexpr static type min() noexcept {
+		return SIGNED ? type(1) << (digits) : type(0);
+	}
+	constexpr static type lowest() noexcept { return min(); }
+	constexpr static type max() noexcept { return ~min(); }
+	constexpr static type epsilon() noexcept { return 0; }
+	constexpr static type round_error() noexcept { return 0; }
+	constexpr static type infinity() noexcept { return 0; }
+	constexpr static type quiet_NaN() noexcept { return 0; }
+	constexpr static type signaling_NaN() noexcept { return 0; }
+	constexpr static type denorm_min() noexcept { return 0; }
+};
+} // namespace std
+
+#endif // FLOATING_POINT_WIDE_HPP
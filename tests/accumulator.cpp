@@ -0,0 +1,193 @@
+#include "test_utils.hpp"
+
+#include "fas/accumulator.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+using short_t = Float<int16_t, int8_t>;
+
+//! The exact sums below are held as fixed point integers of this scale.
+constexpr int SCALE = 40;
+
+//! @returns `value`, which needs an exponent of at least `-SCALE`, as fixed
+//!          point integer.
+__int128 fixed(const short_t &value) {
+	return static_cast<__int128>(value.mantissa()) << (value.exponent() + SCALE);
+}
+
+//! Requires that `result` is `exact` truncated towards zero.
+void require_truncated(const short_t &result, const __int128 exact) {
+	const auto magnitude = exact < 0 ? -exact : exact;
+	const auto result_magnitude = fixed(result) < 0 ? -fixed(result)
+	                                                : fixed(result);
+	REQUIRE(result_magnitude <= magnitude);
+
+	// The next larger magnitude exceeds the exact one.
+	const auto mantissa = result.mantissa() < 0 ? -result.mantissa()
+	                                            : result.mantissa();
+	REQUIRE((static_cast<__int128>(mantissa) + 1)
+	            << (result.exponent() + SCALE) >
+	        magnitude);
+	REQUIRE((exact < 0) == (result.mantissa() < 0));
+}
+
+} // namespace
+
+TEST_CASE("Accumulators start at zero.") {
+	REQUIRE(Accumulator<short_t>().result() == short_t::ZERO());
+
+	Accumulator<short_t> target;
+	target.add(short_t(3));
+	target.add(short_t(-3));
+	REQUIRE(target.result() == short_t::ZERO());
+}
+
+TEST_CASE("Accumulators hold the integer of every exponent.") {
+	REQUIRE(Accumulator<short_t>::SIZE == 19);
+	REQUIRE(sizeof(Accumulator<short_t>) <= 192);
+	REQUIRE(Accumulator<float8_t>::LOWEST == -256);
+	REQUIRE(Accumulator<float8_t>::HIGHEST == 254);
+}
+
+TEST_CASE("Accumulators sum without intermediate rounding.") {
+	Accumulator<short_t> target;
+	target.add(short_t::MAX());
+	target.add(short_t::MAX());
+	target.add(-short_t::MAX());
+	REQUIRE(target.result() == short_t::MAX());
+
+	const short_t smallest(int16_t(0x4000), int8_t(-128));
+	Accumulator<short_t> tiny;
+	tiny.add(short_t(1e30));
+	tiny.add(smallest);
+	tiny.add(short_t(-1e30));
+	REQUIRE(tiny.result() == smallest);
+
+	Accumulator<float8_t> small;
+	small.add(float8_t(64));
+	for (int i = 0; i < 200; ++i) {
+		small.add(float8_t(0.25));
+	}
+	REQUIRE(small.result() == 114);
+}
+
+TEST_CASE("Accumulators truncate once.") {
+	std::mt19937 generator(16);
+	std::uniform_int_distribution<int16_t> mantissa;
+	std::uniform_int_distribution<int> exponent(-20, 20);
+
+	for (int round = 0; round < 100; ++round) {
+		Accumulator<short_t> sum;
+		Accumulator<short_t> products;
+		__int128 exact_sum = 0;
+		__int128 exact_products = 0;
+		for (int i = 0; i < 1000; ++i) {
+			const short_t first(mantissa(generator), int8_t(exponent(generator)));
+			const short_t second(mantissa(generator), int8_t(exponent(generator)));
+			sum.add(first);
+			products.add_product(first, second);
+			exact_sum += fixed(first);
+			exact_products += static_cast<__int128>(first.mantissa()) *
+			                  second.mantissa()
+			                  << (first.exponent() + second.exponent() + SCALE);
+		}
+
+		require_truncated(sum.result(), exact_sum);
+		require_truncated(products.result(), exact_products);
+	}
+}
+
+TEST_CASE("Accumulators do not depend on the order.") {
+	std::mt19937 generator(17);
+	std::uniform_int_distribution<int16_t> mantissa;
+	std::uniform_int_distribution<int> exponent(-128, 127);
+
+	std::vector<short_t> values;
+	for (int i = 0; i < 1000; ++i) {
+		values.push_back(
+		    short_t(mantissa(generator), int8_t(exponent(generator))));
+	}
+
+	Accumulator<short_t> forward;
+	for (const auto &value : values) {
+		forward.add(value);
+	}
+
+	std::shuffle(values.begin(), values.end(), generator);
+	Accumulator<short_t> first;
+	Accumulator<short_t> second;
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		(i % 3 == 0 ? first : second).add(values[i]);
+	}
+	second.merge(first);
+
+	REQUIRE(second.result().mantissa() == forward.result().mantissa());
+	REQUIRE(second.result().exponent() == forward.result().exponent());
+}
+
+TEST_CASE("Accumulators add exact products.") {
+	Accumulator<float8_t> target;
+	target.add_product(float8_t(127), float8_t(127));
+	target.add_product(float8_t(-127), float8_t(126));
+	REQUIRE(target.result() == 127);
+
+	Accumulator<float8_t> tiny;
+	tiny.add_product(float8_t::MIN(), float8_t::MIN());
+	tiny.add_product(float8_t::MAX(), float8_t::MAX());
+	REQUIRE(tiny.result() == float8_t::INF());
+}
+
+TEST_CASE("Accumulators propagate special values.") {
+	Accumulator<short_t> target;
+	target.add(short_t(1));
+	target.add(short_t::INF());
+	REQUIRE(target.result() == short_t::INF());
+
+	target.add(short_t::NEGATIVE_INF());
+	REQUIRE(target.result().classify() == classification::not_a_number);
+
+	Accumulator<short_t> negative;
+	negative.add_product(short_t::NEGATIVE_INF(), short_t(2));
+	REQUIRE(negative.result() == short_t::NEGATIVE_INF());
+
+	Accumulator<short_t> undefined;
+	undefined.add_product(short_t::INF(), short_t::ZERO());
+	undefined.merge(negative);
+	REQUIRE(undefined.result().classify() == classification::not_a_number);
+}
+
+TEST_CASE("Accumulators support wide floats.") {
+	using wide_t = Float<int64_t, int16_t>;
+	Accumulator<wide_t> target;
+	target.add(wide_t::MAX());
+	target.add_product(wide_t::MIN(), wide_t::MIN());
+	REQUIRE(target.result() == wide_t::MAX());
+
+	target.add(-wide_t::MAX());
+	REQUIRE(target.result() == wide_t::ZERO());
+
+	using float128_t = Float<__int128, int16_t>;
+	Accumulator<float128_t> wider;
+	wider.add(float128_t::MAX());
+	REQUIRE(wider.result() == float128_t::MAX());
+	wider.add(float128_t::MIN());
+	REQUIRE(wider.result() == float128_t::MAX());
+
+	Accumulator<float128_t> negative;
+	negative.add(-float128_t::MAX());
+	negative.add(-float128_t::MAX());
+	negative.add(float128_t::MAX());
+	REQUIRE(negative.result() == -float128_t::MAX());
+	negative.add(float128_t::MAX());
+	negative.add(float128_t(-3));
+	REQUIRE(negative.result() == -3);
+
+	Accumulator<Float<int32_t, int8_t, 16>> hexadecimal;
+	hexadecimal.add(Float<int32_t, int8_t, 16>(1.5));
+	hexadecimal.add(Float<int32_t, int8_t, 16>(-0.25));
+	REQUIRE(hexadecimal.result() == 1.25);
+}
@@ -85,14 +85,18 @@ TEST_CASE("Adds negative value to negative where the result loses precision.",
 }
 
 TEST_CASE("Expect INF on too large value.") {
-	REQUIRE(float8_t::MAX() + 1 == float8_t::INF());
+	// Adding a tiny value truncates to the largest one.
+	REQUIRE(float8_t::MAX() + 1 == float8_t::MAX());
+	REQUIRE(float8_t::MAX() + float8_t::MAX() == float8_t::INF());
 
 	REQUIRE(float8_t(0x70, 0x7f) + float8_t(0x70, 0x7f) ==
 	        float8_t::INF());
 }
 
 TEST_CASE("Expect NEGATIVE_INF on too small value.") {
-	REQUIRE(float8_t::LOWEST() + -1 == float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t::LOWEST() + -1 == float8_t::LOWEST());
+	REQUIRE(float8_t::LOWEST() + float8_t::LOWEST() ==
+	        float8_t::NEGATIVE_INF());
 	REQUIRE(float8_t(-0x70, 0x7f) + float8_t(-0x70, 0x7f) ==
 	        float8_t::NEGATIVE_INF());
 }
@@ -135,3 +139,28 @@ TEST_CASE("Expect += do be defined.") {
 	target += float8_t(1);
 	REQUIRE(target == 3);
 }
+
+TEST_CASE("Adding integers.") {
+	using Float16T = Float<int16_t, int8_t>;
+
+	REQUIRE(Float16T(0.5) + 1 == 1.5);
+	REQUIRE(Float16T(0.5) + static_cast<std::int64_t>(-1) == -0.5);
+	REQUIRE(Float16T(0.5) + 1u == 1.5);
+	REQUIRE(Float16T(1000) - 1 == 999);
+	REQUIRE(Float16T::ZERO() + 7 == 7);
+	REQUIRE(Float16T::INF() - 1 == Float16T::INF());
+}
+
+TEST_CASE("Adding values of distant exponents.") {
+	// The difference of the exponents does not fit their type.
+	using Float16T = Float<int16_t, int8_t>;
+	const Float16T large(1, 100);
+	const Float16T tiny(1, -100);
+	REQUIRE(large + tiny == large);
+	REQUIRE(tiny + large == large);
+	REQUIRE(-large + -tiny == -large);
+
+	using Float64T = Float<int64_t, int8_t>;
+	REQUIRE(Float64T(1, 100) + Float64T(-1, -100) == Float64T(1, 100));
+	REQUIRE(Float64T(-1, -100) + Float64T(1, 100) == Float64T(1, 100));
+}
@@ -0,0 +1,135 @@
+#include "test_utils.hpp"
+
+#include "fas/block.hpp"
+
+#include <vector>
+
+namespace {
+
+using block_t = BlockFloat<float8_t, 4>;
+using decimal_t = Float<int8_t, int8_t, 10>;
+
+} // namespace
+
+TEST_CASE("Blocks are constexpressions.") {
+	constexpr block_t block = {float8_t(3), float8_t(-5)};
+	static_assert(block[0] == 3);
+	static_assert((block * block)[1] == 25);
+	static_assert((block + block)[1] == -10);
+	static_assert(block_t()[3] == 0);
+}
+
+TEST_CASE("Blocks share a single exponent.") {
+	static_assert(sizeof(BlockFloat<Float<int16_t, int8_t>, 16>) == 34);
+
+	const block_t block = {float8_t(100), float8_t(3.5), float8_t(-1)};
+	REQUIRE(block.exponent() == 0);
+	REQUIRE(block.mantissas()[0] == 100);
+	REQUIRE(block[0] == 100);
+	REQUIRE(block[1] == 3);
+	REQUIRE(block[2] == -1);
+	REQUIRE(block[3] == 0);
+
+	// Values of the same exponent convert exactly.
+	const float8_t values[] = {float8_t(int8_t(-128), int8_t(-3)),
+	                           float8_t(int8_t(65), int8_t(-3)),
+	                           float8_t(int8_t(127), int8_t(-3)),
+	                           float8_t::ZERO()};
+	float8_t stored[4];
+	block_t(values).store(stored);
+	for (int i = 0; i < 4; ++i) {
+		REQUIRE(stored[i] == values[i]);
+	}
+}
+
+TEST_CASE("Setting values of blocks.") {
+	block_t block = {float8_t(1), float8_t(2)};
+	block.set(2, float8_t(0.5));
+	REQUIRE(block[2] == 0.5);
+
+	// A larger value shifts the others to its exponent.
+	block.set(3, float8_t(1000));
+	REQUIRE(block.exponent() == 3);
+	REQUIRE(block[3] == 1000);
+	REQUIRE(block[0] == 0);
+	REQUIRE(block[1] == 0);
+}
+
+TEST_CASE("Blocks renormalize when they overflow.") {
+	const block_t block = {float8_t(100), float8_t(1), float8_t(-3)};
+	const auto sum = block + block;
+	REQUIRE(sum.exponent() == 1);
+	REQUIRE(sum[0] == 200);
+	REQUIRE(sum[1] == 2);
+	REQUIRE(sum[2] == -6);
+
+	// Otherwise the exponent stays.
+	const auto difference = block - block_t{float8_t(99)};
+	REQUIRE(difference.exponent() == 0);
+	REQUIRE(difference[0] == 1);
+	REQUIRE(difference[2] == -3);
+
+	const block_t factors = {float8_t(100), float8_t(2), float8_t(-5)};
+	const auto product = block * factors;
+	REQUIRE(product.exponent() == 7);
+	REQUIRE(product[0] == 9984);
+	REQUIRE(product[1] == 0);
+}
+
+TEST_CASE("Blocks regain lost digits by normalizing.") {
+	auto block = block_t{float8_t(100), float8_t(3)} - block_t{float8_t(99)};
+	block.normalize();
+	REQUIRE(block.exponent() == -5);
+	REQUIRE(block[0] == 1);
+	REQUIRE(block[1] == 3);
+
+	block = block_t();
+	block.normalize();
+	REQUIRE(block.exponent() == float8_t::MIN().exponent());
+
+	// Normalizing down to the lowest exponent.
+	const float8_t tiny(int8_t(64), int8_t(-127));
+	block = block_t{tiny, float8_t(int8_t(65), int8_t(-127))} -
+	        block_t{tiny, tiny};
+	block.normalize();
+	REQUIRE(block.exponent() == float8_t::MIN().exponent());
+	REQUIRE(block.mantissas()[1] == 2);
+}
+
+TEST_CASE("Blocks agree with the operators when the exponents are equal.") {
+	using wide_t = Float<int16_t, int8_t>;
+	std::vector<wide_t> first;
+	std::vector<wide_t> second;
+	for (int i = 0; i < 16; ++i) {
+		first.push_back(wide_t(int16_t(0x4000 + 977 * i), int8_t(-4)));
+		second.push_back(wide_t(int16_t(-0x4000 - 513 * i), int8_t(-4)));
+	}
+
+	const BlockFloat<wide_t, 16> a(first.data());
+	const BlockFloat<wide_t, 16> b(second.data());
+	const auto sum = a + b;
+	const auto product = a * b;
+	const auto half = a * wide_t(0.5);
+	for (std::size_t i = 0; i < 16; ++i) {
+		REQUIRE(sum[i] == first[i] + second[i]);
+		REQUIRE(half[i] == first[i] * 0.5);
+		// The products keep the digits of the largest one's exponent.
+		const auto exact = static_cast<double>(first[i] * second[i]);
+		REQUIRE(static_cast<double>(product[i]) >= exact);
+		REQUIRE(static_cast<double>(product[i]) <= exact * 0.999);
+	}
+}
+
+TEST_CASE("Blocks of other bases and mantissas.") {
+	const BlockFloat<decimal_t, 2> decimal = {decimal_t(95), decimal_t(7)};
+	const auto sum = decimal + decimal;
+	REQUIRE(sum.exponent() == 1);
+	REQUIRE(sum[0] == 190);
+	REQUIRE(sum[1] == 10);
+
+	using huge_t = Float<int64_t, int16_t>;
+	const BlockFloat<huge_t, 2> huge = {huge_t(1e18), huge_t(-3)};
+	const auto square = huge * huge;
+	REQUIRE(square[0] == huge_t(1e18) * huge_t(1e18));
+	REQUIRE(square[1] == 0);
+}
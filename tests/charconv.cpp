@@ -0,0 +1,257 @@
+#include "test_utils.hpp"
+
+#include "fas/charconv.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace {
+
+//! @returns `value` formatted by `to_chars`.
+template <typename Tfloat> std::string format(const Tfloat &value) {
+	std::array<char, max_chars<Tfloat>> buffer;
+	const auto result =
+	    to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+	REQUIRE(result.ec == std::errc());
+	return std::string(buffer.data(), result.ptr);
+}
+
+//! @returns `text` parsed by `from_chars`, which needs to consume it all.
+template <typename Tfloat> Tfloat parse(const std::string &text) {
+	auto result = Tfloat::NOT_A_NUMBER();
+	const auto end = text.data() + text.size();
+	const auto parsed = from_chars(text.data(), end, result);
+	REQUIRE(parsed.ec == std::errc());
+	REQUIRE(parsed.ptr == end);
+	return result;
+}
+
+//! Requires that `value` is parsed back from its formatted value.
+template <typename Tfloat> void require_round_trip(const Tfloat &value) {
+	const auto parsed = parse<Tfloat>(format(value));
+	REQUIRE(parsed.mantissa() == value.mantissa());
+	REQUIRE(parsed.exponent() == value.exponent());
+}
+
+} // namespace
+
+TEST_CASE("to_chars formats the special values.") {
+	REQUIRE(format(float8_t::ZERO()) == "0");
+	REQUIRE(format(float8_t::INF()) == "inf");
+	REQUIRE(format(float8_t::NEGATIVE_INF()) == "-inf");
+	REQUIRE(format(float8_t::NOT_A_NUMBER()) == "nan");
+}
+
+TEST_CASE("to_chars formats the shortest representation.") {
+	REQUIRE(format(float8_t(1)) == "1");
+	REQUIRE(format(float8_t(-3)) == "-3");
+	REQUIRE(format(float8_t(100)) == "100");
+	REQUIRE(format(float8_t(1) / 2) == "0.5");
+	// Any number of [128, 129) * 2 ^ -13 truncates to -128 * 2 ^ -13.
+	REQUIRE(format(float8_t(-1) / 64) == "-0.0157");
+
+	// 102 * 2 ^ -10 is the largest value not above 0.1.
+	REQUIRE(format(float8_t(102, -10)) == "0.1");
+	REQUIRE(format(float8_t::MAX()) == "2.17e+40");
+
+	using decimal_t = Float<int32_t, int16_t, 10>;
+	REQUIRE(format(decimal_t(1, -7)) == "1e-07");
+	REQUIRE(format(decimal_t(15, -1)) == "1.5");
+	REQUIRE(format(decimal_t(1, 20)) == "1e+20");
+	REQUIRE(format(decimal_t(123, 100)) == "1.23e+102");
+}
+
+TEST_CASE("to_chars reports a too small buffer.") {
+	std::array<char, 4> buffer;
+	const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(),
+	                             float8_t(-1) / 64);
+	REQUIRE(result.ec == std::errc::value_too_large);
+	REQUIRE(result.ptr == buffer.data() + buffer.size());
+}
+
+TEST_CASE("from_chars parses exactly, truncating towards zero.") {
+	const auto tenth = parse<float8_t>("0.1");
+	REQUIRE(tenth.mantissa() == 102);
+	REQUIRE(tenth.exponent() == -10);
+
+	const auto negative_tenth = parse<float8_t>("-0.1");
+	REQUIRE(negative_tenth.mantissa() == -102);
+	REQUIRE(negative_tenth.exponent() == -10);
+
+	// Exactly representable values are not truncated.
+	REQUIRE(parse<float8_t>("0.099609375") == tenth);
+	REQUIRE(parse<float8_t>("0.0996093749999999999999999") == float8_t(101, -10));
+
+	REQUIRE(parse<float8_t>("1") == float8_t(1));
+	REQUIRE(parse<float8_t>("-128") == float8_t(-128));
+	REQUIRE(parse<float8_t>("25e-1") == float8_t(5) / 2);
+	REQUIRE(parse<float8_t>("0.0025E3") == float8_t(5) / 2);
+	REQUIRE(parse<float8_t>("-0") == float8_t::ZERO());
+	REQUIRE(parse<float8_t>("000.000") == float8_t::ZERO());
+
+	using decimal_t = Float<int32_t, int16_t, 10>;
+	REQUIRE(parse<decimal_t>("0.1") == decimal_t(1, -1));
+	REQUIRE(parse<decimal_t>("123456789012") == decimal_t(1234567890, 2));
+}
+
+TEST_CASE("from_chars parses long numbers exactly.") {
+	// Digits beyond native integers.
+	REQUIRE(parse<float8_t>(
+	            "0.09960937500000000000000000000000000000000000000001") ==
+	        float8_t(102, -10));
+
+	using wide_t = Float<int32_t, int16_t>;
+	const auto digits = "1" + std::string(899, '0');
+	REQUIRE(parse<wide_t>(digits) == parse<wide_t>("1e899"));
+	REQUIRE(parse<wide_t>(digits + ".000") == parse<wide_t>("1e899"));
+	REQUIRE(parse<wide_t>("0.000" + digits + "e4") == wide_t(1));
+}
+
+TEST_CASE("from_chars truncates to the largest mantissa in gaps.") {
+	// With a base of 10, no mantissa of int8_t represents 128 to 129.
+	using decimal8_t = Float<int8_t, int8_t, 10>;
+	const auto parsed = parse<decimal8_t>("128");
+	REQUIRE(parsed.mantissa() == 127);
+	REQUIRE(parsed.exponent() == 0);
+}
+
+TEST_CASE("from_chars parses the special values.") {
+	REQUIRE(parse<float8_t>("inf") == float8_t::INF());
+	REQUIRE(parse<float8_t>("-Infinity") == float8_t::NEGATIVE_INF());
+	REQUIRE(parse<float8_t>("NaN").classify() == classification::not_a_number);
+	REQUIRE(parse<float8_t>("nan(1_x)").classify() ==
+	        classification::not_a_number);
+}
+
+TEST_CASE("from_chars reports errors.") {
+	auto value = float8_t(3);
+
+	for (const std::string text : {"", "-", ".", "e5", "+1", " 1", "x"}) {
+		const auto result =
+		    from_chars(text.data(), text.data() + text.size(), value);
+		REQUIRE(result.ec == std::errc::invalid_argument);
+		REQUIRE(result.ptr == text.data());
+	}
+
+	for (const std::string text :
+	     {"1e41", "-1e42", "1e-40", "-1e-999999999999"}) {
+		const auto result =
+		    from_chars(text.data(), text.data() + text.size(), value);
+		REQUIRE(result.ec == std::errc::result_out_of_range);
+		REQUIRE(result.ptr == text.data() + text.size());
+	}
+
+	auto unsigned_value = ufloat8_t(3);
+	const std::string negative = "-1";
+	REQUIRE(from_chars(negative.data(), negative.data() + negative.size(),
+	                   unsigned_value)
+	            .ec == std::errc::result_out_of_range);
+
+	REQUIRE(value == float8_t(3));
+	REQUIRE(unsigned_value == ufloat8_t(3));
+}
+
+TEST_CASE("from_chars stops at the first character not being part of it.") {
+	auto value = float8_t::ZERO();
+	const std::string text = "1.5e+x";
+	const auto result =
+	    from_chars(text.data(), text.data() + text.size(), value);
+	REQUIRE(result.ec == std::errc());
+	REQUIRE(result.ptr == text.data() + 3);
+	REQUIRE(value == float8_t(3) / 2);
+}
+
+TEST_CASE("Every normalized float8_t and ufloat8_t survives a round trip.") {
+	for (int exponent = -128; exponent <= 127; ++exponent) {
+		for (int mantissa = -128; mantissa <= 127; ++mantissa) {
+			const auto value = float8_t(int8_t(mantissa), int8_t(exponent));
+			if (value.mantissa() == mantissa && value.exponent() == exponent &&
+			    mantissa != 0) {
+				require_round_trip(value);
+			}
+
+			const auto unsigned_value =
+			    ufloat8_t(uint8_t(mantissa + 128), int8_t(exponent));
+			if (unsigned_value.mantissa() == mantissa + 128 &&
+			    unsigned_value.exponent() == exponent && mantissa != -128) {
+				require_round_trip(unsigned_value);
+			}
+		}
+	}
+}
+
+TEST_CASE("Random values of several instantiations survive a round trip.") {
+	std::mt19937_64 generator(11);
+	std::uniform_int_distribution<int64_t> mantissa;
+	std::uniform_int_distribution<int> exponent(-1000, 1000);
+
+	for (int i = 0; i < 2000; ++i) {
+		const auto m = mantissa(generator);
+		const auto e = exponent(generator);
+		require_round_trip(Float<int16_t, int8_t>(int16_t(m), int8_t(e)));
+		require_round_trip(Float<int32_t, int16_t>(int32_t(m), int16_t(e)));
+		require_round_trip(Float<int64_t, int16_t>(m, int16_t(e)));
+		require_round_trip(Float<int32_t, int16_t, 10>(int32_t(m), int16_t(e)));
+		require_round_trip(
+		    Float<int32_t, int16_t, 7>(int32_t(m), int16_t(e / 4)));
+		require_round_trip(Float<int32_t, int16_t, 16>(int32_t(m), int16_t(e)));
+#if defined(__SIZEOF_INT128__)
+		require_round_trip(Float<__int128, int16_t>(__int128(m) << 64 | m,
+		                                            int16_t(e * 16)));
+#endif
+	}
+}
+
+TEST_CASE("Doubles converted to other bases survive a round trip.") {
+	std::mt19937_64 generator(7);
+	std::uniform_real_distribution<double> fraction(-1, 1);
+	std::uniform_int_distribution<int> exponent(-50, 50);
+
+	for (int i = 0; i < 20000; ++i) {
+		const auto value = std::ldexp(fraction(generator), exponent(generator));
+		require_round_trip(Float<int16_t, int16_t, 7>(value));
+		require_round_trip(Float<int16_t, int16_t, 10>(value));
+		require_round_trip(Float<int32_t, int16_t, 10>(value));
+	}
+}
+
+TEST_CASE("operator<< prints the shortest representation.") {
+	std::ostringstream stream;
+	stream << float8_t(1) / 2 << " " << float8_t::INF() << " "
+	       << Float<int32_t, int16_t, 10>(15, -1);
+	REQUIRE(stream.str() == "0.5 inf 1.5");
+}
+
+TEST_CASE("operator<< neither alters nor uses the stream's flags.") {
+	std::ostringstream stream;
+	const auto flags = stream.flags();
+	stream << std::hex << std::uppercase;
+	const auto altered = stream.flags();
+
+	stream << float8_t(-100) << " " << 26;
+	REQUIRE(stream.str() == "-100 1A");
+	REQUIRE(stream.flags() == altered);
+	REQUIRE(flags != altered);
+}
+
+TEST_CASE("operator<< respects the stream's width.") {
+	std::ostringstream stream;
+	stream.width(6);
+	stream.fill('_');
+	stream << float8_t(3);
+	REQUIRE(stream.str() == "_____3");
+}
+
+TEST_CASE("operator<< prints values of extreme exponents exactly.") {
+	using float128_t = Float<__int128, int64_t>;
+	using float32_t = Float<int32_t, int64_t>;
+	std::ostringstream stream;
+	stream << float128_t::LOWEST() << " " << float32_t::MIN();
+	REQUIRE(stream.str() ==
+	        "-170141183460469231731687303715884105728*2^9223372036854775807 "
+	        "1*2^-9223372036854775808");
+}
@@ -0,0 +1,58 @@
+#include "test_utils.hpp"
+
+TEST_CASE("Expects classify to return a constexpression.") {
+	constexpr auto result = float8_t(1).classify();
+}
+
+TEST_CASE("Classifies the special values.") {
+	REQUIRE(float8_t::ZERO().classify() == classification::zero);
+	REQUIRE(float8_t::INF().classify() == classification::inf);
+	REQUIRE(float8_t::NEGATIVE_INF().classify() == classification::negative_inf);
+	REQUIRE(float8_t::NOT_A_NUMBER().classify() ==
+	        classification::not_a_number);
+
+	REQUIRE(ufloat8_t::ZERO().classify() == classification::zero);
+	REQUIRE(ufloat8_t::INF().classify() == classification::inf);
+}
+
+TEST_CASE("Classifies finite values.") {
+	REQUIRE(float8_t(1).classify() == classification::finite);
+	REQUIRE(float8_t(-1).classify() == classification::finite);
+	REQUIRE(float8_t::MAX().classify() == classification::finite);
+	REQUIRE(float8_t::MIN().classify() == classification::finite);
+	REQUIRE(float8_t::LOWEST().classify() == classification::finite);
+}
+
+TEST_CASE("NOT_A_NUMBER propagates through all operators.") {
+	const auto nan = float8_t::NOT_A_NUMBER();
+
+	REQUIRE(nan + 1 == nan);
+	REQUIRE(float8_t(1) + nan == nan);
+	REQUIRE(float8_t::INF() + nan == nan);
+	REQUIRE(nan - 1 == nan);
+	REQUIRE(float8_t(1) - nan == nan);
+	REQUIRE(nan * 2 == nan);
+	REQUIRE(float8_t(2) * nan == nan);
+	REQUIRE(nan / 2 == nan);
+	REQUIRE(float8_t(2) / nan == nan);
+	REQUIRE(-nan == nan);
+}
+
+TEST_CASE("Multiplying special values.") {
+	REQUIRE(float8_t::INF() * 2 == float8_t::INF());
+	REQUIRE(float8_t::INF() * -2 == float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t(-2) * float8_t::NEGATIVE_INF() == float8_t::INF());
+	REQUIRE(float8_t::INF() * float8_t::NEGATIVE_INF() ==
+	        float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t::INF() * float8_t::ZERO() == float8_t::NOT_A_NUMBER());
+	REQUIRE(float8_t::ZERO() * -2 == float8_t::ZERO());
+}
+
+TEST_CASE("Dividing special values.") {
+	REQUIRE(float8_t::ZERO() / float8_t::ZERO() == float8_t::NOT_A_NUMBER());
+	REQUIRE(float8_t::INF() / float8_t::INF() == float8_t::NOT_A_NUMBER());
+	REQUIRE(float8_t::INF() / -2 == float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t::NEGATIVE_INF() / float8_t::ZERO() ==
+	        float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t(-2) / float8_t::NEGATIVE_INF() == float8_t::ZERO());
+}
@@ -44,8 +44,8 @@ TEST_CASE("Compare values with different exponent.") {
 	REQUIRE(float8_t::MAX() > float8_t::LOWEST());
 	REQUIRE(float8_t::MAX() >= float8_t::LOWEST());
 
-	REQUIRE(float8_t::MIN() < float8_t::LOWEST());
-	REQUIRE(float8_t::MIN() <= float8_t::LOWEST());
+	REQUIRE(float8_t::MIN() > float8_t::LOWEST());
+	REQUIRE(float8_t::MIN() >= float8_t::LOWEST());
 
 	REQUIRE(float8_t::MIN() < float8_t::MAX());
 	REQUIRE(float8_t::MIN() > float8_t::ZERO());
@@ -60,3 +60,117 @@ TEST_CASE("Compare values with different exponent.") {
 	REQUIRE(float8_t::ZERO() < float8_t::MIN());
 	REQUIRE(float8_t::ZERO() > float8_t::LOWEST());
 }
+
+TEST_CASE("Compare values with integers.") {
+	REQUIRE(float8_t(3) == 3);
+	REQUIRE(float8_t(3) != 4);
+	REQUIRE(float8_t(2.5) < 3);
+	REQUIRE(float8_t(-2.5) > -3);
+	REQUIRE(float8_t(3) <= 3u);
+	REQUIRE(float8_t(3) >= static_cast<std::int8_t>(3));
+	REQUIRE(!(float8_t::NOT_A_NUMBER() == 0));
+
+	// Integers do not take the way of `double`, which would round them.
+	using Float64T = Float<int64_t, int16_t>;
+	constexpr auto largest = std::numeric_limits<std::int64_t>::max();
+	REQUIRE(Float64T(largest, 0) == largest);
+	REQUIRE(Float64T(largest - 1, 0) < largest);
+	REQUIRE(Float64T(largest - 1, 0) + 1 == largest);
+}
+
+TEST_CASE("Compare values with integers, which they can not represent.") {
+	// `257` truncates to `float8_t(256)`, but is compared exactly.
+	REQUIRE(float8_t(256) != 257);
+	REQUIRE(float8_t(256) < 257);
+	REQUIRE(float8_t(256) <= 257);
+	REQUIRE(!(float8_t(256) >= 257));
+	REQUIRE(float8_t(256) > 255);
+	REQUIRE(float8_t(-256) > -257);
+	REQUIRE(float8_t(-256) < -255);
+	REQUIRE(float8_t(256) == 256u);
+
+	// Integers beyond the exponent's range and fractions.
+	REQUIRE(float8_t::MAX() > std::numeric_limits<std::uint64_t>::max());
+	REQUIRE(float8_t::LOWEST() < std::numeric_limits<std::int64_t>::lowest());
+	REQUIRE(float8_t::MIN() < 1);
+	REQUIRE(float8_t::MIN() > 0);
+	REQUIRE(float8_t(3, -1) > 1);
+	REQUIRE(float8_t(3, -1) < 2);
+	REQUIRE(float8_t(-3, -1) < -1);
+	REQUIRE(float8_t(-3, -1) > -2);
+
+	// Not a number is unordered, the infinities beyond any integer.
+	REQUIRE(!(float8_t::NOT_A_NUMBER() <= 0));
+	REQUIRE(!(float8_t::NOT_A_NUMBER() >= 0));
+	REQUIRE(float8_t::NOT_A_NUMBER() != 0);
+	REQUIRE(float8_t::INF() > std::numeric_limits<std::int64_t>::max());
+	REQUIRE(float8_t::NEGATIVE_INF() <
+	        std::numeric_limits<std::int64_t>::lowest());
+	REQUIRE(float8_t::ZERO() < 1);
+	REQUIRE(float8_t::ZERO() > -1);
+
+	using decimal_t = Float<int8_t, int8_t, 10>;
+	REQUIRE(decimal_t(1200) == 1200);
+	REQUIRE(decimal_t(1200) < 1201);
+	REQUIRE(decimal_t(5, -1) < 1);
+	REQUIRE(decimal_t(15, -1) > 1);
+}
+
+TEST_CASE("Compare negative values.") {
+	REQUIRE(float8_t(-2) < float8_t(-1));
+	REQUIRE(float8_t(-1) > float8_t(-2));
+	REQUIRE(float8_t(-3) < float8_t(-2));
+	REQUIRE(float8_t(-100) <= float8_t(-0.5));
+	REQUIRE(!(float8_t(-0.5) <= float8_t(-100)));
+	REQUIRE(float8_t::LOWEST() < float8_t(-1));
+	REQUIRE(float8_t(-1) >= float8_t::LOWEST());
+}
+
+TEST_CASE("Compare special values.") {
+	REQUIRE(float8_t::INF() > float8_t(100));
+	REQUIRE(float8_t::INF() > float8_t::MAX());
+	REQUIRE(float8_t::MAX() < float8_t::INF());
+	REQUIRE(float8_t::NEGATIVE_INF() < float8_t::LOWEST());
+	REQUIRE(float8_t::NEGATIVE_INF() < float8_t::INF());
+	REQUIRE(float8_t::NEGATIVE_INF() <= float8_t::NEGATIVE_INF());
+	REQUIRE(!(float8_t::INF() < float8_t::INF()));
+	REQUIRE(float8_t::INF() >= float8_t::INF());
+
+	// Not a number is unordered.
+	const auto nan = float8_t::NOT_A_NUMBER();
+	for (const auto value : {float8_t(1), float8_t::ZERO(), float8_t::INF(),
+	                         float8_t::NEGATIVE_INF()}) {
+		REQUIRE(!(nan < value));
+		REQUIRE(!(nan > value));
+		REQUIRE(!(nan <= value));
+		REQUIRE(!(nan >= value));
+		REQUIRE(!(nan == value));
+		REQUIRE(!(value < nan));
+		REQUIRE(!(value >= nan));
+		REQUIRE(value != nan);
+	}
+
+	// But it equals itself, so `<=` and `>=` are `<` and `>` or `==`.
+	REQUIRE(nan == nan);
+	REQUIRE(!(nan != nan));
+	REQUIRE(!(nan < nan));
+	REQUIRE(!(nan > nan));
+	REQUIRE(nan <= nan);
+	REQUIRE(nan >= nan);
+}
+
+TEST_CASE("Comparisons agree with double.") {
+	using Float16T = Float<int16_t, int8_t>;
+	using Float64T = Float<int64_t, int16_t>;
+	using Float128T = Float<__int128, int16_t>;
+	const double values[] = {-1e6, -3, -2.5, -1, -0.75, 0, 0.001, 1, 2, 1e9};
+	for (const auto first : values) {
+		for (const auto second : values) {
+			REQUIRE((Float16T(first) < Float16T(second)) == (first < second));
+			REQUIRE((Float64T(first) < Float64T(second)) == (first < second));
+			REQUIRE((Float64T(first) > Float64T(second)) == (first > second));
+			REQUIRE((Float128T(first) < Float128T(second)) == (first < second));
+			REQUIRE((Float128T(first) >= Float128T(second)) == (first >= second));
+		}
+	}
+}
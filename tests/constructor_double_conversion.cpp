@@ -1,4 +1,10 @@
 #include "test_utils.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
 TEST_CASE("Expect templated value constructor capable creating "
           "constexpressions") {
 	constexpr auto double_ctr = float8_t(0.0);
@@ -62,3 +68,106 @@ TEST_CASE("Expect to create the correct values on using the double "
 	REQUIRE((int)float8_t(-1.5).mantissa() == -0x60);
 	REQUIRE((int)float8_t(-1.5).exponent() == -6);
 }
+
+TEST_CASE("Expect the double conversion constructor to truncate exactly.") {
+	// Digits a double holds beyond the mantissa are truncated towards zero.
+	REQUIRE((int)float8_t(127.5).mantissa() == 127);
+	REQUIRE((int)float8_t(127.5).exponent() == 0);
+	REQUIRE((int)float8_t(-127.9).mantissa() == -127);
+	REQUIRE((int)float8_t(0.1).mantissa() == 102);
+	REQUIRE((int)float8_t(0.1).exponent() == -10);
+
+	constexpr auto tenth = Float<int16_t, int16_t, 10>(0.1);
+	REQUIRE(tenth.mantissa() == 10000);
+	REQUIRE(tenth.exponent() == -5);
+
+	// Every double fits into a mantissa of 64 bits.
+	using Float64T = Float<int64_t, int16_t>;
+	const auto value = Float64T(0x1.fffffffffffffp-1022);
+	REQUIRE(value.mantissa() == int64_t(0x1fffffffffffff) << 10);
+	REQUIRE(value.exponent() == -1022 - 52 - 10);
+
+	// The smallest subnormal value.
+	const auto smallest = Float64T(-0x1p-1074);
+	REQUIRE(smallest.mantissa() == std::numeric_limits<int64_t>::min());
+	REQUIRE(smallest.exponent() == -1074 - 63);
+
+	REQUIRE(Float64T(0x1p1023).mantissa() == int64_t(1) << 62);
+	REQUIRE(Float64T(0x1p1023).exponent() == 1023 - 62);
+}
+
+TEST_CASE("Expect the double conversion constructor to saturate.") {
+	REQUIRE(float8_t(1e300) == float8_t::INF());
+	REQUIRE(float8_t(-1e300) == float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t(1e-300) == float8_t::ZERO());
+	REQUIRE(float8_t(std::numeric_limits<double>::infinity()) ==
+	        float8_t::INF());
+	REQUIRE(float8_t(-std::numeric_limits<double>::infinity()) ==
+	        float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t(std::numeric_limits<double>::quiet_NaN()).classify() ==
+	        classification::not_a_number);
+
+	// Negative values do not fit into an unsigned mantissa.
+	REQUIRE(ufloat8_t(-1.0) == ufloat8_t::NEGATIVE_INF());
+	REQUIRE(ufloat8_t(-0.0) == ufloat8_t::ZERO());
+}
+
+TEST_CASE("Expect the double conversion constructor to support other bases.") {
+	using Base16FloatT = Float<int32_t, int16_t, 16>;
+	REQUIRE(Base16FloatT(1.0).mantissa() == 0x10000000);
+	REQUIRE(Base16FloatT(1.0).exponent() == -7);
+	REQUIRE(Base16FloatT(0.5).mantissa() == 0x8000000);
+	REQUIRE(Base16FloatT(0.5).exponent() == -7);
+	REQUIRE(Base16FloatT(0x1p-1074).mantissa() == 0x40000000);
+	REQUIRE(Base16FloatT(0x1p-1074).exponent() == -276);
+
+	using Base10FloatT = Float<int32_t, int16_t, 10>;
+	REQUIRE(Base10FloatT(1.5).mantissa() == 1'500'000'000);
+	REQUIRE(Base10FloatT(1.5).exponent() == -9);
+	REQUIRE(Base10FloatT(-2.5).mantissa() == -250'000'000);
+	REQUIRE(Base10FloatT(-2.5).exponent() == -8);
+	REQUIRE(Base10FloatT(1e20).mantissa() == 1'000'000'000);
+	REQUIRE(Base10FloatT(1e20).exponent() == 11);
+	REQUIRE(Base10FloatT(std::numeric_limits<double>::max()).exponent() ==
+	        299);
+
+	using Base10Float8T = Float<int8_t, int8_t, 10>;
+	REQUIRE(Base10Float8T(1e200) == Base10Float8T::INF());
+	REQUIRE(Base10Float8T(1e-200) == Base10Float8T::ZERO());
+	REQUIRE((int)Base10Float8T(129.0).mantissa() == 127);
+	REQUIRE((int)Base10Float8T(129.0).exponent() == 0);
+	REQUIRE(Base10Float8T(129.0) == Base10Float8T(int16_t(129), 0));
+
+	// Truncated magnitudes get normalized, so equal values compare equal.
+	using Base10Float32T = Float<int32_t, int8_t, 10>;
+	REQUIRE(Base10Float32T(214748364.0).mantissa() == 2'147'483'640);
+	REQUIRE(Base10Float32T(214748364.0).exponent() == -1);
+	REQUIRE(Base10Float32T(214748364.0) == Base10Float32T(214748364, 0));
+	REQUIRE(Base10Float32T(-214748364.0) == Base10Float32T(-214748364, 0));
+
+	// 214748364.9 truncates to the limit one digit lower.
+	REQUIRE(Base10Float32T(214748364.9).mantissa() == 2'147'483'647);
+	REQUIRE(Base10Float32T(214748364.9).exponent() == -1);
+	REQUIRE(Base10Float32T(214748364.9) > Base10Float32T(214748364, 0));
+	REQUIRE(Base10Float32T(21474836499.0) ==
+	        Base10Float32T(int64_t(21'474'836'499), 0));
+
+	using Base7FloatT = Float<int16_t, int16_t, 7>;
+	REQUIRE(Base7FloatT(0.000812) == Base7FloatT(int16_t(4681), -8));
+	REQUIRE(Base7FloatT(0.000812).mantissa() == 32767);
+}
+
+TEST_CASE("Expect doubles to survive a round trip.") {
+	using Float64T = Float<int64_t, int16_t>;
+	std::mt19937_64 generator(13);
+	std::uniform_int_distribution<uint64_t> bits;
+
+	for (int i = 0; i < 10000; ++i) {
+		const auto pattern = bits(generator);
+		double value;
+		std::memcpy(&value, &pattern, sizeof(value));
+		if (std::isfinite(value)) {
+			REQUIRE(static_cast<double>(Float64T(value)) == value);
+		}
+	}
+}
@@ -591,3 +591,74 @@ TEST_CASE("Tests whether the type creates correct values for base 3.") {
 	REQUIRE(Base3FloatT(1).mantissa() == 0x4c'e3);
 	REQUIRE(Base3FloatT(1).exponent() == -9);
 }
+
+TEST_CASE("Normalizes wide mantissas in one step for a base of two.") {
+	using Float64T = Float<int64_t, int16_t>;
+
+	REQUIRE(Float64T(int64_t(1), 0).mantissa() == 0x4000'0000'0000'0000);
+	REQUIRE(Float64T(int64_t(1), 0).exponent() == -62);
+
+	REQUIRE(Float64T(int64_t(-1), 0).mantissa() ==
+	        std::numeric_limits<int64_t>::lowest());
+	REQUIRE(Float64T(int64_t(-1), 0).exponent() == -63);
+
+	REQUIRE(Float<int16_t, int8_t>(0x12345678, 0).mantissa() == 0x48d1);
+	REQUIRE(Float<int16_t, int8_t>(0x12345678, 0).exponent() == 14);
+
+	// Precision beyond the mantissa gets truncated.
+	REQUIRE(Float<int16_t, int8_t>(-0x12345678, 0).mantissa() == -0x48d1);
+	REQUIRE(Float<int16_t, int8_t>(-0x12345678, 0).exponent() == 14);
+}
+
+TEST_CASE("Normalizes mantissas for bases being a power of two.") {
+	using Base16FloatT = Float<int16_t, int8_t, 16>;
+
+	REQUIRE(Base16FloatT(1, 0).mantissa() == 0x1000);
+	REQUIRE(Base16FloatT(1, 0).exponent() == -3);
+
+	REQUIRE(Base16FloatT(0x12345, 0).mantissa() == 0x1234);
+	REQUIRE(Base16FloatT(0x12345, 0).exponent() == 1);
+
+	REQUIRE(Base16FloatT(-0x8000, 0).mantissa() == -0x8000);
+	REQUIRE(Base16FloatT(-0x8000, 0).exponent() == 0);
+}
+
+TEST_CASE("Normalizes mantissas for bases not being a power of two.") {
+	using Base10FloatT = Float<int32_t, int8_t, 10>;
+
+	REQUIRE(Base10FloatT(1, 0).mantissa() == 1'000'000'000);
+	REQUIRE(Base10FloatT(1, 0).exponent() == -9);
+
+	REQUIRE(Base10FloatT(-123, 2).mantissa() == -1'230'000'000);
+	REQUIRE(Base10FloatT(-123, 2).exponent() == -5);
+
+	REQUIRE(Base10FloatT(int64_t(123'456'789'012), 0).mantissa() ==
+	        1'234'567'890);
+	REQUIRE(Base10FloatT(int64_t(123'456'789'012), 0).exponent() == 2);
+
+	// Exceeding the exponent on shrinking.
+	REQUIRE(Base10FloatT(int64_t(123'456'789'012), 0x7f) ==
+	        Base10FloatT::INF());
+	REQUIRE(Base10FloatT(int64_t(-123'456'789'012), 0x7f) ==
+	        Base10FloatT::NEGATIVE_INF());
+
+	// Exceeding the exponent on growing.
+	REQUIRE(Base10FloatT(1, -0x7f) == Base10FloatT::ZERO());
+}
+
+TEST_CASE("Truncates magnitudes, which shrinking leaves a digit short.") {
+	// 129 shrinks to 64, though -128 is closer to -129.
+	REQUIRE(float8_t(int16_t(-129), 0) == float8_t(int8_t(-128), int8_t(0)));
+	REQUIRE(float8_t(int16_t(-131), 0) == float8_t(int8_t(-65), int8_t(1)));
+
+	// 21474836499 shrinks to 214748364.
+	using Base10FloatT = Float<int32_t, int8_t, 10>;
+	REQUIRE(Base10FloatT(int64_t(21'474'836'499), 0).mantissa() ==
+	        2'147'483'647);
+	REQUIRE(Base10FloatT(int64_t(21'474'836'499), 0).exponent() == 1);
+}
+
+TEST_CASE("Normalizing integers is a constexpression.") {
+	constexpr auto base2 = Float<int64_t, int16_t>(int64_t(3), 0);
+	constexpr auto base7 = Float<int32_t, int8_t, 7>(int64_t(-3), 0);
+}
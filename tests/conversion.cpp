@@ -1,5 +1,8 @@
 #include "test_utils.hpp"
 
+#include <cmath>
+#include <limits>
+
 TEST_CASE("Casting should return a constexpr.") {
 	constexpr auto result = static_cast<int8_t>(float8_t::ZERO());
 }
@@ -37,4 +40,85 @@ TEST_CASE("Casting an value statically.") {
 	// Fractions to int
 	REQUIRE(static_cast<int>(float8_t(1, -1)) == 0);
 	REQUIRE(static_cast<int>(float8_t(3, -1)) == 1);
+
+	// The smallest exponent can not be negated in its type.
+	REQUIRE(static_cast<int>(float8_t::MIN()) == 0);
+	REQUIRE(static_cast<int>(Float<int16_t, int8_t>::MIN()) == 0);
+	REQUIRE(static_cast<int>(-Float<int16_t, int8_t>::MIN()) == 0);
+}
+
+TEST_CASE("Casting to floating point types is a constexpression.") {
+	constexpr auto narrow = static_cast<double>(float8_t(1, -1));
+	constexpr auto wide = static_cast<double>(Float<int32_t, int16_t>(3, -1));
+}
+
+TEST_CASE("Casting values with wide exponents.") {
+	using Float32T = Float<int32_t, int16_t>;
+
+	REQUIRE(static_cast<double>(Float32T(3, -1)) == 1.5);
+	REQUIRE(static_cast<double>(Float32T(-3, 10)) == -3072);
+	REQUIRE(static_cast<double>(Float32T(1, -1074)) == 0x1p-1074);
+	REQUIRE(static_cast<double>(Float32T(1, 1023)) == 0x1p1023);
+	REQUIRE(static_cast<double>(Float32T(1, 1100)) ==
+	        std::numeric_limits<double>::infinity());
+	REQUIRE(static_cast<double>(Float32T(1, -1100)) == 0);
+
+	REQUIRE(static_cast<float>(Float32T(1, -149)) == 0x1p-149f);
+	REQUIRE(static_cast<int64_t>(Float32T(int64_t(1) << 40, 0)) ==
+	        int64_t(1) << 40);
+}
+
+TEST_CASE("Casting values to the base of 10.") {
+	using Base10FloatT = Float<int32_t, int8_t, 10>;
+
+	REQUIRE(static_cast<double>(Base10FloatT(25, -1)) == 2.5);
+	REQUIRE(static_cast<double>(Base10FloatT(-123, 0)) == -123);
+	REQUIRE(static_cast<int>(Base10FloatT(25, -1)) == 2);
+	REQUIRE(static_cast<int>(Base10FloatT(-123, 3)) == -123'000);
+}
+
+TEST_CASE("Casting to floating point types rounds to the nearest value.") {
+	using Float64T = Float<int64_t, int16_t>;
+
+	// Ties round to even.
+	REQUIRE(static_cast<double>(Float64T((int64_t(1) << 53) + 1, 0)) ==
+	        0x1p53);
+	REQUIRE(static_cast<double>(Float64T((int64_t(1) << 53) + 3, 0)) ==
+	        0x1p53 + 4);
+	REQUIRE(static_cast<double>(Float64T(-((int64_t(1) << 62) - 1), 0)) ==
+	        -0x1p62);
+	REQUIRE(static_cast<float>(Float64T((int64_t(1) << 24) + 1, 0)) == 0x1p24f);
+
+	// Subnormal values keep fewer digits.
+	using Float32T = Float<int32_t, int16_t>;
+	REQUIRE(static_cast<double>(Float32T(3, -1076)) == 0x1p-1074);
+	REQUIRE(static_cast<double>(Float32T(1, -1075)) == 0);
+	REQUIRE(static_cast<double>(Float32T(3, -1075)) == 0x1p-1073);
+	REQUIRE(static_cast<double>(Float32T(-1, -1074)) == -0x1p-1074);
+	REQUIRE(static_cast<double>(Float32T(0x7fffffff, -1074 - 31)) ==
+	        0x1p-1074);
+	REQUIRE(static_cast<float>(Float32T(0x7fffffff, -149 - 31)) == 0x1p-149f);
+
+	// Rounding up may overflow.
+	REQUIRE(static_cast<float>(Float32T(0x7fffffff, 97)) ==
+	        std::numeric_limits<float>::infinity());
+	REQUIRE(static_cast<float>(Float32T(0x7fffff80 - 1, 97)) ==
+	        std::numeric_limits<float>::max());
+
+	using Base16FloatT = Float<int32_t, int16_t, 16>;
+	REQUIRE(static_cast<double>(Base16FloatT(3, -2)) == 3.0 / 256);
+	REQUIRE(static_cast<double>(Base16FloatT(1, 300)) ==
+	        std::numeric_limits<double>::infinity());
+}
+
+TEST_CASE("Casting special values to floating point types.") {
+	REQUIRE(static_cast<double>(float8_t::INF()) ==
+	        std::numeric_limits<double>::infinity());
+	REQUIRE(static_cast<float>(float8_t::NEGATIVE_INF()) ==
+	        -std::numeric_limits<float>::infinity());
+	REQUIRE(std::isnan(static_cast<double>(float8_t::NOT_A_NUMBER())));
+
+	using Base10FloatT = Float<int32_t, int8_t, 10>;
+	REQUIRE(static_cast<double>(Base10FloatT::INF()) ==
+	        std::numeric_limits<double>::infinity());
 }
@@ -65,3 +65,51 @@ TEST_CASE(
 	REQUIRE(actual.mantissa() == -0x41CE);
 	REQUIRE(actual.exponent() == -11);
 }
+
+TEST_CASE("Division truncates the exact quotient once.") {
+	using Base10FloatT = Float<int32_t, int8_t, 10>;
+
+	REQUIRE((Base10FloatT(1) / 3).mantissa() == 333'333'333);
+	REQUIRE((Base10FloatT(1) / 3).exponent() == -9);
+	REQUIRE((Base10FloatT(-2) / 3).mantissa() == -666'666'666);
+	REQUIRE((Base10FloatT(-2) / 3).exponent() == -9);
+
+	using Float64T = Float<int64_t, int16_t>;
+	REQUIRE((Float64T(int64_t(1), 0) / Float64T(int64_t(3), 0)).mantissa() ==
+	        0x5555'5555'5555'5555);
+	REQUIRE((Float64T(int64_t(1), 0) / Float64T(int64_t(3), 0)).exponent() ==
+	        -64);
+	REQUIRE(Float64T(int64_t(-7), 0) / Float64T(int64_t(-1), 0) ==
+	        Float64T(int64_t(7), 0));
+}
+
+TEST_CASE("Division by zero results in infinity.") {
+	REQUIRE(float8_t(3) / float8_t::ZERO() == float8_t::INF());
+	REQUIRE(float8_t(-3) / float8_t::ZERO() == float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t(3) / float8_t::INF() == float8_t::ZERO());
+}
+
+TEST_CASE("Multiplying by the reciprocal.") {
+	constexpr auto third = reciprocal(Float<int16_t, int8_t>(3));
+
+	REQUIRE(third == Float<int16_t, int8_t>(1) / 3);
+	REQUIRE(Float<int16_t, int8_t>(6) * third ==
+	        Float<int16_t, int8_t>(0x7fff, -14));
+	REQUIRE(reciprocal(float8_t(-4)) == -0.25);
+}
+
+TEST_CASE("Dividing by a power of BASE adjusts the exponent.") {
+	using Float16T = Float<int16_t, int8_t>;
+	const Float16T value(12345.678);
+
+	REQUIRE((value / 2).mantissa() == value.mantissa());
+	REQUIRE((value / 2).exponent() == value.exponent() - 1);
+	REQUIRE(value / 1024 == value / Float16T(1024));
+	REQUIRE(value / -8 == value / Float16T(-8));
+	REQUIRE(value / 3 == value / Float16T(3));
+	REQUIRE(value / 0 == Float16T::INF());
+	REQUIRE(Float16T::MIN() / 2 == Float16T::ZERO());
+
+	using Float16Dec = Float<int16_t, int8_t, 10>;
+	REQUIRE((Float16Dec(37) / 10).exponent() == Float16Dec(37).exponent() - 1);
+}
@@ -0,0 +1,54 @@
+#include "test_utils.hpp"
+
+#include "fas/expr.hpp"
+
+TEST_CASE("Expects expressions to return a constexpression.") {
+	constexpr auto result = fma(float8_t(3), float8_t(5), float8_t(7));
+	constexpr float8_t result_expression =
+	    expr(float8_t(3)) * 5 - 2 * expr(float8_t(4)) + float8_t(1);
+}
+
+TEST_CASE("Expressions evaluate chains of operators.") {
+	REQUIRE(fma(float8_t(3), float8_t(5), float8_t(7)) == 22);
+	REQUIRE(fma(float8_t(3), float8_t(-5), float8_t(7)) == -8);
+	REQUIRE((expr(float8_t(3)) * 5 - 2 * expr(float8_t(4)) + 1).value() == 8);
+	REQUIRE((1 + expr(float8_t(2)) * 3).value() == 7);
+	REQUIRE((expr(float8_t(2)) * 3 * 4).value() == 24);
+	REQUIRE((expr(float8_t(2)) - float8_t(2)).value() == 0);
+}
+
+TEST_CASE("Fused multiply-add truncates once.") {
+	const auto first = float8_t(100);
+	const auto summand = float8_t(-9984);
+
+	// The product 10000 gets truncated to 9984 first.
+	REQUIRE(first * first + summand == 0);
+	REQUIRE(fma(first, first, summand) == 16);
+
+	using Float64T = Float<int64_t, int16_t>;
+	const auto three = Float64T(int64_t(3), 0);
+	const auto third = Float64T(int64_t(1), 0) / three;
+	REQUIRE(fma(third, three, Float64T(int64_t(-1), 0)) ==
+	        Float64T(int64_t(-1), -64));
+}
+
+TEST_CASE("Expressions of special values.") {
+	REQUIRE(fma(float8_t::INF(), float8_t::ZERO(), float8_t(1)) ==
+	        float8_t::NOT_A_NUMBER());
+	REQUIRE(fma(float8_t::INF(), float8_t(-2), float8_t(1)) ==
+	        float8_t::NEGATIVE_INF());
+	REQUIRE(fma(float8_t::MAX(), float8_t::MAX(), float8_t::LOWEST()) ==
+	        float8_t::INF());
+	REQUIRE(fma(float8_t::MIN(), float8_t::MIN(), float8_t::ZERO()) ==
+	        float8_t::ZERO());
+	REQUIRE(fma(float8_t::MIN(), float8_t::MIN(), float8_t(1)) == 1);
+}
+
+TEST_CASE("Expressions without a wider mantissa use the operators.") {
+	REQUIRE(fma(ufloat8_t(3), ufloat8_t(5), ufloat8_t(7)) == 22);
+
+#if defined(__SIZEOF_INT128__)
+	using Float128T = Float<__int128, int16_t>;
+	REQUIRE(fma(Float128T(3), Float128T(5), Float128T(7)) == Float128T(22, 0));
+#endif
+}
@@ -0,0 +1,83 @@
+#include "fas/accumulator.hpp"
+#include "fas/block.hpp"
+#include "fas/charconv.hpp"
+#include "fas/float.hpp"
+#include "fas/math.hpp"
+#include "fas/packed.hpp"
+#include "fas/vector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// Built as a program of its own, with the floating point registers disabled
+// if the compiler supports it, so any floating point arithmetic fails to
+// compile.
+#if !defined(FAS_FREESTANDING)
+#error "The tests of the freestanding configuration need FAS_FREESTANDING."
+#endif
+
+using namespace fas;
+using float8_t = Float<int8_t, int8_t>;
+using float32_t = Float<int32_t, int16_t>;
+
+namespace {
+
+//! @returns `value` as written by `to_chars`.
+template <typename Tfloat> std::string text(const Tfloat &value) {
+	char buffer[max_chars<Tfloat>];
+	const auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+	return std::string(buffer, result.ptr);
+}
+
+//! @returns The value parsed by `from_chars`.
+template <typename Tfloat> Tfloat parse(const char *source) {
+	Tfloat result;
+	from_chars(source, source + std::strlen(source), result);
+	return result;
+}
+
+} // namespace
+
+TEST_CASE("Freestanding floats do not convert native floats.") {
+	REQUIRE(!std::is_constructible<float8_t, double>::value);
+	REQUIRE(!std::is_constructible<float32_t, float>::value);
+	REQUIRE(std::is_constructible<float8_t, int>::value);
+}
+
+TEST_CASE("Freestanding arithmetic.") {
+	const float32_t a(3);
+	const float32_t b(-7, -1);
+	REQUIRE(a + b == float32_t(-1, -1));
+	REQUIRE(b - a == float32_t(-13, -1));
+	REQUIRE(a * b == float32_t(-21, -1));
+	REQUIRE(a / float32_t(2) == float32_t(3, -1));
+	REQUIRE(static_cast<int>(a * 5) == 15);
+	REQUIRE(sqrt(float32_t(16)) == 4);
+
+	FloatVector<float32_t> vector = {a, b, a};
+	REQUIRE(vector[1] + vector[2] == float32_t(-1, -1));
+
+	Accumulator<float32_t> sum;
+	sum.add(a);
+	sum.add(b);
+	REQUIRE(sum.result() == float32_t(-1, -1));
+}
+
+TEST_CASE("Freestanding decimal conversion.") {
+	REQUIRE(text(float8_t(3)) == "3");
+	REQUIRE(text(float8_t(-1, -2)) == "-0.25");
+	REQUIRE(text(float32_t(1) / 3) == "0.3333333333");
+	REQUIRE(text(float32_t::MAX()) == "1.519839709e+9873");
+	REQUIRE(text(float32_t::NOT_A_NUMBER()) == "nan");
+
+	REQUIRE(parse<float8_t>("0.25") == float8_t(1, -2));
+	REQUIRE(parse<float32_t>("-1.5e3") == -1500);
+	REQUIRE(parse<float32_t>("inf") == float32_t::INF());
+	for (int i = -1000; i <= 1000; i += 7) {
+		const auto value = float32_t(i) / 9;
+		REQUIRE(parse<float32_t>(text(value).c_str()) == value);
+	}
+}
@@ -0,0 +1,146 @@
+#include "test_utils.hpp"
+
+#include "fas/math.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+using long_t = Float<int32_t, int16_t>;
+using huge_t = Float<int64_t, int16_t>;
+using decimal_t = Float<int32_t, int16_t, 10>;
+using hex_t = Float<int32_t, int16_t, 16>;
+
+//! @returns The exact value of `value`.
+template <typename Tfloat> long double exact(const Tfloat &value) {
+	return static_cast<long double>(value.mantissa()) *
+	       std::pow(static_cast<long double>(Tfloat::EXPONENT_BASE()),
+	                static_cast<long double>(value.exponent()));
+}
+
+//! @returns The largest relative error allowed: two digits of the last place
+//! of a normalized mantissa or about `2 ^ -52`, whichever is larger.
+template <typename Tfloat> long double tolerance() {
+	return std::max(2.0L * Tfloat::EXPONENT_BASE() / Tfloat::MAX().mantissa(),
+	                std::ldexp(1.0L, -52));
+}
+
+//! Checks `fas::exp`, `fas::log`, `fas::sin` and `fas::cos` of `Tfloat` for
+//! arguments in `[-limit, limit]` against those of `long double`.
+template <typename Tfloat> void check_functions(const double limit) {
+	const auto epsilon = tolerance<Tfloat>();
+	for (double x = -limit; x <= limit; x += limit / 37) {
+		const Tfloat value(x);
+		const auto argument = exact(value);
+
+		REQUIRE(std::abs(exact(fas::exp(value)) - std::exp(argument)) <=
+		        epsilon * std::exp(argument));
+		if (argument > 0) {
+			// Near 1, the logarithm's error is relative to the argument.
+			REQUIRE(std::abs(exact(fas::log(value)) - std::log(argument)) <=
+			        epsilon * std::max(std::abs(std::log(argument)), 1.0L));
+		}
+		// The errors of the reduced angles are relative to the arguments.
+		const auto angle = std::max(std::abs(argument), 1.0L);
+		REQUIRE(std::abs(exact(fas::sin(value)) - std::sin(argument)) <=
+		        epsilon * angle);
+		REQUIRE(std::abs(exact(fas::cos(value)) - std::cos(argument)) <=
+		        epsilon * angle);
+	}
+}
+
+} // namespace
+
+TEST_CASE("Elementary functions are constexpressions.") {
+	static_assert(fas::sqrt(float8_t(4)) == 2);
+	static_assert(fas::sqrt(float8_t(int8_t(81), int8_t(-2))) == 4.5);
+	static_assert(fas::exp(long_t(0)) == 1);
+	static_assert(fas::log(long_t(1)) == 0);
+	static_assert(fas::sin(long_t(0)) == 0);
+	static_assert(fas::cos(long_t(0)) == 1);
+	static_assert(fas::exp(long_t(1)) > 2.718281);
+	static_assert(fas::exp(long_t(1)) < 2.718282);
+}
+
+TEST_CASE("Square roots of any base.") {
+	REQUIRE(fas::sqrt(long_t(2)) == long_t(std::sqrt(2.0)));
+	REQUIRE(fas::sqrt(decimal_t(2)) ==
+	        decimal_t(int32_t(1414213562), int16_t(-9)));
+	REQUIRE(fas::sqrt(hex_t(0.25)) == 0.5);
+
+	// The root is rounded like the operators.
+	using nearest_t = rounded<long_t, rounding::nearest_even>;
+	for (int i = 2; i < 100; ++i) {
+		const auto root = fas::sqrt(nearest_t(i));
+		REQUIRE(std::abs(exact(root) - std::sqrt(static_cast<long double>(i))) <=
+		        std::ldexp(0.5L, root.exponent()));
+		REQUIRE(fas::sqrt(long_t(i)) <= std::sqrt(static_cast<double>(i)));
+	}
+}
+
+TEST_CASE("Elementary functions of special values.") {
+	REQUIRE(fas::sqrt(long_t(-1)).classify() == classification::not_a_number);
+	REQUIRE(fas::sqrt(long_t::INF()) == long_t::INF());
+
+	REQUIRE(fas::exp(long_t::INF()) == long_t::INF());
+	REQUIRE(fas::exp(long_t::NEGATIVE_INF()) == long_t::ZERO());
+	REQUIRE(fas::exp(long_t::NOT_A_NUMBER()).classify() ==
+	        classification::not_a_number);
+	REQUIRE(fas::exp(long_t(1e6)) == long_t::INF());
+	REQUIRE(fas::exp(long_t(-1e6)) == long_t::ZERO());
+	REQUIRE(fas::exp(float8_t(100)) == float8_t::INF());
+
+	REQUIRE(fas::log(long_t::ZERO()) == long_t::NEGATIVE_INF());
+	REQUIRE(fas::log(long_t::INF()) == long_t::INF());
+	REQUIRE(fas::log(long_t(-1)).classify() == classification::not_a_number);
+
+	REQUIRE(fas::sin(long_t::INF()).classify() == classification::not_a_number);
+	REQUIRE(fas::cos(long_t::NEGATIVE_INF()).classify() ==
+	        classification::not_a_number);
+	REQUIRE(fas::sin(long_t(0x1p70)).classify() ==
+	        classification::not_a_number);
+}
+
+TEST_CASE("Elementary functions track the mantissa's precision.") {
+	check_functions<float8_t>(4);
+	check_functions<Float<int16_t, int8_t>>(10);
+	check_functions<long_t>(40);
+	check_functions<huge_t>(40);
+	check_functions<decimal_t>(40);
+	check_functions<hex_t>(40);
+	check_functions<Float<int32_t, int16_t, 7>>(20);
+}
+
+TEST_CASE("Elementary functions of extreme arguments.") {
+	// Logarithms of the exponents' whole range, beyond that of `long double`.
+	const auto max = huge_t::MAX();
+	REQUIRE(std::abs(exact(fas::log(max)) -
+	                 (std::log(static_cast<long double>(max.mantissa())) +
+	                  max.exponent() * std::log(2.0L))) < 1e-12L);
+	const auto min = decimal_t::MIN();
+	REQUIRE(std::abs(exact(fas::log(min)) -
+	                 (std::log(static_cast<long double>(min.mantissa())) +
+	                  min.exponent() * std::log(10.0L))) < 1e-4L);
+
+	// Small angles keep their relative precision.
+	for (const double x : {1e-3, -1e-7, 0x1p-40, 1e-30}) {
+		const auto argument = exact(long_t(x));
+		REQUIRE(std::abs(exact(fas::sin(long_t(x))) - std::sin(argument)) <=
+		        tolerance<long_t>() * std::abs(argument));
+		REQUIRE(std::abs(exact(fas::sin(decimal_t(x))) -
+		                 std::sin(exact(decimal_t(x)))) <=
+		        tolerance<decimal_t>() * std::abs(x));
+	}
+
+	// Large angles, reduced by many multiples of pi / 2.
+	const huge_t large(123456789.0);
+	REQUIRE(std::abs(exact(fas::sin(large)) - std::sin(123456789.0L)) < 1e-9L);
+	REQUIRE(std::abs(exact(fas::cos(large)) - std::cos(123456789.0L)) < 1e-9L);
+
+	// Results near the smallest and largest values.
+	REQUIRE(std::abs(exact(fas::exp(long_t(-11000))) - std::exp(-11000.0L)) <=
+	        tolerance<long_t>() * std::exp(-11000.0L));
+	REQUIRE(std::abs(exact(fas::exp(decimal_t(11000))) - std::exp(11000.0L)) <=
+	        tolerance<decimal_t>() * std::exp(11000.0L));
+}
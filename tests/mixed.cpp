@@ -0,0 +1,92 @@
+#include "test_utils.hpp"
+
+namespace {
+
+using narrow_t = Float<int16_t, int8_t>;
+using wide_t = Float<int32_t, int8_t>;
+using long_t = Float<int32_t, int16_t>;
+
+} // namespace
+
+TEST_CASE("Converting between floats is a constexpression.") {
+	constexpr narrow_t value(3);
+	static_assert(wide_t(value) == 3);
+	static_assert(narrow_t(wide_t(value)) == value);
+}
+
+TEST_CASE("Widening floats keeps their values.") {
+	const narrow_t value(-12345.678);
+	const wide_t wide(value);
+	REQUIRE(wide.mantissa() == value.mantissa() * 0x10000);
+	REQUIRE(wide.exponent() == value.exponent() - 16);
+	REQUIRE(static_cast<double>(wide) == static_cast<double>(value));
+
+	for (const auto &limit : {narrow_t::MAX(), narrow_t::MIN()}) {
+		REQUIRE(long_t(limit) == long_t(static_cast<double>(limit)));
+	}
+	REQUIRE(narrow_t(wide) == value);
+}
+
+TEST_CASE("Narrowing floats truncates them.") {
+	const wide_t value(0x12345678, 0);
+	REQUIRE(narrow_t(value).mantissa() == 0x48d1);
+	REQUIRE(narrow_t(value).exponent() == 14);
+	REQUIRE(narrow_t(-value) == -narrow_t(value));
+
+	REQUIRE(narrow_t(long_t(1, 1000)) == narrow_t::INF());
+	REQUIRE(narrow_t(long_t(-1, 1000)) == narrow_t::NEGATIVE_INF());
+	REQUIRE(narrow_t(long_t(1, -1000)) == narrow_t::ZERO());
+
+	// The narrow mantissa truncates the largest positive value to its limit.
+	using unbalanced_t = Float<int16_t, int8_t, 2, -0x8000, 0x7ffe>;
+	REQUIRE(unbalanced_t(narrow_t(int16_t(0x7fff), int8_t(0))).mantissa() ==
+	        0x7ffe);
+	REQUIRE(unbalanced_t(narrow_t(int16_t(0x7fff), int8_t(0))).exponent() == 0);
+	REQUIRE(unbalanced_t(double(0x7fff)) ==
+	        unbalanced_t(narrow_t(int16_t(0x7fff), int8_t(0))));
+}
+
+TEST_CASE("Converting special floats.") {
+	REQUIRE(wide_t(narrow_t::ZERO()) == wide_t::ZERO());
+	REQUIRE(wide_t(narrow_t::INF()) == wide_t::INF());
+	REQUIRE(wide_t(narrow_t::NEGATIVE_INF()) == wide_t::NEGATIVE_INF());
+	REQUIRE(wide_t(narrow_t::NOT_A_NUMBER()).classify() ==
+	        classification::not_a_number);
+}
+
+TEST_CASE("Mixed operations promote to the wider float.") {
+	const narrow_t narrow(1.5);
+	const wide_t wide(1.0 / 3);
+
+	static_assert(std::is_same<decltype(narrow + wide), wide_t>::value);
+	static_assert(std::is_same<decltype(wide - narrow), wide_t>::value);
+	static_assert(std::is_same<decltype(narrow * wide), wide_t>::value);
+	static_assert(std::is_same<decltype(narrow / wide), wide_t>::value);
+	static_assert(std::is_same<decltype(narrow * long_t()), long_t>::value);
+	static_assert(std::is_same<decltype(long_t() * wide), long_t>::value);
+
+	REQUIRE(narrow + wide == wide_t(narrow) + wide);
+	REQUIRE(wide - narrow == wide - wide_t(narrow));
+	REQUIRE(narrow * wide == wide_t(narrow) * wide);
+	REQUIRE(narrow / wide == wide_t(narrow) / wide);
+
+	REQUIRE(narrow_t(wide) < wide);
+	REQUIRE(narrow > wide);
+	REQUIRE(narrow == wide_t(1.5));
+	REQUIRE(narrow != wide);
+}
+
+TEST_CASE("Mixed assignments keep the target's type.") {
+	narrow_t target(1);
+	target += wide_t(0.5);
+	REQUIRE(target == 1.5);
+
+	target *= wide_t(4);
+	REQUIRE(target == 6);
+
+	target -= wide_t(7);
+	REQUIRE(target == -1);
+
+	target /= wide_t(-4);
+	REQUIRE(target == 0.25);
+}
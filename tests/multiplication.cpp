@@ -21,7 +21,7 @@ TEST_CASE("Multiplication by one results in the other operand.") {
 	REQUIRE(ufloat8_t(100) * 1 == 100);
 	REQUIRE(ufloat8_t(0xff) * 1 == 0xff);
 
-	REQUIRE(ufloat8_t(0x123456789) * 1 == 0x123456789);
+	REQUIRE(ufloat8_t(0x123456789) * 1 == ufloat8_t(0x123456789));
 
 	REQUIRE(ufloat8_t(0) * 1 == 0);
 	REQUIRE(ufloat8_t(1) * 1 == 1);
@@ -30,7 +30,7 @@ TEST_CASE("Multiplication by one results in the other operand.") {
 	REQUIRE(ufloat8_t(1) * 100 == 100);
 	REQUIRE(ufloat8_t(1) * 0xff == 0xff);
 
-	REQUIRE(ufloat8_t(1) * 0x123456789 == 0x123456789);
+	REQUIRE(ufloat8_t(1) * 0x123456789 == ufloat8_t(0x123456789));
 }
 
 TEST_CASE("Multiplication overflow") {
@@ -90,13 +90,90 @@ TEST_CASE("Expect *= do be defined.") {
 }
 
 TEST_CASE("Don't miss too much accuracy on large numbers") {
-	REQUIRE(float8_t(12345678) * 1 == 12345678);
-	REQUIRE(float8_t(-12345678) * 1 == -12345678);
-	REQUIRE(float8_t(12345678) * -1 == -12345678);
-	REQUIRE(float8_t(-12345678) * -1 == 12345678);
-
-	REQUIRE(float8_t(26) * 26 == 676);
-	REQUIRE(float8_t(-26) * 26 == -676);
-	REQUIRE(float8_t(26) * -26 == -676);
-	REQUIRE(float8_t(-26) * -26 == 676);
+	// The integers are compared exactly, so they get truncated explicitly.
+	REQUIRE(float8_t(12345678) * 1 == float8_t(12345678));
+	REQUIRE(float8_t(-12345678) * 1 == float8_t(-12345678));
+	REQUIRE(float8_t(12345678) * -1 == float8_t(-12345678));
+	REQUIRE(float8_t(-12345678) * -1 == float8_t(12345678));
+
+	REQUIRE(float8_t(26) * 26 == float8_t(676));
+	REQUIRE(float8_t(-26) * 26 == float8_t(-676));
+	REQUIRE(float8_t(26) * -26 == float8_t(-676));
+	REQUIRE(float8_t(-26) * -26 == float8_t(676));
+}
+
+TEST_CASE("Multiplication truncates the exact product once.") {
+	using Float16T = Float<int16_t, int8_t>;
+
+	REQUIRE((Float16T(255) * 255).mantissa() == 0x7f00);
+	REQUIRE((Float16T(255) * 255).exponent() == 1);
+	REQUIRE((Float16T(-255) * 255).mantissa() == -0x7f00);
+	REQUIRE((Float16T(-255) * 255).exponent() == 1);
+
+	using Float64T = Float<int64_t, int16_t>;
+	const auto largest = Float64T(std::numeric_limits<int64_t>::max(), 0);
+
+	REQUIRE((largest * largest).mantissa() == 0x7fff'ffff'ffff'fffe);
+	REQUIRE((largest * largest).exponent() == 63);
+
+	REQUIRE(float8_t(-43) * 3 == float8_t(-128));
+	REQUIRE((float8_t(-43) * 3).mantissa() == -128);
+
+	// -129 * 2 ^ -129 lies below -65 * 2 ^ -128, the smallest negative
+	// magnitude.
+	REQUIRE(float8_t(int8_t(-86), int8_t(-64)) *
+	            float8_t(int8_t(96), int8_t(-71)) ==
+	        float8_t::ZERO());
+	REQUIRE(float8_t(int8_t(-86), int8_t(-64)) *
+	            float8_t(int8_t(96), int8_t(-70)) ==
+	        float8_t(int8_t(-128), int8_t(-128)));
+}
+
+TEST_CASE("Multiplication exceeding the exponent.") {
+	using Float16T = Float<int16_t, int8_t>;
+
+	REQUIRE(Float16T::MAX() * Float16T::MAX() == Float16T::INF());
+	REQUIRE(Float16T::LOWEST() * Float16T::MAX() == Float16T::NEGATIVE_INF());
+	REQUIRE(Float16T::MIN() * Float16T::MIN() == Float16T::ZERO());
+}
+
+TEST_CASE("Multiplying by a power of BASE adjusts the exponent.") {
+	using Float16T = Float<int16_t, int8_t>;
+	const Float16T value(-12345.678);
+
+	REQUIRE((value * 2).mantissa() == value.mantissa());
+	REQUIRE((value * 2).exponent() == value.exponent() + 1);
+	REQUIRE(value * 1024 == value * Float16T(1024));
+	REQUIRE(value * -4 == value * Float16T(-4));
+	REQUIRE(value * 3 == value * Float16T(3));
+	REQUIRE(Float16T::LOWEST() * -2 == Float16T::LOWEST() * Float16T(-2));
+	REQUIRE(Float16T::MAX() * 2 == Float16T::INF());
+	REQUIRE(Float16T::INF() * -2 == Float16T::NEGATIVE_INF());
+	REQUIRE(Float16T::ZERO() * 2 == Float16T::ZERO());
+
+	using Float16Hex = Float<int16_t, int8_t, 16>;
+	REQUIRE(Float16Hex(3) * 256 == 768);
+	REQUIRE(Float16Hex(3) * 2 == 6);
+
+	using Float16Dec = Float<int16_t, int8_t, 10>;
+	REQUIRE((Float16Dec(37) * 10).mantissa() == Float16Dec(37).mantissa());
+	REQUIRE(Float16Dec(37) * 100 == 3700);
+}
+
+TEST_CASE("Scaling adjusts only the exponent.") {
+	using Float16T = Float<int16_t, int8_t>;
+	constexpr Float16T value(3);
+
+	static_assert(scale(value, 2) == 12);
+	REQUIRE(value.scale(-1) == 1.5);
+	REQUIRE(scale(value, 0) == value);
+	REQUIRE(scale(value, 1000) == Float16T::INF());
+	REQUIRE(scale(-value, 1000) == Float16T::NEGATIVE_INF());
+	REQUIRE(scale(value, -1000) == Float16T::ZERO());
+	REQUIRE(scale(value, std::numeric_limits<std::intmax_t>::min()) ==
+	        Float16T::ZERO());
+	REQUIRE(scale(Float16T::MIN(), 1) == Float16T::MIN() * 2);
+	REQUIRE(scale(Float16T::NOT_A_NUMBER(), 1).classify() ==
+	        classification::not_a_number);
+	REQUIRE(scale(Float16T::NEGATIVE_INF(), -1) == Float16T::NEGATIVE_INF());
 }
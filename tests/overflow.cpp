@@ -0,0 +1,157 @@
+#include "test_utils.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace {
+
+using unchecked_t = unchecked<float8_t>;
+using wide_t = unchecked<Float<int16_t, int8_t>>;
+using saturating_t = saturating<float8_t>;
+
+//! @returns Some finite values of `Tfloat`, including zero.
+template <typename Tfloat> std::vector<Tfloat> samples() {
+	std::vector<Tfloat> result = {Tfloat::ZERO()};
+	for (int mantissa = -128; mantissa < 128; mantissa += 5) {
+		for (const int exponent : {-9, -2, 0, 4}) {
+			result.emplace_back(int8_t(mantissa), int8_t(exponent));
+		}
+	}
+	return result;
+}
+
+} // namespace
+
+TEST_CASE("Floats check their operations by default.") {
+	static_assert(std::is_same<overflowing<float8_t, overflow::infinity>,
+	                           float8_t>::value);
+	static_assert(std::is_same<overflowing<unchecked_t, overflow::infinity>,
+	                           float8_t>::value);
+	static_assert(!std::is_same<unchecked_t, float8_t>::value);
+	static_assert(std::is_same<overflowing<saturating_t, overflow::infinity>,
+	                           float8_t>::value);
+}
+
+TEST_CASE("Unchecked operations are constexpressions.") {
+	static_assert(unchecked_t(3) * unchecked_t(5) == 15);
+	static_assert(unchecked_t(3) + unchecked_t(5) == 8);
+	static_assert(unchecked_t(3) - unchecked_t(5) == -2);
+	static_assert(unchecked_t(3) / unchecked_t(4) == 0.75);
+	static_assert(-unchecked_t(3) == -3);
+}
+
+TEST_CASE("Unchecked operations equal the checked ones.") {
+	const auto values = samples<float8_t>();
+	for (const auto &a : values) {
+		for (const auto &b : values) {
+			const unchecked_t x(a.mantissa(), a.exponent());
+			const unchecked_t y(b.mantissa(), b.exponent());
+			REQUIRE(static_cast<double>(x * y) == static_cast<double>(a * b));
+			REQUIRE(static_cast<double>(-x) == static_cast<double>(-a));
+			if (b != 0) {
+				REQUIRE(static_cast<double>(x / y) == static_cast<double>(a / b));
+			}
+
+			// The sums get truncated exactly, as the conversions of their exact
+			// `double`s do.
+			const auto first = static_cast<double>(a);
+			const auto second = static_cast<double>(b);
+			REQUIRE(x + y == unchecked_t(first + second));
+			REQUIRE(x - y == unchecked_t(first - second));
+			REQUIRE(x + y == unchecked_t(a + b));
+		}
+	}
+}
+
+TEST_CASE("Unchecked operations handle zeros.") {
+	const unchecked_t zero = unchecked_t::ZERO();
+	const unchecked_t value(int8_t(-100), int8_t(-20));
+	REQUIRE(zero + value == value);
+	REQUIRE(value + zero == value);
+	REQUIRE(zero - value == -value);
+	REQUIRE(value - zero == value);
+	REQUIRE(value - value == zero);
+	REQUIRE(zero + zero == zero);
+	REQUIRE(zero * value == zero);
+	REQUIRE(zero / value == zero);
+	REQUIRE(-zero == zero);
+}
+
+TEST_CASE("Unchecked floats round and widen.") {
+	using nearest_t = rounded<unchecked_t, rounding::nearest_even>;
+	using checked_t = rounded<float8_t, rounding::nearest_even>;
+	const auto values = samples<float8_t>();
+	for (const auto &a : values) {
+		for (const auto &b : values) {
+			const nearest_t x(a.mantissa(), a.exponent());
+			const nearest_t y(b.mantissa(), b.exponent());
+			const checked_t checked_x(x), checked_y(y);
+			REQUIRE(static_cast<double>(x + y) ==
+			        static_cast<double>(checked_x + checked_y));
+			REQUIRE(static_cast<double>(x - y) ==
+			        static_cast<double>(checked_x - checked_y));
+		}
+	}
+
+	REQUIRE(wide_t(unchecked_t(1.5)) + unchecked_t(2) == 3.5);
+}
+
+TEST_CASE("Saturating operations clamp their results.") {
+	const auto max = saturating_t::MAX();
+	const auto lowest = saturating_t::LOWEST();
+	const auto min = saturating_t::MIN();
+	REQUIRE(max + max == max);
+	REQUIRE(lowest + lowest == lowest);
+	REQUIRE(lowest - max == lowest);
+	REQUIRE(max - lowest == max);
+	REQUIRE(max * max == max);
+	REQUIRE(max * lowest == lowest);
+	REQUIRE(min * min == 0);
+	REQUIRE(min / max == 0);
+	REQUIRE(max / min == max);
+	REQUIRE(saturating_t(3) / saturating_t::ZERO() == max);
+	REQUIRE(saturating_t(-3) / saturating_t::ZERO() == lowest);
+	REQUIRE(saturating_t::ZERO() / saturating_t::ZERO() == 0);
+
+	REQUIRE(saturating_t(1e300) == max);
+	REQUIRE(saturating_t(-std::numeric_limits<double>::infinity()) == lowest);
+
+	static_assert(saturating_t::MAX() * saturating_t(2) == saturating_t::MAX());
+	static_assert(saturating_t(3) + saturating_t(5) == 8);
+
+	// Without a type of the doubled mantissa width, the checks remain.
+	using wide_saturating_t = saturating<Float<int64_t, int8_t>>;
+	REQUIRE(wide_saturating_t::MAX() * 2 == wide_saturating_t::MAX());
+	REQUIRE(wide_saturating_t::LOWEST() - wide_saturating_t::MAX() ==
+	        wide_saturating_t::LOWEST());
+}
+
+TEST_CASE("Saturating operations equal the checked ones within range.") {
+	// Maps the infinities of checked results to the saturated magnitudes.
+	const auto saturated = [](const float8_t &value) {
+		if (value == float8_t::INF()) {
+			return static_cast<double>(float8_t::MAX());
+		}
+		if (value == float8_t::NEGATIVE_INF()) {
+			return static_cast<double>(float8_t::LOWEST());
+		}
+		return static_cast<double>(value);
+	};
+
+	const auto values = samples<float8_t>();
+	for (const auto &a : values) {
+		for (const auto &b : values) {
+			const saturating_t x(a.mantissa(), a.exponent());
+			const saturating_t y(b.mantissa(), b.exponent());
+			REQUIRE(static_cast<double>(x * y) == saturated(a * b));
+			if (b != 0) {
+				REQUIRE(static_cast<double>(x / y) == saturated(a / b));
+			}
+
+			const auto first = static_cast<double>(a);
+			const auto second = static_cast<double>(b);
+			REQUIRE(x + y == saturating_t(first + second));
+			REQUIRE(x - y == saturating_t(first - second));
+		}
+	}
+}
@@ -0,0 +1,118 @@
+#include "test_utils.hpp"
+
+#include "fas/packed.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+//! Requires that `value` is unpacked as it was packed.
+template <typename Tfloat> void require_round_trip(const Tfloat &value) {
+	std::byte buffer[packed_size<Tfloat>];
+	pack(&value, 1, buffer);
+
+	auto result = Tfloat::NOT_A_NUMBER();
+	unpack(buffer, 1, &result);
+	REQUIRE(result.mantissa() == value.mantissa());
+	REQUIRE(result.exponent() == value.exponent());
+}
+
+} // namespace
+
+TEST_CASE("Packed values take the fewest bytes.") {
+	REQUIRE(packed_size<float8_t> == 2);
+	REQUIRE(packed_size<ufloat8_t> == 2);
+	REQUIRE(packed_size<Float<int16_t, int8_t>> == 3);
+	REQUIRE(packed_size<Float<int32_t, int8_t>> == 5);
+	REQUIRE(packed_size<Float<int64_t, int16_t>> == 10);
+
+	// 11 bits of mantissa and 6 bits of exponent.
+	REQUIRE(packed_size<Float<int16_t, int8_t, 10, -999, 999, -20, 20>> == 3);
+	REQUIRE(packed_size<Float<int16_t, int8_t, 10, -999, 999, -9, 9>> == 2);
+}
+
+TEST_CASE("Packs little endian, the mantissa first.") {
+	std::byte buffer[3];
+	const auto value = Float<int16_t, int8_t>(int16_t(-0x4321), int8_t(-2));
+	pack(&value, 1, buffer);
+
+	const auto mantissa = static_cast<uint16_t>(value.mantissa());
+	REQUIRE(std::to_integer<int>(buffer[0]) == (mantissa & 0xff));
+	REQUIRE(std::to_integer<int>(buffer[1]) == mantissa >> 8);
+	REQUIRE(std::to_integer<int>(buffer[2]) ==
+	        static_cast<uint8_t>(value.exponent()));
+}
+
+TEST_CASE("Every float8_t and ufloat8_t survives packing.") {
+	for (int exponent = -128; exponent <= 127; ++exponent) {
+		for (int mantissa = -128; mantissa <= 127; ++mantissa) {
+			require_round_trip(float8_t(int8_t(mantissa), int8_t(exponent)));
+			require_round_trip(ufloat8_t(uint8_t(mantissa + 128), int8_t(exponent)));
+		}
+	}
+}
+
+TEST_CASE("Special values survive packing.") {
+	using narrow_t = Float<int16_t, int8_t, 10, -999, 999, -9, 9>;
+	for (const auto &value : {narrow_t::ZERO(), narrow_t::INF(),
+	                          narrow_t::NEGATIVE_INF(), narrow_t::NOT_A_NUMBER(),
+	                          narrow_t::MIN(), narrow_t::MAX(),
+	                          narrow_t::LOWEST()}) {
+		require_round_trip(value);
+	}
+
+	for (const auto &value : {Float<int64_t, int16_t>::LOWEST(),
+	                          Float<int64_t, int16_t>::MAX(),
+	                          Float<int64_t, int16_t>::NEGATIVE_INF()}) {
+		require_round_trip(value);
+	}
+}
+
+TEST_CASE("Packs and unpacks in bulk.") {
+	using float_t = Float<int32_t, int8_t>;
+	std::mt19937 generator(12);
+	std::uniform_int_distribution<int32_t> mantissa;
+	std::uniform_int_distribution<int> exponent(-128, 127);
+
+	std::vector<float_t> values;
+	for (int i = 0; i < 1000; ++i) {
+		values.push_back(float_t(mantissa(generator), int8_t(exponent(generator))));
+	}
+
+	std::vector<std::byte> bytes(values.size() * packed_size<float_t>);
+	REQUIRE(pack(values.data(), values.size(), bytes.data()) ==
+	        bytes.data() + bytes.size());
+
+	std::vector<float_t> unpacked(values.size());
+	REQUIRE(unpack(bytes.data(), values.size(), unpacked.data()) ==
+	        bytes.data() + bytes.size());
+	REQUIRE(unpacked == values);
+}
+
+TEST_CASE("PackedView reads unaligned packed values.") {
+	using float_t = Float<int16_t, int8_t>;
+	const std::vector<float_t> values = {float_t(1), float_t(-3) / 7,
+	                                     float_t::INF(), float_t::MAX(),
+	                                     float_t::ZERO()};
+
+	// An odd offset misaligns the values.
+	std::vector<std::byte> bytes(1 + values.size() * packed_size<float_t>);
+	pack(values.data(), values.size(), bytes.data() + 1);
+
+	const PackedView<float_t> view(bytes.data() + 1, values.size());
+	REQUIRE(view.size() == values.size());
+	REQUIRE(!view.empty());
+	REQUIRE(view.size_bytes() == bytes.size() - 1);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		REQUIRE(view[i] == values[i]);
+	}
+
+	REQUIRE(std::equal(view.begin(), view.end(), values.begin(), values.end()));
+	REQUIRE(view.end() - view.begin() == 5);
+	REQUIRE(view.begin()[3] == float_t::MAX());
+	REQUIRE(*(view.end() - 1) == float_t::ZERO());
+	REQUIRE(PackedView<float_t>().empty());
+}
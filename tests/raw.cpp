@@ -0,0 +1,88 @@
+#include "test_utils.hpp"
+
+#include "fas/accumulator.hpp"
+#include "fas/expr.hpp"
+
+#include <sstream>
+
+namespace {
+
+using raw_t = RawFloat<float8_t>;
+
+} // namespace
+
+TEST_CASE("Raw floats are constexpressions.") {
+	constexpr raw_t x = float8_t(100);
+	static_assert((x * x + float8_t(-9984)).value() == 16);
+	static_assert(x - float8_t(1) < x);
+	static_assert(raw_t() == float8_t::ZERO());
+}
+
+TEST_CASE("Raw floats normalize their results once.") {
+	// The operators stall before 128, from where another 1 gets truncated.
+	float8_t normalized(0);
+	raw_t raw;
+	for (int i = 0; i < 200; ++i) {
+		normalized += float8_t(1);
+		raw += float8_t(1);
+	}
+	REQUIRE(normalized <= 128);
+	REQUIRE(raw.value() == 200);
+	REQUIRE(static_cast<float8_t>(raw) == 200);
+
+	// Like expressions, products keep all their digits.
+	const float8_t x(100);
+	REQUIRE(x * x - float8_t(9984) == 0);
+	REQUIRE((raw_t(x) * x - float8_t(9984)).value() == 16);
+}
+
+TEST_CASE("Raw floats equal the exact result truncated once.") {
+	using wide_t = Float<int16_t, int8_t>;
+	Accumulator<wide_t> exact;
+	RawFloat<wide_t> sum;
+	for (int i = 1; i < 500; ++i) {
+		const wide_t value(1.0 / i);
+		const wide_t weight(i % 7 - 3.5);
+		exact.add_product(value, weight);
+		sum += RawFloat<wide_t>(value) * weight;
+	}
+
+	// The sum is truncated below the doubled width only.
+	const auto difference = sum.value() - exact.result();
+	REQUIRE(static_cast<double>(difference) <= 0.01);
+	REQUIRE(static_cast<double>(difference) >= -0.01);
+}
+
+TEST_CASE("Raw floats normalize for comparisons, divisions and output.") {
+	const raw_t a = raw_t(float8_t(127)) + float8_t(1) + float8_t(1);
+	const raw_t b = float8_t(129);
+	REQUIRE(a.value() == 128);
+	REQUIRE(a == b);
+	REQUIRE(a <= b);
+	REQUIRE(a >= b);
+	REQUIRE(!(a < b));
+	REQUIRE(-a < b);
+	REQUIRE(-a != b);
+	REQUIRE(a > float8_t(127));
+
+	REQUIRE((a / float8_t(2)).value() == 64);
+
+	std::ostringstream stream;
+	stream << raw_t(float8_t(3)) * float8_t(0.5);
+	REQUIRE(stream.str() == "1.5");
+}
+
+TEST_CASE("Raw floats propagate special values.") {
+	raw_t value = float8_t::INF();
+	value += float8_t(1);
+	REQUIRE(value.value() == float8_t::INF());
+
+	value -= float8_t::INF();
+	REQUIRE(value.value().classify() == classification::not_a_number);
+
+	// Results out of range become infinite once normalized.
+	raw_t large = float8_t::MAX();
+	large *= float8_t::MAX();
+	REQUIRE(large.value() == float8_t::INF());
+	REQUIRE((large / float8_t::MAX()).value() == float8_t::INF());
+}
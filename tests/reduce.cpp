@@ -0,0 +1,138 @@
+#include "test_utils.hpp"
+
+#include "fas/reduce.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TEST_CASE("Sums of the empty range are zero.") {
+	REQUIRE(reduce_sum(static_cast<const float8_t *>(nullptr), 0) ==
+	        float8_t::ZERO());
+	REQUIRE(reduce_sum(FloatVector<float8_t>()) == float8_t::ZERO());
+	REQUIRE(dot(FloatVector<float8_t>(), FloatVector<float8_t>()) ==
+	        float8_t::ZERO());
+	REQUIRE(norm2(FloatVector<float8_t>()) == float8_t::ZERO());
+}
+
+TEST_CASE("Sums integers exactly.") {
+	using float_t = Float<int32_t, int8_t>;
+	std::vector<float_t> values;
+	for (int i = 1; i <= 10000; ++i) {
+		values.push_back(float_t(i));
+	}
+
+	REQUIRE(reduce_sum(values.data(), values.size()) == 50005000);
+	REQUIRE(reduce_sum(values.data(), values.size(), 1) == 50005000);
+	REQUIRE(dot(values.data(), values.data(), 100) == 338350);
+}
+
+TEST_CASE("Sums are truncated once.") {
+	// Each addition of 0.25 to 64 gets truncated by `operator+`.
+	std::vector<float8_t> values = {float8_t(64)};
+	values.resize(201, float8_t(0.25));
+
+	REQUIRE(std::accumulate(values.begin(), values.end(), float8_t::ZERO()) ==
+	        64);
+	REQUIRE(reduce_sum(values.data(), values.size()) == 114);
+}
+
+TEST_CASE("Reductions do not depend on the number of threads.") {
+	using float_t = Float<int16_t, int8_t>;
+	std::mt19937 generator(15);
+	std::uniform_int_distribution<int16_t> mantissa;
+	std::uniform_int_distribution<int> exponent(-20, 20);
+
+	FloatVector<float_t> first, second;
+	for (int i = 0; i < 100000; ++i) {
+		first.push_back(float_t(mantissa(generator), int8_t(exponent(generator))));
+		second.push_back(float_t(mantissa(generator), int8_t(exponent(generator))));
+	}
+
+	const auto sum = reduce_sum(first, 1);
+	const auto product = dot(first, second, 1);
+	const auto norm = norm2(first, 1);
+	for (const unsigned threads : {0u, 2u, 3u, 7u, 64u}) {
+		const auto other_sum = reduce_sum(first, threads);
+		REQUIRE(other_sum.mantissa() == sum.mantissa());
+		REQUIRE(other_sum.exponent() == sum.exponent());
+
+		const auto other_product = dot(first, second, threads);
+		REQUIRE(other_product.mantissa() == product.mantissa());
+		REQUIRE(other_product.exponent() == product.exponent());
+
+		REQUIRE(norm2(first, threads) == norm);
+	}
+
+	std::vector<float_t> values(first.size());
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		values[i] = first[i];
+	}
+	REQUIRE(reduce_sum(values.data(), values.size(), 3) == sum);
+}
+
+TEST_CASE("Reductions keep the mantissa's digits.") {
+	using float_t = Float<int16_t, int8_t>;
+	std::mt19937 generator(16);
+	std::uniform_int_distribution<int16_t> mantissa(1, 0x7fff);
+	std::uniform_int_distribution<int> exponent(-40, 40);
+
+	for (int round = 0; round < 20; ++round) {
+		std::vector<float_t> values;
+		long double sum = 0;
+		long double squares = 0;
+		for (int i = 0; i < 3000; ++i) {
+			values.push_back(
+			    float_t(mantissa(generator), int8_t(exponent(generator))));
+			const auto value = static_cast<long double>(values.back());
+			sum += value;
+			squares += value * value;
+		}
+
+		const auto result = reduce_sum(values.data(), values.size());
+		REQUIRE(std::fabs(static_cast<long double>(result) - sum) <= sum / 0x4000);
+		const auto product = dot(values.data(), values.data(), values.size());
+		REQUIRE(std::fabs(static_cast<long double>(product) - squares) <=
+		        squares / 0x4000);
+	}
+}
+
+TEST_CASE("Dot products do not truncate the products.") {
+	const FloatVector<float8_t> first = {float8_t(127), float8_t(-127)};
+	const FloatVector<float8_t> second = {float8_t(127), float8_t(126)};
+
+	// 127 * 127 itself is truncated to 16128.
+	REQUIRE(first[0] * second[0] + first[1] * second[1] == 128);
+	REQUIRE(dot(first, second) == 127);
+	REQUIRE(dot(first, FloatVector<float8_t>{float8_t(2)}) == 254);
+}
+
+TEST_CASE("Norms are truncated square roots.") {
+	REQUIRE(norm2(FloatVector<float8_t>{float8_t(3), float8_t(-4)}) == 5);
+	REQUIRE(norm2(FloatVector<float8_t>{float8_t(-0.5)}) == 0.5);
+
+	using float_t = Float<int32_t, int16_t>;
+	for (const double value : {1.0, 3.0, 1e-7, 12345.678, 1e30}) {
+		const FloatVector<float_t> values = {float_t(value), float_t(value)};
+		const auto square = static_cast<double>(dot(values, values));
+		REQUIRE(norm2(values) == float_t(std::sqrt(square)));
+	}
+
+	using decimal_t = Float<int16_t, int8_t, 10>;
+	const auto root = norm2(FloatVector<decimal_t>{decimal_t(1), decimal_t(1)});
+	REQUIRE(static_cast<double>(root) <= std::sqrt(2.0));
+	REQUIRE(static_cast<double>(root) > std::sqrt(2.0) - 1e-3);
+}
+
+TEST_CASE("Reductions propagate special values.") {
+	const FloatVector<float8_t> values = {float8_t(1), float8_t::INF(),
+	                                      float8_t(2)};
+	REQUIRE(reduce_sum(values) == float8_t::INF());
+	REQUIRE(norm2(values) == float8_t::INF());
+
+	const FloatVector<float8_t> infinities = {float8_t::INF(),
+	                                          float8_t::NEGATIVE_INF()};
+	REQUIRE(reduce_sum(infinities).classify() == classification::not_a_number);
+	REQUIRE(dot(infinities, infinities) == float8_t::INF());
+}
@@ -0,0 +1,254 @@
+#include "test_utils.hpp"
+
+#include "fas/accumulator.hpp"
+
+#include <cmath>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+namespace {
+
+using nearest_t = rounded<float8_t, rounding::nearest_even>;
+using upward_t = rounded<float8_t, rounding::upward>;
+using downward_t = rounded<float8_t, rounding::downward>;
+using stochastic_t = rounded<float8_t, rounding::stochastic>;
+using decimal_t = rounded<Float<int8_t, int8_t, 10>, rounding::nearest_even>;
+
+//! @returns The neighbours of `value` among the values of `float8_t`, the
+//! largest one `<= value` and the smallest one `>= value`.
+std::pair<long double, long double> neighbours(const long double value) {
+	auto lower = -HUGE_VALL;
+	auto upper = HUGE_VALL;
+	for (int exponent = -40; exponent <= 40; ++exponent) {
+		const auto unit = std::ldexp(1.0L, exponent);
+		const auto scaled = value / unit;
+		const auto floor = std::min(std::floor(scaled), 127.0L);
+		const auto ceil = std::max(std::ceil(scaled), -128.0L);
+		if (floor >= -128) {
+			lower = std::max(lower, floor * unit);
+		}
+		if (ceil <= 127) {
+			upper = std::min(upper, ceil * unit);
+		}
+	}
+	return {lower, upper};
+}
+
+//! @returns `value` rounded by `ROUNDING` to a value of `float8_t`.
+long double reference(const long double value, const rounding mode) {
+	const auto [lower, upper] = neighbours(value);
+	switch (mode) {
+	case rounding::upward:
+		return upper;
+	case rounding::downward:
+		return lower;
+	case rounding::nearest_even:
+		if (value - lower != upper - value) {
+			return value - lower < upper - value ? lower : upper;
+		}
+		return float8_t(static_cast<double>(lower)).mantissa() % 2 == 0 ? lower
+		                                                                : upper;
+	default:
+		return value < 0 ? upper : lower;
+	}
+}
+
+//! @returns Some finite values of `Tfloat`.
+template <typename Tfloat> std::vector<Tfloat> samples() {
+	std::vector<Tfloat> result;
+	for (int mantissa = -128; mantissa < 128; mantissa += 7) {
+		for (const int exponent : {-6, -1, 0, 3}) {
+			if (mantissa != 0) {
+				result.emplace_back(int8_t(mantissa), int8_t(exponent));
+			}
+		}
+	}
+	return result;
+}
+
+//! Checks the sums, differences, products and quotients of `samples()`.
+//!
+//! @param sums Whether to check the sums and differences.
+template <typename Tfloat>
+void check_operations(const rounding mode, const bool sums = true) {
+	const auto values = samples<Tfloat>();
+	for (const auto &a : values) {
+		for (const auto &b : values) {
+			const auto x = static_cast<long double>(static_cast<double>(a));
+			const auto y = static_cast<long double>(static_cast<double>(b));
+			if (sums) {
+				REQUIRE(static_cast<double>(a + b) == reference(x + y, mode));
+				REQUIRE(static_cast<double>(a - b) == reference(x - y, mode));
+			}
+			REQUIRE(static_cast<double>(a * b) == reference(x * y, mode));
+			REQUIRE(static_cast<double>(a / b) == reference(x / y, mode));
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("Floats truncate by default.") {
+	static_assert(std::is_same<rounded<float8_t, rounding::truncate>,
+	                           float8_t>::value);
+	static_assert(float8_t::ROUNDING_MODE() == rounding::truncate);
+	check_operations<float8_t>(rounding::truncate);
+}
+
+TEST_CASE("Floats truncate sampled pairs by less than one ulp.") {
+	// The accumulator takes the exact sums and products of any exponents.
+	std::mt19937 generator(17);
+	std::uniform_int_distribution<int> mantissa(-128, 127);
+	std::uniform_int_distribution<int> exponent(-128, 127);
+	std::uniform_int_distribution<int> near(-12, 12);
+	for (int i = 0; i < 100000; ++i) {
+		const float8_t a(int8_t(mantissa(generator)), int8_t(exponent(generator)));
+		const float8_t b(int8_t(mantissa(generator)), int8_t(exponent(generator)));
+		Accumulator<float8_t> sum;
+		sum.add(a);
+		sum.add(b);
+		REQUIRE(a + b == sum.result());
+
+		Accumulator<float8_t> difference;
+		difference.add(a);
+		difference.add_product(b, float8_t(-1));
+		REQUIRE(a - b == difference.result());
+
+		Accumulator<float8_t> product;
+		product.add_product(a, b);
+		REQUIRE(a * b == product.result());
+
+		// The neighbours are searched among the exponents of `[-40, 40]`.
+		const float8_t x(int8_t(mantissa(generator)), int8_t(near(generator)));
+		const float8_t y(int8_t(mantissa(generator) | 1), int8_t(near(generator)));
+		REQUIRE(static_cast<double>(x / y) ==
+		        reference(static_cast<double>(x) / static_cast<long double>(
+		                                               static_cast<double>(y)),
+		                  rounding::truncate));
+	}
+}
+
+TEST_CASE("Rounding is a constexpression.") {
+	static_assert(nearest_t(1) / 3 == nearest_t(int8_t(85), int8_t(-8)));
+	static_assert(nearest_t(2) / 3 == nearest_t(int8_t(85), int8_t(-7)));
+	static_assert(upward_t(1) / 3 == upward_t(int8_t(86), int8_t(-8)));
+	static_assert(downward_t(-1) / 3 == downward_t(int8_t(-86), int8_t(-8)));
+}
+
+TEST_CASE("Rounding to nearest, ties to even.") {
+	check_operations<nearest_t>(rounding::nearest_even);
+
+	// 100.5 and 101.5 are ties.
+	REQUIRE(nearest_t(100) + nearest_t(0.5) == 100);
+	REQUIRE(nearest_t(101) + nearest_t(0.5) == 102);
+	REQUIRE(nearest_t(-101) - nearest_t(0.5) == -102);
+	REQUIRE(nearest_t(127) + nearest_t(0.5) == 128);
+	REQUIRE(nearest_t(127) + nearest_t(0.75) == 128);
+}
+
+TEST_CASE("Rounding upward and downward.") {
+	check_operations<upward_t>(rounding::upward);
+	check_operations<downward_t>(rounding::downward);
+}
+
+TEST_CASE("Rounding considers digits far below the mantissa.") {
+	const upward_t tiny(int8_t(1), int8_t(-100));
+	REQUIRE(upward_t(100) + tiny == 101);
+	REQUIRE(upward_t(100) - tiny == 100);
+	REQUIRE(upward_t(-100) + tiny == -99);
+
+	const downward_t small(int8_t(1), int8_t(-100));
+	REQUIRE(downward_t(100) + small == 100);
+	REQUIRE(downward_t(100) - small == 99);
+	REQUIRE(downward_t(-100) - small == -101);
+
+	REQUIRE(nearest_t(100) - nearest_t(int8_t(1), int8_t(-100)) == 100);
+}
+
+TEST_CASE("Sums align alike in every rounding mode.") {
+	// The exponents' difference does not fit their type.
+	using truncated16_t = Float<int16_t, int8_t>;
+	using nearest16_t = rounded<truncated16_t, rounding::nearest_even>;
+	const truncated16_t large(1, 100);
+	const truncated16_t tiny(1, -100);
+	REQUIRE(large + tiny == large);
+	REQUIRE(large - tiny == truncated16_t(int16_t(0x7fff), 85));
+	REQUIRE(tiny - large == truncated16_t(int16_t(-0x7fff), 85));
+	REQUIRE(nearest16_t(1, 100) + nearest16_t(1, -100) == nearest16_t(1, 100));
+	REQUIRE(nearest16_t(1, 100) - nearest16_t(1, -100) == nearest16_t(1, 100));
+}
+
+TEST_CASE("Rounding the largest magnitudes.") {
+	// Only -128 and -130 lie next to -128.75.
+	REQUIRE(nearest_t(-128) - nearest_t(0.75) == -128);
+	REQUIRE(upward_t(-128) - upward_t(0.75) == -128);
+	REQUIRE(downward_t(-128) - downward_t(0.75) == -130);
+
+	// Only 127 and 130 lie next to 127.6.
+	REQUIRE(decimal_t(127) + decimal_t(int8_t(6), int8_t(-1)) == 127);
+	REQUIRE(rounded<decimal_t, rounding::upward>(127) +
+	            rounded<decimal_t, rounding::upward>(int8_t(6), int8_t(-1)) ==
+	        130);
+
+	// Only -128 and -130 lie next to -129.
+	REQUIRE(nearest_t(-43) * nearest_t(3) == -128);
+	REQUIRE(upward_t(-43) * upward_t(3) == -128);
+	REQUIRE(downward_t(-43) * downward_t(3) == -130);
+
+	REQUIRE(upward_t::MAX() + upward_t(1) == upward_t::INF());
+	REQUIRE(downward_t::MAX() + downward_t(1) == downward_t::MAX());
+	REQUIRE(nearest_t::MAX() * nearest_t(2) == nearest_t::INF());
+}
+
+TEST_CASE("Rounding floats of other bases.") {
+	REQUIRE(decimal_t(1) / 3 == decimal_t(int8_t(33), int8_t(-2)));
+	REQUIRE(decimal_t(2) / 3 == decimal_t(int8_t(67), int8_t(-2)));
+	REQUIRE(decimal_t(-2) / 3 == decimal_t(int8_t(-67), int8_t(-2)));
+
+	// 125 * 1.1 == 137.5, of which only 14 * 10 and 13 * 10 are close.
+	const decimal_t factor(int8_t(11), int8_t(-1));
+	REQUIRE(decimal_t(125) * factor == decimal_t(int8_t(14), int8_t(1)));
+}
+
+TEST_CASE("Rounding the exact sum of an accumulator.") {
+	Accumulator<nearest_t> sum;
+	sum.add(nearest_t(100));
+	sum.add(nearest_t(int8_t(1), int8_t(-1)));
+	sum.add(nearest_t(int8_t(1), int8_t(-100)));
+	REQUIRE(sum.result() == 101);
+
+	Accumulator<upward_t> upward;
+	upward.add(upward_t(100));
+	upward.add(upward_t(int8_t(1), int8_t(-100)));
+	REQUIRE(upward.result() == 101);
+	upward.add(upward_t(-101));
+	REQUIRE(upward.result() == upward_t(int8_t(-127), int8_t(-7)));
+}
+
+TEST_CASE("Rounding stochastically.") {
+	seed_stochastic_rounding(1);
+	const stochastic_t third = stochastic_t(1) / 3;
+	REQUIRE((third == stochastic_t(int8_t(85), int8_t(-8)) ||
+	         third == stochastic_t(int8_t(86), int8_t(-8))));
+
+	// Exact results stay exact and the mean approaches the exact value.
+	double mean = 0;
+	constexpr int count = 10000;
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(stochastic_t(3) / 4 == 0.75);
+		mean += static_cast<double>(stochastic_t(1) / 3) / count;
+	}
+	REQUIRE(std::abs(mean - 1.0 / 3) < 1e-4);
+
+	// The same seed reproduces the results.
+	seed_stochastic_rounding(2);
+	std::vector<stochastic_t> first;
+	for (int i = 0; i < 16; ++i) {
+		first.push_back(stochastic_t(1) / 3);
+	}
+	seed_stochastic_rounding(2);
+	for (int i = 0; i < 16; ++i) {
+		REQUIRE(stochastic_t(1) / 3 == first[i]);
+	}
+}
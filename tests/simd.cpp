@@ -0,0 +1,186 @@
+#include "test_utils.hpp"
+
+#include "fas/vector.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+using Float16T = Float<int16_t, int8_t>;
+
+//! @returns Random values, including special ones.
+FloatVector<Float16T> random_values(std::mt19937 &generator,
+                                    const std::size_t size) {
+	std::uniform_int_distribution<int> mantissa(-0x8000, 0x7fff);
+	std::uniform_int_distribution<int> exponent(-128, 127);
+	std::uniform_int_distribution<int> special(0, 63);
+
+	FloatVector<Float16T> result;
+	for (std::size_t i = 0; i < size; ++i) {
+		switch (special(generator)) {
+		case 0:
+			result.push_back(Float16T::ZERO());
+			break;
+		case 1:
+			result.push_back(Float16T::INF());
+			break;
+		case 2:
+			result.push_back(Float16T::NEGATIVE_INF());
+			break;
+		case 3:
+			result.push_back(Float16T::MAX());
+			break;
+		case 4:
+			result.push_back(Float16T::LOWEST());
+			break;
+		default:
+			result.push_back(
+			    Float16T(int16_t(mantissa(generator)), int8_t(exponent(generator))));
+		}
+	}
+	return result;
+}
+} // namespace
+
+TEST_CASE("Vector kernels match the scalar operators bit for bit.") {
+	std::mt19937 generator(7);
+
+	// The size is no multiple of the kernels' block width.
+	const auto first = random_values(generator, 100'003);
+	const auto second = random_values(generator, 100'003);
+	FloatVector<Float16T> result;
+
+	add(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		const auto expected = first[i] + second[i];
+		REQUIRE(result.mantissas()[i] == expected.mantissa());
+		REQUIRE(result.exponents()[i] == expected.exponent());
+	}
+
+	mul(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		const auto expected = first[i] * second[i];
+		REQUIRE(result.mantissas()[i] == expected.mantissa());
+		REQUIRE(result.exponents()[i] == expected.exponent());
+	}
+}
+
+TEST_CASE("Vector kernels add values of distant exponents.") {
+	// The differences of the exponents exceed those of `int8_t`.
+	FloatVector<Float16T> first;
+	FloatVector<Float16T> second;
+	for (int i = 0; i < 64; ++i) {
+		const auto mantissa =
+		    static_cast<int16_t>(i % 2 ? 0x7fff - i : -0x8000 + i);
+		first.push_back(Float16T(mantissa, int8_t(127 - i)));
+		second.push_back(Float16T(int16_t(-mantissa / 3), int8_t(-128 + i)));
+	}
+	FloatVector<Float16T> result;
+
+	add(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		const auto expected = first[i] + second[i];
+		REQUIRE(result.mantissas()[i] == expected.mantissa());
+		REQUIRE(result.exponents()[i] == expected.exponent());
+	}
+
+	add(second, first, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result[i] == second[i] + first[i]);
+	}
+}
+
+TEST_CASE("Vector kernels truncate the lowest magnitudes to the limit.") {
+	// The products -0x8001 * 2 ^ i shrink to -0x4000 * 2 ^ (i + 1).
+	FloatVector<Float16T> first;
+	FloatVector<Float16T> second;
+	for (int i = 0; i < 16; ++i) {
+		first.push_back(Float16T(int16_t(-3), int8_t(i)));
+		second.push_back(Float16T(int16_t(10923), int8_t(-2 * i)));
+	}
+	FloatVector<Float16T> result;
+
+	mul(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result.mantissas()[i] == -0x8000);
+		REQUIRE(result[i] == first[i] * second[i]);
+	}
+
+	// Near the lowest exponent they underflow instead.
+	for (int i = 0; i < 16; ++i) {
+		first.set(i, Float16T(int16_t(-3), int8_t(-64)));
+		second.set(i, Float16T(int16_t(10923), int8_t(-56 - i)));
+	}
+	mul(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result.mantissas()[i] == (first[i] * second[i]).mantissa());
+		REQUIRE(result.exponents()[i] == (first[i] * second[i]).exponent());
+	}
+	REQUIRE(result[0].mantissa() == -0x8000);
+	REQUIRE(result[15] == Float16T::ZERO());
+}
+
+TEST_CASE("Vector kernels may store into an operand.") {
+	std::mt19937 generator(11);
+	const auto first = random_values(generator, 1001);
+	auto result = random_values(generator, 1001);
+	const auto second = result;
+
+	mul(first, result, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result[i] == first[i] * second[i]);
+	}
+}
+
+TEST_CASE("Conversion kernels match the scalar conversions bit for bit.") {
+	std::mt19937_64 generator(13);
+	std::uniform_int_distribution<uint64_t> bits;
+	std::uniform_int_distribution<int> exponent(-140, 140);
+	std::uniform_int_distribution<int> special(0, 63);
+
+	// Random bits cover the whole range, scaled values mostly that of floats.
+	std::vector<double> doubles;
+	for (std::size_t i = 0; i < 100'003; ++i) {
+		const auto pattern = bits(generator);
+		double value;
+		std::memcpy(&value, &pattern, sizeof(value));
+		switch (special(generator)) {
+		case 0:
+			value = std::numeric_limits<double>::infinity();
+			break;
+		case 1:
+			value = std::numeric_limits<double>::denorm_min();
+			break;
+		case 2:
+			value = -0.0;
+			break;
+		default:
+			if (i % 2 == 0) {
+				value = std::ldexp(static_cast<double>(static_cast<int64_t>(pattern)),
+				                   exponent(generator) - 63);
+			}
+		}
+		doubles.push_back(value);
+	}
+
+	FloatVector<Float16T> values;
+	convert(doubles.data(), doubles.size(), values);
+	REQUIRE(values.size() == doubles.size());
+	for (std::size_t i = 0; i < doubles.size(); ++i) {
+		const auto expected = Float16T(doubles[i]);
+		REQUIRE(values.mantissas()[i] == expected.mantissa());
+		REQUIRE(values.exponents()[i] == expected.exponent());
+	}
+
+	std::mt19937 value_generator(17);
+	const auto source = random_values(value_generator, 100'003);
+	std::vector<double> converted(source.size());
+	convert(source, converted.data());
+	for (std::size_t i = 0; i < source.size(); ++i) {
+		const auto expected = static_cast<double>(source[i]);
+		REQUIRE(std::memcmp(&converted[i], &expected, sizeof(expected)) == 0);
+	}
+}
@@ -0,0 +1,171 @@
+#include "test_utils.hpp"
+
+#include "fas/vector.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+//! @returns Random finite values of `Tfloat` across the whole exponent range,
+//! a few of them special.
+template <typename Tfloat> std::vector<Tfloat> random_values(std::size_t count) {
+	using Tmantissa = std::remove_cv_t<decltype(Tfloat::EXPONENT_BASE())>;
+	using Texponent = decltype(Tfloat::MAX().exponent());
+	std::mt19937_64 generator(count);
+	std::uniform_int_distribution<std::int64_t> mantissa(
+	    std::numeric_limits<Tmantissa>::lowest(),
+	    std::numeric_limits<Tmantissa>::max());
+	std::uniform_int_distribution<int> exponent(
+	    std::numeric_limits<Texponent>::lowest() + 16,
+	    std::numeric_limits<Texponent>::max() - 16);
+
+	std::vector<Tfloat> result;
+	for (std::size_t i = 0; i < count; ++i) {
+		switch (i % 64) {
+		case 1:
+			result.push_back(Tfloat::ZERO());
+			break;
+		case 2:
+			result.push_back(Tfloat::INF());
+			break;
+		case 3:
+			result.push_back(Tfloat::NEGATIVE_INF());
+			break;
+		case 4:
+			result.push_back(Tfloat::NOT_A_NUMBER());
+			break;
+		default:
+			result.push_back(
+			    Tfloat(static_cast<Tmantissa>(mantissa(generator)),
+			           static_cast<Texponent>(exponent(generator))));
+		}
+	}
+	return result;
+}
+
+//! Checks that the keys of `values` are ordered like the values themselves,
+//! and that sorting a vector of them matches `std::sort`.
+template <typename Tfloat> void check_order(const std::size_t count) {
+	const auto values = random_values<Tfloat>(count);
+	for (std::size_t i = 1; i < values.size(); ++i) {
+		const auto &first = values[i - 1];
+		const auto &second = values[i];
+		if (first.classify() != classification::not_a_number &&
+		    second.classify() != classification::not_a_number) {
+			REQUIRE((sort_key(first) < sort_key(second)) == (first < second));
+			REQUIRE((sort_key(first) == sort_key(second)) == (first == second));
+		}
+	}
+
+	FloatVector<Tfloat> vector;
+	for (const auto &value : values) {
+		vector.push_back(value);
+	}
+	sort(vector);
+
+	auto expected = values;
+	std::sort(expected.begin(), expected.end(),
+	          [](const Tfloat &first, const Tfloat &second) {
+		          return sort_key(first) < sort_key(second);
+	          });
+	REQUIRE(vector.size() == expected.size());
+	for (std::size_t i = 0; i < expected.size(); ++i) {
+		REQUIRE(vector[i] == expected[i]);
+	}
+}
+
+} // namespace
+
+TEST_CASE("Sort keys are constexpressions.") {
+	static_assert(sort_key(float8_t(-1)) < sort_key(float8_t::ZERO()));
+	static_assert(sort_key(float8_t(1)) < sort_key(float8_t(2)));
+	static_assert(float8_t::from_sort_key(sort_key(float8_t(3))) == 3);
+}
+
+TEST_CASE("Sort keys follow the total order.") {
+	const float8_t ordered[] = {float8_t::NEGATIVE_INF(),
+	                            float8_t::LOWEST(),
+	                            float8_t(-100),
+	                            float8_t(-1),
+	                            float8_t(-0.5),
+	                            float8_t::ZERO(),
+	                            float8_t::MIN(),
+	                            float8_t(0.25),
+	                            float8_t(1),
+	                            float8_t(3),
+	                            float8_t::MAX(),
+	                            float8_t::INF(),
+	                            float8_t::NOT_A_NUMBER()};
+	for (std::size_t i = 1; i < std::size(ordered); ++i) {
+		REQUIRE(sort_key(ordered[i - 1]) < sort_key(ordered[i]));
+	}
+
+	for (const auto &value : ordered) {
+		REQUIRE(float8_t::from_sort_key(sort_key(value)) == value);
+	}
+
+	// The keys take just wide enough types.
+	REQUIRE(sizeof(float8_t::sort_key_type) == 4);
+	REQUIRE(sizeof(Float<int32_t, int16_t>::sort_key_type) == 8);
+	REQUIRE(sizeof(Float<int64_t, int16_t>::sort_key_type) == 16);
+}
+
+TEST_CASE("Sort keys of random values.") {
+	check_order<float8_t>(100);
+	check_order<float8_t>(5000);
+	check_order<Float<int16_t, int8_t>>(5000);
+	check_order<Float<int32_t, int16_t>>(5000);
+	check_order<Float<int64_t, int16_t>>(5000);
+	check_order<Float<int32_t, int16_t, 10>>(5000);
+	check_order<Float<uint8_t, int8_t>>(1000);
+}
+
+TEST_CASE("Sorting vectors.") {
+	FloatVector<float8_t> values = {float8_t(3),
+	                                float8_t::NOT_A_NUMBER(),
+	                                float8_t(-1),
+	                                float8_t::INF(),
+	                                float8_t::ZERO(),
+	                                float8_t(-1),
+	                                float8_t::NEGATIVE_INF()};
+	sort(values);
+	REQUIRE(values[0] == float8_t::NEGATIVE_INF());
+	REQUIRE(values[1] == -1);
+	REQUIRE(values[2] == -1);
+	REQUIRE(values[3] == 0);
+	REQUIRE(values[4] == 3);
+	REQUIRE(values[5] == float8_t::INF());
+	REQUIRE(values[6].classify() == classification::not_a_number);
+
+	FloatVector<float8_t> empty;
+	sort(empty);
+	REQUIRE(empty.empty());
+
+	// Equal exponents skip the exponents' passes.
+	FloatVector<Float<int32_t, int16_t>> same;
+	for (int i = 1000; i > 0; --i) {
+		same.push_back(Float<int32_t, int16_t>(i * 4 + 1, 0));
+	}
+	sort(same);
+	for (std::size_t i = 1; i < same.size(); ++i) {
+		REQUIRE(same[i - 1] < same[i]);
+	}
+}
+
+TEST_CASE("Hashing floats.") {
+	const std::hash<float8_t> hash;
+	REQUIRE(hash(float8_t(3)) == hash(float8_t(1.5) * 2));
+	REQUIRE(hash(float8_t(3)) != hash(float8_t(-3)));
+
+	std::unordered_set<Float<int32_t, int16_t>> set;
+	for (int i = 0; i < 1000; ++i) {
+		set.insert(Float<int32_t, int16_t>(i % 100) / 4);
+	}
+	REQUIRE(set.size() == 100);
+	REQUIRE(set.count(Float<int32_t, int16_t>(0.25)) == 1);
+	REQUIRE(set.count(Float<int32_t, int16_t>(30)) == 0);
+}
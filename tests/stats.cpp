@@ -0,0 +1,161 @@
+#include "test_utils.hpp"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+
+// Built as a program of its own, since `FAS_STATS` needs to be defined in all
+// translation units.
+#if !defined(FAS_STATS)
+#error "The tests of the instrumentation need FAS_STATS to be defined."
+#endif
+
+namespace {
+
+//! The events seen by `hook`.
+thread_local stats::counters hooked;
+
+void hook(const stats::event what) { ++hooked[what]; }
+
+} // namespace
+
+TEST_CASE("Counting operations.") {
+	REQUIRE(stats::ENABLED);
+	stats::reset();
+
+	const float8_t a(100);
+	const float8_t b(3);
+	volatile int repeat = 3;
+	for (int i = 0; i < repeat; ++i) {
+		static_cast<void>(a + b);
+	}
+	static_cast<void>(a - b);
+	static_cast<void>(a * b);
+	static_cast<void>(a / b);
+
+	const auto counted = stats::snapshot();
+	REQUIRE(counted[stats::event::sum] == 4);
+	REQUIRE(counted[stats::event::product] == 1);
+	REQUIRE(counted[stats::event::quotient] == 1);
+	REQUIRE(counted[stats::event::special_operand] == 0);
+	REQUIRE(counted[stats::event::overflow] == 0);
+
+	stats::reset();
+	REQUIRE(stats::snapshot()[stats::event::sum] == 0);
+}
+
+TEST_CASE("Counting slow paths.") {
+	stats::reset();
+
+	// The sum's mantissa overflows, but it is aligned in the doubled width.
+	static_cast<void>(float8_t(100) + float8_t(100));
+	REQUIRE(stats::snapshot()[stats::event::sum] == 1);
+	REQUIRE(stats::snapshot()[stats::event::sum_realignment] == 0);
+
+	// A third takes steps of the long division.
+	static_cast<void>(float8_t(1) / float8_t(3));
+	REQUIRE(stats::snapshot()[stats::event::quotient_step] > 0);
+
+	// Special operands take a path of their own.
+	static_cast<void>(float8_t(1) + float8_t::ZERO());
+	static_cast<void>(float8_t::INF() * float8_t(2));
+	REQUIRE(stats::snapshot()[stats::event::special_operand] == 2);
+
+	// Tiny products become zero.
+	static_cast<void>(float8_t::MIN() * float8_t::MIN());
+	REQUIRE(stats::snapshot()[stats::event::underflow] == 1);
+}
+
+TEST_CASE("Constant expressions are not counted.") {
+	stats::reset();
+	constexpr auto sum = float8_t(1) + float8_t(2);
+	static_assert(sum == 3);
+	REQUIRE(stats::snapshot()[stats::event::sum] == 0);
+}
+
+TEST_CASE("Hooks on overflows and new NaNs.") {
+	stats::reset();
+	hooked = {};
+	REQUIRE(stats::set_hook(hook) == nullptr);
+
+	static_cast<void>(float8_t::MAX() * float8_t::MAX());
+	static_cast<void>(float8_t::MAX() + float8_t::MAX());
+	static_cast<void>(float8_t(1) / float8_t::ZERO());
+	static_cast<void>(float8_t::INF() - float8_t::INF());
+	static_cast<void>(float8_t::ZERO() * float8_t::INF());
+
+	// Propagated NaNs are not new ones.
+	static_cast<void>(float8_t::NOT_A_NUMBER() + float8_t(1));
+
+	REQUIRE(hooked[stats::event::overflow] == 2);
+	REQUIRE(hooked[stats::event::division_by_zero] == 1);
+	REQUIRE(hooked[stats::event::not_a_number] == 2);
+	REQUIRE(hooked[stats::event::sum] == 0);
+
+	const auto counted = stats::snapshot();
+	REQUIRE(counted[stats::event::overflow] == 2);
+	REQUIRE(counted[stats::event::not_a_number] == 2);
+
+	REQUIRE(stats::set_hook(nullptr) == hook);
+	static_cast<void>(float8_t::MAX() * float8_t::MAX());
+	REQUIRE(hooked[stats::event::overflow] == 2);
+}
+
+TEST_CASE("Saturated results count overflows too.") {
+	using saturating_t = saturating<float8_t>;
+	stats::reset();
+	hooked = {};
+	stats::set_hook(hook);
+
+	static_cast<void>(saturating_t(3) * saturating_t(5));
+	static_cast<void>(saturating_t::MAX() * saturating_t::MAX());
+	static_cast<void>(saturating_t::MIN() * saturating_t::MIN());
+	static_cast<void>(saturating_t(1) / saturating_t::ZERO());
+	stats::set_hook(nullptr);
+
+	// Only the events, which happened, call the hook.
+	REQUIRE(hooked[stats::event::overflow] == 1);
+	REQUIRE(hooked[stats::event::division_by_zero] == 1);
+	const auto counted = stats::snapshot();
+	REQUIRE(counted[stats::event::overflow] == 1);
+	REQUIRE(counted[stats::event::underflow] == 1);
+}
+
+TEST_CASE("Counters are thread local.") {
+	stats::reset();
+	static_cast<void>(float8_t(1) + float8_t(2));
+
+	stats::counters other;
+	std::thread thread([&other] {
+		static_cast<void>(float8_t(1) * float8_t(2));
+		other = stats::snapshot();
+	});
+	thread.join();
+
+	REQUIRE(other[stats::event::sum] == 0);
+	REQUIRE(other[stats::event::product] == 1);
+	REQUIRE(stats::snapshot()[stats::event::product] == 0);
+
+	auto total = stats::snapshot();
+	total += other;
+	REQUIRE(total[stats::event::sum] == 1);
+	REQUIRE(total[stats::event::product] == 1);
+}
+
+TEST_CASE("Dumping counters.") {
+	stats::reset();
+	static_cast<void>(float8_t(1) + float8_t(2));
+
+	std::FILE *target = std::tmpfile();
+	REQUIRE(target != nullptr);
+	stats::dump(target);
+	std::rewind(target);
+
+	char line[64] = {};
+	REQUIRE(std::fgets(line, sizeof(line), target) != nullptr);
+	REQUIRE(std::string(line) == "sum               1\n");
+	std::fclose(target);
+
+	REQUIRE(std::string(stats::name(stats::event::not_a_number)) ==
+	        "not_a_number");
+}
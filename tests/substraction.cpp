@@ -40,16 +40,33 @@ TEST_CASE("Substracting a negative value should increase the target.") {
 
 TEST_CASE("Substracting values out of mantissa's range\
  should decrease exponent.") {
+	// The exact differences get truncated to the even numbers towards zero.
 	REQUIRE(float8_t(-0x7f) - 1 == -0x80);
 	REQUIRE(float8_t(-0x7f) - 2 == -0x80);
-	REQUIRE(float8_t(-0x7f) - 3 == -0x80);
+	REQUIRE(float8_t(-0x7f) - 3 == -0x82);
 	REQUIRE(float8_t(-0x7f) - 4 == -0x82);
-	REQUIRE(float8_t(-0x7f) - 5 == -0x82);
+	REQUIRE(float8_t(-0x7f) - 5 == -0x84);
 	REQUIRE(float8_t(-0x7f) - 6 == -0x84);
-	REQUIRE(float8_t(-0x7f) - 7 == -0x84);
+	REQUIRE(float8_t(-0x7f) - 7 == -0x86);
 	REQUIRE(float8_t(-0x7f) - 8 == -0x86);
 
-	REQUIRE(float8_t(0xf000) - (-0x100) == 0xf100);
+	REQUIRE(float8_t(0xf000) - (-0x100) == float8_t(0xf100));
+}
+
+TEST_CASE("Substracting a negative value out of a wide mantissa's range.") {
+	using float32_t = Float<int32_t, int16_t>;
+	REQUIRE(float32_t(3) - (-3.5) == 6.5);
+	REQUIRE(float32_t::MAX() - float32_t::LOWEST() == float32_t::INF());
+}
+
+TEST_CASE("Substracting a negative value out of the range of a mantissa\
+ without a doubled width.") {
+	using float128_t = Float<__int128, int16_t>;
+	REQUIRE(float128_t(3) - (-3.5) == 6.5);
+	REQUIRE(float128_t(-3) - 3.5 == -6.5);
+	REQUIRE(float128_t::MAX() - float128_t::LOWEST() == float128_t::INF());
+	REQUIRE(float128_t::LOWEST() - float128_t::MAX() ==
+	        float128_t::NEGATIVE_INF());
 }
 
 TEST_CASE("Substracting unsigned flouts.") {
@@ -65,7 +82,9 @@ TEST_CASE("Substracting unsigned flouts.") {
 
 TEST_CASE(
     "Expect NEGATIVE_INF resulting a substraction in a too small value.") {
-	REQUIRE(float8_t::LOWEST() - 1 == float8_t::NEGATIVE_INF());
+	// Substracting a tiny value truncates to the lowest one.
+	REQUIRE(float8_t::LOWEST() - 1 == float8_t::LOWEST());
+	REQUIRE(float8_t::LOWEST() - float8_t::MAX() == float8_t::NEGATIVE_INF());
 
 	REQUIRE(float8_t(-0x70, 0x7f) - float8_t(0x70, 0x7f) ==
 	        float8_t::NEGATIVE_INF());
@@ -96,6 +115,12 @@ TEST_CASE("Expect NEGATIVE_INF if anything is substracted from it.") {
 	REQUIRE(float8_t::NEGATIVE_INF() - 1 == float8_t::NEGATIVE_INF());
 	REQUIRE(float8_t(1) - float8_t::INF() ==
 	        float8_t::NEGATIVE_INF());
+
+	// Negating the lowest value overflows, subtracting it does not.
+	REQUIRE(float8_t::NEGATIVE_INF() - float8_t::LOWEST() ==
+	        float8_t::NEGATIVE_INF());
+	REQUIRE(float8_t::INF() - float8_t::LOWEST() == float8_t::INF());
+	REQUIRE(float8_t::ZERO() - float8_t::LOWEST() == float8_t::INF());
 }
 
 TEST_CASE("Expect -= do be defined.") {
@@ -107,3 +132,13 @@ TEST_CASE("Expect -= do be defined.") {
 	target -= float8_t(1);
 	REQUIRE(target == 1);
 }
+
+TEST_CASE("Substracting values of distant exponents.") {
+	// The difference of the exponents does not fit their type.
+	using Float64T = Float<int64_t, int8_t>;
+	const Float64T large(1, 100);
+	const Float64T tiny(1, -100);
+	REQUIRE(large - tiny == large);
+	REQUIRE(tiny - large == -large);
+	REQUIRE(-tiny - large == -large);
+}
@@ -0,0 +1,98 @@
+#include "test_utils.hpp"
+
+#include "fas/table.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace {
+
+using tiny_t = Float<int8_t, int8_t, 2, -8, 7, -4, 3>;
+using tabled_t = TabledFloat<tiny_t>;
+
+//! @returns All normalized and special values of `tiny_t`.
+std::vector<tiny_t> all_values() {
+	std::vector<tiny_t> result = {tiny_t::ZERO(), tiny_t::INF(),
+	                              tiny_t::NEGATIVE_INF(),
+	                              tiny_t::NOT_A_NUMBER()};
+	for (int exponent = -4; exponent <= 3; ++exponent) {
+		for (int mantissa = -8; mantissa <= 7; ++mantissa) {
+			const tiny_t value(static_cast<int8_t>(mantissa),
+			                   static_cast<int8_t>(exponent));
+			if (std::none_of(result.begin(), result.end(),
+			                 [&value](const tiny_t &other) {
+				                 return sort_key(other) == sort_key(value);
+			                 })) {
+				result.push_back(value);
+			}
+		}
+	}
+	return result;
+}
+
+//! Whether both values are not a number or equal.
+bool same(const tiny_t &first, const tiny_t &second) {
+	return first == second ||
+	       (first.classify() == classification::not_a_number &&
+	        second.classify() == classification::not_a_number);
+}
+
+} // namespace
+
+TEST_CASE("Tables are constexpressions.") {
+	static_assert(tabled_t::TABULATED);
+	static_assert(!TabledFloat<float8_t>::TABULATED);
+	static_assert(!TabledFloat<tiny_t, 1 << 12>::TABULATED);
+	static_assert(!TabledFloat<Float<int64_t, int16_t>>::TABULATED);
+	static_assert(detail::tabulation<tiny_t>::ENTRIES == 128 * 128);
+
+	static_assert((tabled_t(tiny_t(2)) * tabled_t(tiny_t(3))).value() == 6);
+	static_assert((tabled_t(tiny_t(2)) + tabled_t(tiny_t(3))).value() == 5);
+}
+
+TEST_CASE("Tables hold the results of the operators.") {
+	const auto values = all_values();
+	// Four normalized mantissas of either sign per exponent, and the special
+	// values.
+	REQUIRE(values.size() == 2 * 4 * 8 + 4);
+
+	std::size_t loads = 0;
+	for (const auto &first : values) {
+		for (const auto &second : values) {
+			const tabled_t a = first;
+			const tabled_t b = second;
+			REQUIRE(same((a + b).value(), first + second));
+			REQUIRE(same((a - b).value(), first - second));
+			REQUIRE(same((a * b).value(), first * second));
+			REQUIRE(same((a / b).value(), first / second));
+			++loads;
+		}
+	}
+	REQUIRE(loads == values.size() * values.size());
+}
+
+TEST_CASE("Tables of other operations.") {
+	constexpr auto less = make_table<std::less<>, tiny_t>();
+	static_assert(less[table_index(tiny_t(-1), tiny_t(1))]);
+	static_assert(!less[table_index(tiny_t(1), tiny_t(-1))]);
+	REQUIRE(less.size() == detail::tabulation<tiny_t>::ENTRIES);
+}
+
+TEST_CASE("Floats too large for tables take their operators.") {
+	using wide_t = TabledFloat<float8_t>;
+	const wide_t a = float8_t(1.5);
+	const wide_t b = float8_t(-3);
+
+	REQUIRE((a * b).value() == -4.5);
+	REQUIRE((a + b).value() == -1.5);
+	REQUIRE((a - b).value() == 4.5);
+	REQUIRE((a / b).value() == -0.5);
+	REQUIRE(-a == wide_t(float8_t(-1.5)));
+	REQUIRE(a > b);
+
+	auto c = a;
+	c *= b;
+	c += a;
+	REQUIRE(c.value() == -3);
+}
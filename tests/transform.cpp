@@ -0,0 +1,90 @@
+#include "test_utils.hpp"
+
+#include "fas/transform.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+using float32_t = Float<int32_t, int16_t>;
+
+//! @returns `count` values of different magnitudes and signs.
+FloatVector<float32_t> values(const std::size_t count, const int offset) {
+	FloatVector<float32_t> result;
+	for (std::size_t i = 0; i < count; ++i) {
+		result.push_back(float32_t(static_cast<int>(i % 1000) - offset) / 7);
+	}
+	return result;
+}
+
+} // namespace
+
+TEST_CASE("Transforming vectors on several threads.") {
+	const auto first = values(100000, 500);
+	const auto second = values(100003, 300);
+	const auto product = [](const float32_t &a, const float32_t &b) {
+		return a * b;
+	};
+
+	FloatVector<float32_t> expected;
+	mul(first, second, expected);
+
+	for (const auto policy : {sequential, parallel, execution{4, 1000},
+	                          execution{3, 1}, execution{64, 100000}}) {
+		FloatVector<float32_t> result;
+		transform(policy, first, second, result, product);
+		REQUIRE(result.size() == first.size());
+		for (std::size_t i = 0; i < result.size(); ++i) {
+			REQUIRE(result[i] == expected[i]);
+		}
+	}
+}
+
+TEST_CASE("Transforming vectors in place.") {
+	auto target = values(10000, 5000);
+	const auto source = target;
+	transform(execution{4, 256}, target, target,
+	          [](const float32_t &value) { return -value; });
+	REQUIRE(target.size() == source.size());
+	for (std::size_t i = 0; i < target.size(); ++i) {
+		REQUIRE(target[i] == -source[i]);
+	}
+
+	FloatVector<float32_t> empty;
+	transform(parallel, empty, empty, target, std::plus<>());
+	REQUIRE(target.empty());
+}
+
+TEST_CASE("Fused steps equal separate passes.") {
+	const auto gains = values(50000, 100);
+	const auto samples = values(50000, 700);
+	const float32_t bias(3, -2);
+	const float32_t low(-10);
+	const float32_t high(10);
+	const auto add_bias = [bias](const float32_t &value) { return value + bias; };
+	const auto clamp = [low, high](const float32_t &value) {
+		return std::clamp(value, low, high);
+	};
+
+	FloatVector<float32_t> separate;
+	mul(gains, samples, separate);
+	transform(sequential, separate, separate, add_bias);
+	transform(sequential, separate, separate, clamp);
+
+	FloatVector<float32_t> fused;
+	transform(execution{4, 4096}, gains, samples, fused,
+	          fuse(std::multiplies<>(), add_bias, clamp));
+	REQUIRE(fused.size() == separate.size());
+	for (std::size_t i = 0; i < fused.size(); ++i) {
+		REQUIRE(fused[i] == separate[i]);
+	}
+
+	// A fused unary operation and one without steps.
+	constexpr auto twice = fuse([](const float8_t &value) { return value * 2; });
+	static_assert(twice(float8_t(3)) == 6);
+	const auto pipeline = fuse(twice, [](const float8_t &value) {
+		return value - 1;
+	});
+	REQUIRE(pipeline(float8_t(3)) == 5);
+}
@@ -0,0 +1,142 @@
+#include "test_utils.hpp"
+
+#include "fas/vector.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST_CASE("Vectors store their values.") {
+	FloatVector<float8_t> values = {float8_t(1), float8_t::INF(),
+	                                float8_t::NOT_A_NUMBER(), float8_t(-3)};
+
+	REQUIRE(values.size() == 4);
+	REQUIRE(values[0] == 1);
+	REQUIRE(values[1] == float8_t::INF());
+	REQUIRE(values[2] == float8_t::NOT_A_NUMBER());
+	REQUIRE(values[3] == -3);
+
+	values.set(0, float8_t(5));
+	REQUIRE(values[0] == 5);
+
+	REQUIRE(FloatVector<float8_t>(3)[2] == float8_t::ZERO());
+}
+
+TEST_CASE("Vectors store their mantissas and exponents aligned.") {
+	FloatVector<Float<int32_t, int8_t>> values(5);
+
+	REQUIRE(reinterpret_cast<std::uintptr_t>(values.mantissas()) % 64 == 0);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(values.exponents()) % 64 == 0);
+}
+
+TEST_CASE("Vector operations match the scalar operators.") {
+	const FloatVector<float8_t> first = {float8_t(3), float8_t(-7),
+	                                     float8_t(0.25), float8_t::INF(),
+	                                     float8_t::MAX()};
+	const FloatVector<float8_t> second = {float8_t(5), float8_t(2),
+	                                      float8_t(-100), float8_t(1),
+	                                      float8_t::MAX()};
+	FloatVector<float8_t> result;
+
+	add(first, second, result);
+	REQUIRE(result.size() == first.size());
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result[i] == first[i] + second[i]);
+	}
+
+	sub(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result[i] == first[i] - second[i]);
+	}
+
+	mul(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result[i] == first[i] * second[i]);
+	}
+
+	div(first, second, result);
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE(result[i] == first[i] / second[i]);
+	}
+
+	std::vector<int> order;
+	compare(first, second, order);
+	REQUIRE(order.size() == first.size());
+	for (std::size_t i = 0; i < first.size(); ++i) {
+		REQUIRE((order[i] < 0) == (first[i] < second[i]));
+		REQUIRE((order[i] == 0) == (first[i] == second[i]));
+	}
+}
+
+TEST_CASE("Vector operations may store into an operand.") {
+	FloatVector<float8_t> values = {float8_t(3), float8_t(-7)};
+
+	add(values, values, values);
+	REQUIRE(values[0] == 6);
+	REQUIRE(values[1] == -14);
+}
+
+TEST_CASE("Scaling vectors adjusts the exponents.") {
+	const FloatVector<float8_t> values = {float8_t(3), float8_t(-7),
+	                                      float8_t::NOT_A_NUMBER(),
+	                                      float8_t::MAX(), float8_t::LOWEST()};
+	FloatVector<float8_t> result;
+
+	scale(values, 2, result);
+	REQUIRE(result[0] == 12);
+	REQUIRE(result[1] == -28);
+	REQUIRE(result[2] == float8_t::NOT_A_NUMBER());
+	REQUIRE(result[3] == float8_t::INF());
+	REQUIRE(result[4] == float8_t::NEGATIVE_INF());
+
+	scale(values, -1000, result);
+	REQUIRE(result[0] == float8_t::ZERO());
+	REQUIRE(result[2] == float8_t::NOT_A_NUMBER());
+}
+
+TEST_CASE("Scaling vectors of saturating floats clamps the exponents.") {
+	using saturating_t = saturating<Float<int16_t, int8_t>>;
+	const FloatVector<saturating_t> values = {
+	    saturating_t(3), saturating_t(-7), saturating_t::MAX(),
+	    saturating_t::LOWEST(), saturating_t::MIN()};
+	FloatVector<saturating_t> result;
+
+	for (const std::intmax_t n : {-1000, -5, 0, 5, 300, 1000}) {
+		scale(values, n, result);
+		for (std::size_t i = 0; i < values.size(); ++i) {
+			REQUIRE(result[i] == values[i].scale(n));
+		}
+	}
+
+	scale(values, 5, result);
+	REQUIRE(result[2] == saturating_t::MAX());
+	REQUIRE(result[3] == saturating_t::LOWEST());
+	REQUIRE(result[2].mantissa() != 0);
+}
+
+TEST_CASE("Converting native floats matches the scalar conversions.") {
+	const std::vector<double> doubles = {
+	    1.5, -0.1, 0, 1e300, -1e-300, std::numeric_limits<double>::infinity(),
+	    std::numeric_limits<double>::quiet_NaN()};
+	FloatVector<float8_t> values;
+
+	convert(doubles.data(), doubles.size(), values);
+	REQUIRE(values.size() == doubles.size());
+	for (std::size_t i = 0; i + 1 < doubles.size(); ++i) {
+		REQUIRE(values[i] == float8_t(doubles[i]));
+	}
+	REQUIRE(values[6].classify() == classification::not_a_number);
+
+	std::vector<float> floats(values.size());
+	convert(values, floats.data());
+	for (std::size_t i = 0; i + 1 < floats.size(); ++i) {
+		REQUIRE(floats[i] == static_cast<float>(values[i]));
+	}
+	REQUIRE(std::isnan(floats[6]));
+
+	const std::vector<float> narrow = {0.25f, -3.0f};
+	convert(narrow.data(), narrow.size(), values);
+	REQUIRE(values.size() == 2);
+	REQUIRE(values[0] == float8_t(0.25));
+	REQUIRE(values[1] == float8_t(-3));
+}
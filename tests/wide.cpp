@@ -0,0 +1,166 @@
+#include "test_utils.hpp"
+
+#include "fas/charconv.hpp"
+#include "fas/math.hpp"
+#include "fas/wide.hpp"
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+
+// Built as a program of its own, since `Float` takes class types as
+// template arguments only since C++20.
+#if __cplusplus < 202002L
+#error "The tests of wide mantissas need C++20."
+#endif
+
+namespace {
+
+using int128_t = WideInt<2>;
+using uint128_t = WideUInt<2>;
+using int256_t = WideInt<4>;
+
+using float128_t = Float<int128_t, int16_t>;
+using float256_t = rounded<Float<int256_t, int16_t>, rounding::nearest_even>;
+
+//! @returns `value` as native 128 bit integer.
+__int128 native(const int128_t &value) {
+	return static_cast<__int128>(value);
+}
+
+//! @returns `value` as written by `to_chars`.
+template <typename Tfloat> std::string text(const Tfloat &value) {
+	char buffer[max_chars<Tfloat>];
+	const auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+	return std::string(buffer, result.ptr);
+}
+
+//! @returns The value parsed by `from_chars`.
+template <typename Tfloat> Tfloat parse(const char *source) {
+	Tfloat result;
+	from_chars(source, source + std::strlen(source), result);
+	return result;
+}
+
+} // namespace
+
+TEST_CASE("Wide integers convert integers.") {
+	REQUIRE(native(int128_t(-5)) == -5);
+	REQUIRE(int128_t(-1).limbs[1] == ~std::uint64_t(0));
+	REQUIRE(uint128_t(std::uint64_t(1) << 63).limbs[1] == 0);
+	REQUIRE(native(int128_t(__int128(3) << 100)) == __int128(3) << 100);
+	REQUIRE(static_cast<int>(int256_t(-42)) == -42);
+	REQUIRE(static_cast<bool>(int256_t(0)) == false);
+
+	// Narrower integers are extended by their sign, wider ones truncated.
+	REQUIRE(int256_t(int128_t(-3)) == -3);
+	REQUIRE(int128_t(int256_t(7) << 130) == 0);
+
+	char buffer[80];
+	const auto power = int256_t(1) << 200;
+	auto result = to_chars(buffer, buffer + sizeof(buffer), -power);
+	REQUIRE(std::string(buffer, result.ptr) ==
+	        "-1606938044258990275541962092341162602522202993782792835301376");
+	result = to_chars(buffer, buffer + sizeof(buffer), uint128_t(0));
+	REQUIRE(std::string(buffer, result.ptr) == "0");
+	result = to_chars(buffer, buffer + 2, int128_t(100));
+	REQUIRE(result.ec == std::errc::value_too_large);
+
+	REQUIRE(std::numeric_limits<int256_t>::digits == 255);
+	REQUIRE(std::numeric_limits<uint128_t>::digits == 128);
+	REQUIRE(std::numeric_limits<int128_t>::max() ==
+	        int128_t(~(static_cast<unsigned __int128>(1) << 127)));
+	REQUIRE(std::numeric_limits<int128_t>::lowest() ==
+	        int128_t(static_cast<unsigned __int128>(1) << 127));
+}
+
+TEST_CASE("Wide integers compute like native ones.") {
+	std::mt19937_64 generator(29);
+	const auto random = [&generator] {
+		// Takes various widths, so the operations cover short limbs too.
+		const auto bits = generator() % 128;
+		auto value = (static_cast<__int128>(generator()) << 64 | generator()) >>
+		             (127 - bits);
+		return generator() % 2 ? -value : value;
+	};
+
+	for (int i = 0; i < 10000; ++i) {
+		const auto a = random();
+		const auto b = random();
+		const int shift = static_cast<int>(generator() % 128);
+		const auto wrapped = [](const unsigned __int128 value) {
+			return static_cast<__int128>(value);
+		};
+
+		REQUIRE(native(int128_t(a) + b) ==
+		        wrapped(static_cast<unsigned __int128>(a) + b));
+		REQUIRE(native(int128_t(a) - b) ==
+		        wrapped(static_cast<unsigned __int128>(a) - b));
+		REQUIRE(native(int128_t(a) * b) ==
+		        wrapped(static_cast<unsigned __int128>(a) * b));
+		REQUIRE((int128_t(a) < b) == (a < b));
+		REQUIRE(native(int128_t(a) << shift) ==
+		        wrapped(static_cast<unsigned __int128>(a) << shift));
+		REQUIRE(native(int128_t(a) >> shift) == a >> shift);
+		if (b != 0) {
+			REQUIRE(native(int128_t(a) / b) == a / b);
+			REQUIRE(native(int128_t(a) % b) == a % b);
+		}
+	}
+}
+
+TEST_CASE("Wide integers divide by many limbs.") {
+	std::mt19937_64 generator(256);
+	for (int i = 0; i < 1000; ++i) {
+		int256_t quotient;
+		int256_t divisor;
+		for (std::size_t j = 0; j < 2; ++j) {
+			quotient.limbs[j] = generator();
+			divisor.limbs[j] = generator() >> (generator() % 64);
+		}
+		quotient.limbs[1] >>= 1;
+		divisor.limbs[0] |= 1;
+		divisor.limbs[1] >>= 1;
+		const int256_t remainder = int256_t(generator()) % divisor;
+
+		const auto dividend = quotient * divisor + remainder;
+		REQUIRE(dividend / divisor == quotient);
+		REQUIRE(dividend % divisor == remainder);
+		REQUIRE(-dividend / divisor == -quotient);
+	}
+
+	REQUIRE(uint128_t(1).bit_width() == 1);
+	REQUIRE((int256_t(1) << 200).bit_width() == 201);
+	REQUIRE(detail::bit_width(uint128_t(0)) == 0);
+}
+
+TEST_CASE("Floats of wide mantissas.") {
+	const auto third = float128_t(1) / float128_t(3);
+	REQUIRE(text(third) == "0.333333333333333333333333333333333333333");
+	REQUIRE(third * float128_t(3) < float128_t(1));
+	REQUIRE(float128_t(0.5) + float128_t(0.25) == float128_t(0.75));
+	REQUIRE(static_cast<double>(float128_t(0.1)) == 0.1);
+	REQUIRE(static_cast<double>(float128_t(10) * float128_t(-3)) == -30);
+	REQUIRE(static_cast<int>(float128_t(7) - float128_t(12)) == -5);
+	REQUIRE(float128_t::MAX() * float128_t(2) == float128_t::INF());
+	REQUIRE(float128_t(1) / float128_t::ZERO() == float128_t::INF());
+
+	// The product of two mantissas is exact before getting rounded.
+	const float128_t big(int128_t(1) << 100, 0);
+	REQUIRE(big * big == float128_t(int128_t(1) << 100, 100));
+}
+
+TEST_CASE("Floats of 256 bit mantissas.") {
+	const char *pi =
+	    "3.14159265358979323846264338327950288419716939937510582097494459";
+	REQUIRE(text(parse<float256_t>(pi)) == pi);
+	REQUIRE(text(sqrt(float256_t(2))) ==
+	        "1.41421356237309504880168872420969807856967187537694807317667973"
+	        "799073247846212");
+
+	const auto seventh = float256_t(1) / float256_t(7);
+	REQUIRE(seventh * 7 == float256_t(1));
+	REQUIRE(text(float256_t(-2.25) * 2) == "-4.5");
+}